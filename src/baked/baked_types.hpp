@@ -4,7 +4,20 @@
 
 namespace fb::baked {
 
+enum class AssetType : uint {
+    Copy,
+    Mesh,
+    Texture,
+    CubeTexture,
+    Material,
+    AnimationMesh,
+    Font,
+    Meshlets,
+};
+
 struct Copy {
+    static constexpr AssetType ASSET_TYPE = AssetType::Copy;
+
     Span<const std::byte> data;
 };
 
@@ -24,7 +37,106 @@ struct SkinningVertex {
     float4 weights;
 };
 
+// Compact vertices, an optional copy of the vertices of a mesh at a third of
+// their size. Positions are unorm16 within the bounds of the mesh. Normals
+// are octahedral, as two snorm16. Tangents are an angle around the normal,
+// from the first vector of `tangent_basis`, as unorm15 over [-pi, pi], with
+// the bitangent sign in bit 15. Texcoords are halfs. Shaders decode them with
+// the functions of the same names in `kcn/core.hlsli`.
+struct CompactVertex {
+    uint position_xy;
+    uint position_z_tangent;
+    uint normal;
+    uint texcoord;
+};
+
+// Joints are four uint8, and weights four unorm8 that sum to 1.
+struct CompactSkinningVertex {
+    CompactVertex vertex;
+    uint joints;
+    uint weights;
+};
+
+// Compact positions decode to `position_min + position * position_scale`.
+struct VertexQuantization {
+    float3 position_min;
+    float3 position_scale;
+};
+
+inline auto decode_snorm16(uint bits) -> float {
+    return std::max((float)(int16_t)(bits & 0xffff) / 32767.0f, -1.0f);
+}
+
+inline auto decode_octahedral(float2 e) -> float3 {
+    auto n = float3(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+    const auto t = std::max(-n.z, 0.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return float3_normalize(n);
+}
+
+// Orthonormal basis around a unit vector (Duff et al., "Building an Orthonormal
+// Basis, Revisited").
+inline auto tangent_basis(float3 n) -> std::tuple<float3, float3> {
+    const auto z_sign = n.z >= 0.0f ? 1.0f : -1.0f;
+    const auto a = -1.0f / (z_sign + n.z);
+    const auto b = n.x * n.y * a;
+    return {
+        float3(1.0f + z_sign * n.x * n.x * a, z_sign * b, -z_sign * n.x),
+        float3(b, z_sign + n.y * n.y * a, -n.y),
+    };
+}
+
+inline auto decode_compact_vertex(const CompactVertex& v, const VertexQuantization& q)
+    -> Vertex {
+    const auto position = float3(
+        (float)(v.position_xy & 0xffff),
+        (float)(v.position_xy >> 16),
+        (float)(v.position_z_tangent & 0xffff)
+    );
+    const auto normal =
+        decode_octahedral(float2(decode_snorm16(v.normal), decode_snorm16(v.normal >> 16)));
+    const auto [t0, t1] = tangent_basis(normal);
+    const auto tangent_bits = v.position_z_tangent >> 16;
+    const auto angle = (float)(tangent_bits & 0x7fff) * (2.0f * FLOAT_PI / 32767.0f) - FLOAT_PI;
+    return Vertex {
+        .position = q.position_min + position * q.position_scale,
+        .normal = normal,
+        .texcoord = float2(float_from_half(v.texcoord & 0xffff), float_from_half(v.texcoord >> 16)),
+        .tangent = float4(
+            t0 * std::cos(angle) + t1 * std::sin(angle),
+            (tangent_bits & 0x8000) != 0 ? -1.0f : 1.0f
+        ),
+    };
+}
+
+inline auto decode_compact_skinning_vertex(
+    const CompactSkinningVertex& v,
+    const VertexQuantization& q
+) -> SkinningVertex {
+    const auto vertex = decode_compact_vertex(v.vertex, q);
+    return SkinningVertex {
+        .position = vertex.position,
+        .normal = vertex.normal,
+        .texcoord = vertex.texcoord,
+        .tangent = vertex.tangent,
+        .joints = uint4(
+            v.joints & 0xff,
+            (v.joints >> 8) & 0xff,
+            (v.joints >> 16) & 0xff,
+            v.joints >> 24
+        ),
+        .weights = float4(
+            (float)(v.weights & 0xff),
+            (float)((v.weights >> 8) & 0xff),
+            (float)((v.weights >> 16) & 0xff),
+            (float)(v.weights >> 24)
+        ) / 255.0f,
+    };
+}
+
 using Index = uint;
+using ShortIndex = uint16_t;
 
 struct Submesh {
     uint index_count;
@@ -32,11 +144,60 @@ struct Submesh {
     uint base_vertex;
 };
 
+// Box and sphere around the vertices of a mesh or submesh, in mesh space.
+// Skinned meshes are bounded in their bind pose.
+struct Bounds {
+    float3 min;
+    float3 max;
+    float3 center;
+    float radius;
+};
+
+// Levels of detail after the mesh itself share its vertices. Each has one
+// submesh per submesh of the mesh, in `lod_submeshes` from `start_submesh`,
+// with indices into `lod_indices`. `error` is how far its surface strays from
+// the mesh's, in mesh units, and grows from level to level.
+struct MeshLod {
+    uint start_submesh;
+    float error;
+};
+
+// Coarsest level of detail whose error stays within `max_error_pixels` on
+// screen, 0 for the mesh itself, and `n` for `lods[n - 1]`. `pixels_per_unit`
+// is the size in pixels of one mesh unit at the mesh's distance, which for a
+// perspective camera is `viewport_height / (2 * tan(fov_y / 2) * distance)`,
+// times the scale of the mesh.
+inline auto select_mesh_lod(Span<const MeshLod> lods, float pixels_per_unit, float max_error_pixels)
+    -> uint {
+    auto level = 0u;
+    while (level < lods.size() && lods[level].error * pixels_per_unit <= max_error_pixels) {
+        level++;
+    }
+    return level;
+}
+
+// Indices are 16 bits, in `short_indices` and `short_lod_indices`, if
+// `index_format` is `DXGI_FORMAT_R16_UINT`, and 32 bits in `indices` and
+// `lod_indices` otherwise. The other spans are empty. Either way, indices are
+// relative to the base vertex of their submesh. `submesh_bounds` has the
+// bounds of each submesh, and `bounds` those of the whole mesh.
 struct Mesh {
+    static constexpr AssetType ASSET_TYPE = AssetType::Mesh;
+
     float4x4 transform;
     Span<const Vertex> vertices;
+    DXGI_FORMAT index_format;
     Span<const Index> indices;
+    Span<const ShortIndex> short_indices;
     Span<const Submesh> submeshes;
+    Bounds bounds;
+    Span<const Bounds> submesh_bounds;
+    Span<const Index> lod_indices;
+    Span<const ShortIndex> short_lod_indices;
+    Span<const Submesh> lod_submeshes;
+    Span<const MeshLod> lods;
+    VertexQuantization quantization;
+    Span<const CompactVertex> compact_vertices;
 };
 
 inline constexpr uint MAX_MIP_COUNT = 12;
@@ -48,6 +209,8 @@ struct TextureData {
 };
 
 struct Texture {
+    static constexpr AssetType ASSET_TYPE = AssetType::Texture;
+
     DXGI_FORMAT format;
     uint width;
     uint height;
@@ -66,6 +229,8 @@ enum class CubeFace : uint {
 };
 
 struct CubeTexture {
+    static constexpr AssetType ASSET_TYPE = AssetType::CubeTexture;
+
     DXGI_FORMAT format;
     uint width;
     uint height;
@@ -80,6 +245,8 @@ enum class AlphaMode : uint {
 };
 
 struct Material {
+    static constexpr AssetType ASSET_TYPE = AssetType::Material;
+
     float alpha_cutoff;
     AlphaMode alpha_mode;
 };
@@ -93,14 +260,28 @@ struct AnimationChannel {
     size_t s_count;
 };
 
+// Indices and bounds are laid out like those of `Mesh`, with the bounds of the
+// bind pose.
 struct AnimationMesh {
+    static constexpr AssetType ASSET_TYPE = AssetType::AnimationMesh;
+
     float4x4 transform;
     uint node_count;
     uint joint_count;
     float duration;
     Span<const SkinningVertex> skinning_vertices;
+    DXGI_FORMAT index_format;
     Span<const Index> indices;
+    Span<const ShortIndex> short_indices;
     Span<const Submesh> submeshes;
+    Bounds bounds;
+    Span<const Bounds> submesh_bounds;
+    Span<const Index> lod_indices;
+    Span<const ShortIndex> short_lod_indices;
+    Span<const Submesh> lod_submeshes;
+    Span<const MeshLod> lods;
+    VertexQuantization quantization;
+    Span<const CompactSkinningVertex> compact_skinning_vertices;
     Span<const uint> joint_nodes;
     Span<const float4x4> joint_inverse_binds;
     Span<const uint> node_parents;
@@ -123,10 +304,376 @@ struct Glyph {
 };
 
 struct Font {
+    static constexpr AssetType ASSET_TYPE = AssetType::Font;
+
     float ascender;
     float descender;
     float space_advance;
     Span<const Glyph> glyphs;
 };
 
+inline constexpr uint MESHLET_MAX_VERTEX_COUNT = 64;
+inline constexpr uint MESHLET_MAX_TRIANGLE_COUNT = 124;
+
+// Vertices and triangles of a meshlet are ranges of those of its `Meshlets`.
+// The meshlet can be culled when the camera is outside its normal cone:
+// `dot(normalize(cone_apex - camera), cone_axis) >= cone_cutoff`. Meshlets
+// without a cone have a zero axis and a cutoff of 1.
+struct Meshlet {
+    uint vertex_offset;
+    uint vertex_count;
+    uint triangle_offset;
+    uint triangle_count;
+    float3 center;
+    float radius;
+    float3 cone_apex;
+    float3 cone_axis;
+    float cone_cutoff;
+};
+
+struct MeshletSubmesh {
+    uint meshlet_count;
+    uint start_meshlet;
+};
+
+// Meshlets of the mesh baked with the same name, submesh by submesh. Vertices
+// index the vertices of the mesh, base vertex included. Triangles pack three
+// indices into the vertices of their meshlet, in bits 0, 8 and 16.
+struct Meshlets {
+    static constexpr AssetType ASSET_TYPE = AssetType::Meshlets;
+
+    Span<const Meshlet> meshlets;
+    Span<const uint> vertices;
+    Span<const uint> triangles;
+    Span<const MeshletSubmesh> submeshes;
+};
+
+//
+// Bins.
+//
+
+// Layout of the baked bins: the data, then the table of contents at
+// `toc_offset`, with one entry per asset or shader in id order, one entry per
+// task that baked them, which only the baker reads, and the asset records,
+// then the header, last. Offsets are from the start of the file. Asset records
+// hold the fields of the asset in declaration order, with spans stored as
+// `SpanRecord`. Spans are aligned in the file, and the loaders assert that
+// they are aligned in memory too, so they can be used in place. The generation
+// is bumped by every publish of a watching baker, and by every selective bake
+// spliced into the bin.
+inline constexpr uint ASSETS_BIN_MAGIC = 0x53414246;
+inline constexpr uint SHADERS_BIN_MAGIC = 0x48534246;
+inline constexpr uint BIN_VERSION = 9;
+
+struct BinHeader {
+    uint magic;
+    uint version;
+    uint entry_count;
+    uint data_alignment;
+    uint64_t toc_offset;
+    uint64_t toc_byte_count;
+    uint64_t generation;
+    uint task_count;
+    uint reserved;
+};
+
+struct AssetEntry {
+    AssetType type;
+    uint record_byte_count;
+    uint64_t record_offset;
+    Hash128 hash;
+};
+
+struct SpanRecord {
+    uint64_t offset;
+    uint64_t element_count;
+    uint64_t byte_count;
+    uint64_t alignment;
+    Hash128 hash;
+};
+
+struct ShaderEntry {
+    uint64_t offset;
+    uint64_t byte_count;
+    Hash128 hash;
+};
+
+class AssetRecordReader {
+public:
+    AssetRecordReader(Span<const std::byte> file, const AssetEntry& entry)
+        : _file(file)
+        , _arc(file.subspan(entry.record_offset, entry.record_byte_count)) {}
+
+    auto fully_consumed() const -> bool { return _arc.fully_consumed(); }
+
+    template<Archivable T>
+    auto operator&(T& value) -> AssetRecordReader& {
+        _arc & value;
+        return *this;
+    }
+
+    template<typename T>
+    auto operator&(Span<const T>& span) -> AssetRecordReader& {
+        auto record = SpanRecord();
+        _arc & record;
+        FB_ASSERT(record.byte_count == record.element_count * sizeof(T));
+        FB_ASSERT(record.offset + record.byte_count <= _file.size());
+        FB_ASSERT(record.alignment % alignof(T) == 0);
+        const auto data = _file.data() + record.offset;
+        FB_ASSERT((uintptr_t)data % record.alignment == 0);
+        span = Span<const T>((const T*)data, record.element_count);
+        return *this;
+    }
+
+    auto operator&(TextureData& data) -> AssetRecordReader& {
+        return *this & data.row_pitch & data.slice_pitch & data.data;
+    }
+
+private:
+    Span<const std::byte> _file;
+    DeserializingArchive _arc;
+};
+
+inline auto read_asset(AssetRecordReader& r, Copy& v) -> void {
+    r & v.data;
+}
+
+inline auto read_asset(AssetRecordReader& r, Mesh& v) -> void {
+    r & v.transform & v.vertices;
+    r & v.index_format & v.indices & v.short_indices & v.submeshes;
+    r & v.bounds & v.submesh_bounds;
+    r & v.lod_indices & v.short_lod_indices & v.lod_submeshes & v.lods;
+    r & v.quantization & v.compact_vertices;
+}
+
+inline auto read_asset(AssetRecordReader& r, Texture& v) -> void {
+    r & v.format & v.width & v.height & v.channel_count & v.mip_count;
+    FB_ASSERT(v.mip_count <= MAX_MIP_COUNT);
+    for (uint mip = 0; mip < v.mip_count; mip++) {
+        r & v.datas[mip];
+    }
+}
+
+inline auto read_asset(AssetRecordReader& r, CubeTexture& v) -> void {
+    r & v.format & v.width & v.height & v.channel_count & v.mip_count;
+    FB_ASSERT(v.mip_count <= MAX_MIP_COUNT);
+    for (uint slice = 0; slice < 6; slice++) {
+        for (uint mip = 0; mip < v.mip_count; mip++) {
+            r & v.datas[slice][mip];
+        }
+    }
+}
+
+inline auto read_asset(AssetRecordReader& r, Material& v) -> void {
+    r & v.alpha_cutoff & v.alpha_mode;
+}
+
+inline auto read_asset(AssetRecordReader& r, AnimationMesh& v) -> void {
+    r & v.transform & v.node_count & v.joint_count & v.duration;
+    r & v.skinning_vertices;
+    r & v.index_format & v.indices & v.short_indices & v.submeshes;
+    r & v.bounds & v.submesh_bounds;
+    r & v.lod_indices & v.short_lod_indices & v.lod_submeshes & v.lods;
+    r & v.quantization & v.compact_skinning_vertices;
+    r & v.joint_nodes & v.joint_inverse_binds & v.node_parents & v.node_channels;
+    r & v.node_channels_times_t & v.node_channels_times_r & v.node_channels_times_s;
+    r & v.node_channels_values_t & v.node_channels_values_r & v.node_channels_values_s;
+}
+
+inline auto read_asset(AssetRecordReader& r, Font& v) -> void {
+    r & v.ascender & v.descender & v.space_advance & v.glyphs;
+}
+
+inline auto read_asset(AssetRecordReader& r, Meshlets& v) -> void {
+    r & v.meshlets & v.vertices & v.triangles & v.submeshes;
+}
+
+// Header of a bin in memory, at its end, if it is one of `entry_count`
+// entries, of the current version, and mapped at its data alignment.
+template<typename Entry>
+inline auto bin_header(Span<const std::byte> bytes, uint magic, uint entry_count)
+    -> Option<BinHeader> {
+    if (bytes.size() < sizeof(BinHeader)) {
+        return std::nullopt;
+    }
+    const auto header_offset = bytes.size() - sizeof(BinHeader);
+    const auto header = *(const BinHeader*)(bytes.data() + header_offset);
+    if (header.magic != magic || header.version != BIN_VERSION
+        || header.entry_count != entry_count) {
+        return std::nullopt;
+    }
+    if (header.toc_offset + header.toc_byte_count != header_offset
+        || header.entry_count * sizeof(Entry) > header.toc_byte_count
+        || header.toc_offset % alignof(Entry) != 0
+        || (uintptr_t)bytes.data() % header.data_alignment != 0) {
+        return std::nullopt;
+    }
+    return header;
+}
+
+// Entries of a bin whose header was checked by `bin_header`.
+template<typename Entry>
+inline auto bin_entries(Span<const std::byte> bytes) -> Span<const Entry> {
+    const auto& header = *(const BinHeader*)(bytes.data() + bytes.size() - sizeof(BinHeader));
+    return Span<const Entry>((const Entry*)(bytes.data() + header.toc_offset), header.entry_count);
+}
+
+// Ids of the assets whose entries differ between two versions of a bin, or
+// None if the versions hold different assets, which takes a rebuild.
+inline auto diff_asset_entries(
+    Span<const AssetEntry> old_entries,
+    Span<const AssetEntry> new_entries
+) -> Option<std::vector<uint>> {
+    if (old_entries.size() != new_entries.size()) {
+        return std::nullopt;
+    }
+    auto changed_ids = std::vector<uint>();
+    for (uint id = 0; id < old_entries.size(); id++) {
+        if (old_entries[id].type != new_entries[id].type) {
+            return std::nullopt;
+        }
+        if (old_entries[id].hash != new_entries[id].hash) {
+            changed_ids.push_back(id);
+        }
+    }
+    return changed_ids;
+}
+
+// Ids of the shaders whose entries differ between two versions of a bin, or
+// None if the versions hold a different number of shaders.
+inline auto diff_shader_entries(
+    Span<const ShaderEntry> old_entries,
+    Span<const ShaderEntry> new_entries
+) -> Option<std::vector<uint>> {
+    if (old_entries.size() != new_entries.size()) {
+        return std::nullopt;
+    }
+    auto changed_ids = std::vector<uint>();
+    for (uint id = 0; id < old_entries.size(); id++) {
+        if (old_entries[id].hash != new_entries[id].hash) {
+            changed_ids.push_back(id);
+        }
+    }
+    return changed_ids;
+}
+
+// Assets bin in memory. Assets are looked up by id in constant time, and
+// decoded from their record on every lookup.
+class AssetsFile {
+public:
+    auto load(std::string_view path, uint asset_count) -> void {
+        _file = FileBuffer::from_path(path);
+        const auto header = bin_header<AssetEntry>(_file.as_span(), ASSETS_BIN_MAGIC, asset_count);
+        FB_ASSERT_MSG(header.has_value(), "Invalid or outdated assets bin: {}", path);
+        _generation = header->generation;
+        _entries = entries_of(_file);
+    }
+
+    // Swaps in another version of the bin, and returns the ids of the assets
+    // whose contents changed. Unless nothing changed, the whole file is
+    // replaced, so every asset got from the previous version is invalidated,
+    // not only the changed ones. Nothing built from the assets, like GPU
+    // resources, is rebuilt here; callers redo that themselves. If the version
+    // holds different assets, or is invalid, it isn't loaded and None is
+    // returned.
+    auto reload(std::string_view path) -> Option<std::vector<uint>> {
+        auto file = FileBuffer::from_path(path);
+        const auto header =
+            bin_header<AssetEntry>(file.as_span(), ASSETS_BIN_MAGIC, (uint)_entries.size());
+        if (!header.has_value()) {
+            FB_LOG_WARN("Can't reload outdated assets bin: {}", path);
+            return std::nullopt;
+        }
+        auto changed_ids = diff_asset_entries(_entries, entries_of(file));
+        if (!changed_ids.has_value()) {
+            FB_LOG_WARN("Can't reload assets bin with different assets: {}", path);
+            return std::nullopt;
+        }
+        if (!changed_ids->empty()) {
+            _file = std::move(file);
+            _entries = entries_of(_file);
+        }
+        _generation = header->generation;
+        return changed_ids;
+    }
+
+    auto generation() const -> uint64_t { return _generation; }
+    auto entries() const -> Span<const AssetEntry> { return _entries; }
+
+    template<typename T>
+    auto get(uint id) const -> T {
+        FB_ASSERT(id < _entries.size());
+        const auto& entry = _entries[id];
+        FB_ASSERT(entry.type == T::ASSET_TYPE);
+        FB_ASSERT(entry.record_offset + entry.record_byte_count <= _file.byte_count());
+        auto reader = AssetRecordReader(_file.as_span(), entry);
+        auto asset = T();
+        read_asset(reader, asset);
+        FB_ASSERT(reader.fully_consumed());
+        return asset;
+    }
+
+private:
+    static auto entries_of(const FileBuffer& file) -> Span<const AssetEntry> {
+        return bin_entries<AssetEntry>(file.as_span());
+    }
+
+    FileBuffer _file;
+    Span<const AssetEntry> _entries;
+    uint64_t _generation = 0;
+};
+
+// Shaders bin in memory, with constant-time lookup of shaders by id.
+class ShadersFile {
+public:
+    auto load(std::string_view path, uint shader_count) -> void {
+        _file = FileBuffer::from_path(path);
+        const auto header =
+            bin_header<ShaderEntry>(_file.as_span(), SHADERS_BIN_MAGIC, shader_count);
+        FB_ASSERT_MSG(header.has_value(), "Invalid or outdated shaders bin: {}", path);
+        _generation = header->generation;
+        _entries = entries_of(_file);
+    }
+
+    // Swaps in another version of the bin, like `AssetsFile::reload`.
+    auto reload(std::string_view path) -> Option<std::vector<uint>> {
+        auto file = FileBuffer::from_path(path);
+        const auto header =
+            bin_header<ShaderEntry>(file.as_span(), SHADERS_BIN_MAGIC, (uint)_entries.size());
+        if (!header.has_value()) {
+            FB_LOG_WARN("Can't reload outdated shaders bin: {}", path);
+            return std::nullopt;
+        }
+        auto changed_ids = diff_shader_entries(_entries, entries_of(file));
+        if (!changed_ids.has_value()) {
+            FB_LOG_WARN("Can't reload shaders bin with different shaders: {}", path);
+            return std::nullopt;
+        }
+        if (!changed_ids->empty()) {
+            _file = std::move(file);
+            _entries = entries_of(_file);
+        }
+        _generation = header->generation;
+        return changed_ids;
+    }
+
+    auto generation() const -> uint64_t { return _generation; }
+    auto entries() const -> Span<const ShaderEntry> { return _entries; }
+
+    auto get(uint id) const -> Span<const std::byte> {
+        FB_ASSERT(id < _entries.size());
+        const auto& entry = _entries[id];
+        return _file.as_span().subspan(entry.offset, entry.byte_count);
+    }
+
+private:
+    static auto entries_of(const FileBuffer& file) -> Span<const ShaderEntry> {
+        return bin_entries<ShaderEntry>(file.as_span());
+    }
+
+    FileBuffer _file;
+    Span<const ShaderEntry> _entries;
+    uint64_t _generation = 0;
+};
+
 } // namespace fb::baked
@@ -4,123 +4,358 @@
 
 namespace fb::baked::buffet {
 
+enum class AssetId : uint {
+    HeatmapMagmaTexture,
+    HeatmapViridisTexture,
+    SciFiCaseMesh,
+    SciFiCaseMeshlets,
+    SciFiCaseBaseColorTexture,
+    SciFiCaseNormalTexture,
+    SciFiCaseMetallicRoughnessTexture,
+    SciFiCaseMaterial,
+    MetalPlaneMesh,
+    MetalPlaneMeshlets,
+    MetalPlaneBaseColorTexture,
+    MetalPlaneNormalTexture,
+    MetalPlaneMetallicRoughnessTexture,
+    MetalPlaneMaterial,
+    CoconutTreeMesh,
+    CoconutTreeMeshlets,
+    CoconutTreeBaseColorTexture,
+    CoconutTreeMaterial,
+    SandTexture,
+    SandMesh,
+    SandMeshlets,
+    RaccoonAnimationMesh,
+    RaccoonBaseColorTexture,
+    RaccoonMetallicRoughnessTexture,
+    RaccoonMaterial,
+    MixamoRunFemaleAnimationMesh,
+    MixamoRunFemaleBaseColorTexture,
+    MixamoRunFemaleMaterial,
+    MixamoRunMaleAnimationMesh,
+    MixamoRunMaleBaseColorTexture,
+    MixamoRunMaleMaterial,
+    LightBoundsMesh,
+    LightBoundsMeshlets,
+    SkyboxMesh,
+    SkyboxMeshlets,
+    SphereMesh,
+    SphereMeshlets,
+    WinterEveningLut,
+    WinterEveningIrr,
+    WinterEveningRad,
+    ShanghaiBundLut,
+    ShanghaiBundIrr,
+    ShanghaiBundRad,
+    IndustrialSunset02PureskyIrr,
+    RobotoMediumFont,
+    RobotoMediumMesh,
+    RobotoMediumMeshlets,
+    LightsaberMesh,
+    LightsaberMeshlets,
+    LightsaberBaseColorTexture,
+    LightsaberMaterial,
+    GrassMesh,
+    GrassMeshlets,
+    GrassBaseColorTexture,
+    GrassMaterial,
+};
+
+inline constexpr uint ASSET_COUNT = 55;
+
 class Assets {
 public:
     auto load() -> void;
 
-    auto heatmap_magma_texture() const -> Texture;
-    auto heatmap_viridis_texture() const -> Texture;
-    auto sci_fi_case_mesh() const -> Mesh;
-    auto sci_fi_case_base_color_texture() const -> Texture;
-    auto sci_fi_case_normal_texture() const -> Texture;
-    auto sci_fi_case_metallic_roughness_texture() const -> Texture;
-    auto sci_fi_case_material() const -> Material;
-    auto metal_plane_mesh() const -> Mesh;
-    auto metal_plane_base_color_texture() const -> Texture;
-    auto metal_plane_normal_texture() const -> Texture;
-    auto metal_plane_metallic_roughness_texture() const -> Texture;
-    auto metal_plane_material() const -> Material;
-    auto coconut_tree_mesh() const -> Mesh;
-    auto coconut_tree_base_color_texture() const -> Texture;
-    auto coconut_tree_material() const -> Material;
-    auto sand_texture() const -> Texture;
-    auto sand_mesh() const -> Mesh;
-    auto raccoon_animation_mesh() const -> AnimationMesh;
-    auto raccoon_base_color_texture() const -> Texture;
-    auto raccoon_metallic_roughness_texture() const -> Texture;
-    auto raccoon_material() const -> Material;
-    auto mixamo_run_female_animation_mesh() const -> AnimationMesh;
-    auto mixamo_run_female_base_color_texture() const -> Texture;
-    auto mixamo_run_female_material() const -> Material;
-    auto mixamo_run_male_animation_mesh() const -> AnimationMesh;
-    auto mixamo_run_male_base_color_texture() const -> Texture;
-    auto mixamo_run_male_material() const -> Material;
-    auto light_bounds_mesh() const -> Mesh;
-    auto skybox_mesh() const -> Mesh;
-    auto sphere_mesh() const -> Mesh;
-    auto winter_evening_lut() const -> Texture;
-    auto winter_evening_irr() const -> CubeTexture;
-    auto winter_evening_rad() const -> CubeTexture;
-    auto shanghai_bund_lut() const -> Texture;
-    auto shanghai_bund_irr() const -> CubeTexture;
-    auto shanghai_bund_rad() const -> CubeTexture;
-    auto industrial_sunset_02_puresky_irr() const -> CubeTexture;
-    auto roboto_medium_font() const -> Font;
-    auto roboto_medium_mesh() const -> Mesh;
-    auto lightsaber_mesh() const -> Mesh;
-    auto lightsaber_base_color_texture() const -> Texture;
-    auto lightsaber_material() const -> Material;
-    auto grass_mesh() const -> Mesh;
-    auto grass_base_color_texture() const -> Texture;
-    auto grass_material() const -> Material;
+    // Swaps in the bin published by a watching baker, and returns the assets
+    // whose contents changed. The whole bin is replaced, so every asset got
+    // earlier is invalidated, and nothing built from them is rebuilt. None if
+    // the assets themselves changed, which takes a rebuild.
+    auto reload() -> Option<std::vector<AssetId>>;
 
-private:
     template<typename T>
-    auto transmuted_span(size_t offset, size_t element_count) const -> Span<const T> {
-        return Span<const T>((const T*)(_file.bytes() + offset), element_count);
+    auto get(AssetId id) const -> T { return _file.get<T>((uint)id); }
+
+    auto heatmap_magma_texture() const -> Texture {
+        return get<Texture>(AssetId::HeatmapMagmaTexture);
+    }
+    auto heatmap_viridis_texture() const -> Texture {
+        return get<Texture>(AssetId::HeatmapViridisTexture);
+    }
+    auto sci_fi_case_mesh() const -> Mesh { return get<Mesh>(AssetId::SciFiCaseMesh); }
+    auto sci_fi_case_meshlets() const -> Meshlets {
+        return get<Meshlets>(AssetId::SciFiCaseMeshlets);
+    }
+    auto sci_fi_case_base_color_texture() const -> Texture {
+        return get<Texture>(AssetId::SciFiCaseBaseColorTexture);
+    }
+    auto sci_fi_case_normal_texture() const -> Texture {
+        return get<Texture>(AssetId::SciFiCaseNormalTexture);
+    }
+    auto sci_fi_case_metallic_roughness_texture() const -> Texture {
+        return get<Texture>(AssetId::SciFiCaseMetallicRoughnessTexture);
+    }
+    auto sci_fi_case_material() const -> Material {
+        return get<Material>(AssetId::SciFiCaseMaterial);
+    }
+    auto metal_plane_mesh() const -> Mesh { return get<Mesh>(AssetId::MetalPlaneMesh); }
+    auto metal_plane_meshlets() const -> Meshlets {
+        return get<Meshlets>(AssetId::MetalPlaneMeshlets);
+    }
+    auto metal_plane_base_color_texture() const -> Texture {
+        return get<Texture>(AssetId::MetalPlaneBaseColorTexture);
+    }
+    auto metal_plane_normal_texture() const -> Texture {
+        return get<Texture>(AssetId::MetalPlaneNormalTexture);
+    }
+    auto metal_plane_metallic_roughness_texture() const -> Texture {
+        return get<Texture>(AssetId::MetalPlaneMetallicRoughnessTexture);
+    }
+    auto metal_plane_material() const -> Material {
+        return get<Material>(AssetId::MetalPlaneMaterial);
+    }
+    auto coconut_tree_mesh() const -> Mesh { return get<Mesh>(AssetId::CoconutTreeMesh); }
+    auto coconut_tree_meshlets() const -> Meshlets {
+        return get<Meshlets>(AssetId::CoconutTreeMeshlets);
+    }
+    auto coconut_tree_base_color_texture() const -> Texture {
+        return get<Texture>(AssetId::CoconutTreeBaseColorTexture);
+    }
+    auto coconut_tree_material() const -> Material {
+        return get<Material>(AssetId::CoconutTreeMaterial);
+    }
+    auto sand_texture() const -> Texture { return get<Texture>(AssetId::SandTexture); }
+    auto sand_mesh() const -> Mesh { return get<Mesh>(AssetId::SandMesh); }
+    auto sand_meshlets() const -> Meshlets { return get<Meshlets>(AssetId::SandMeshlets); }
+    auto raccoon_animation_mesh() const -> AnimationMesh {
+        return get<AnimationMesh>(AssetId::RaccoonAnimationMesh);
+    }
+    auto raccoon_base_color_texture() const -> Texture {
+        return get<Texture>(AssetId::RaccoonBaseColorTexture);
+    }
+    auto raccoon_metallic_roughness_texture() const -> Texture {
+        return get<Texture>(AssetId::RaccoonMetallicRoughnessTexture);
+    }
+    auto raccoon_material() const -> Material { return get<Material>(AssetId::RaccoonMaterial); }
+    auto mixamo_run_female_animation_mesh() const -> AnimationMesh {
+        return get<AnimationMesh>(AssetId::MixamoRunFemaleAnimationMesh);
+    }
+    auto mixamo_run_female_base_color_texture() const -> Texture {
+        return get<Texture>(AssetId::MixamoRunFemaleBaseColorTexture);
+    }
+    auto mixamo_run_female_material() const -> Material {
+        return get<Material>(AssetId::MixamoRunFemaleMaterial);
+    }
+    auto mixamo_run_male_animation_mesh() const -> AnimationMesh {
+        return get<AnimationMesh>(AssetId::MixamoRunMaleAnimationMesh);
+    }
+    auto mixamo_run_male_base_color_texture() const -> Texture {
+        return get<Texture>(AssetId::MixamoRunMaleBaseColorTexture);
+    }
+    auto mixamo_run_male_material() const -> Material {
+        return get<Material>(AssetId::MixamoRunMaleMaterial);
+    }
+    auto light_bounds_mesh() const -> Mesh { return get<Mesh>(AssetId::LightBoundsMesh); }
+    auto light_bounds_meshlets() const -> Meshlets {
+        return get<Meshlets>(AssetId::LightBoundsMeshlets);
+    }
+    auto skybox_mesh() const -> Mesh { return get<Mesh>(AssetId::SkyboxMesh); }
+    auto skybox_meshlets() const -> Meshlets { return get<Meshlets>(AssetId::SkyboxMeshlets); }
+    auto sphere_mesh() const -> Mesh { return get<Mesh>(AssetId::SphereMesh); }
+    auto sphere_meshlets() const -> Meshlets { return get<Meshlets>(AssetId::SphereMeshlets); }
+    auto winter_evening_lut() const -> Texture { return get<Texture>(AssetId::WinterEveningLut); }
+    auto winter_evening_irr() const -> CubeTexture {
+        return get<CubeTexture>(AssetId::WinterEveningIrr);
     }
+    auto winter_evening_rad() const -> CubeTexture {
+        return get<CubeTexture>(AssetId::WinterEveningRad);
+    }
+    auto shanghai_bund_lut() const -> Texture { return get<Texture>(AssetId::ShanghaiBundLut); }
+    auto shanghai_bund_irr() const -> CubeTexture {
+        return get<CubeTexture>(AssetId::ShanghaiBundIrr);
+    }
+    auto shanghai_bund_rad() const -> CubeTexture {
+        return get<CubeTexture>(AssetId::ShanghaiBundRad);
+    }
+    auto industrial_sunset_02_puresky_irr() const -> CubeTexture {
+        return get<CubeTexture>(AssetId::IndustrialSunset02PureskyIrr);
+    }
+    auto roboto_medium_font() const -> Font { return get<Font>(AssetId::RobotoMediumFont); }
+    auto roboto_medium_mesh() const -> Mesh { return get<Mesh>(AssetId::RobotoMediumMesh); }
+    auto roboto_medium_meshlets() const -> Meshlets {
+        return get<Meshlets>(AssetId::RobotoMediumMeshlets);
+    }
+    auto lightsaber_mesh() const -> Mesh { return get<Mesh>(AssetId::LightsaberMesh); }
+    auto lightsaber_meshlets() const -> Meshlets {
+        return get<Meshlets>(AssetId::LightsaberMeshlets);
+    }
+    auto lightsaber_base_color_texture() const -> Texture {
+        return get<Texture>(AssetId::LightsaberBaseColorTexture);
+    }
+    auto lightsaber_material() const -> Material {
+        return get<Material>(AssetId::LightsaberMaterial);
+    }
+    auto grass_mesh() const -> Mesh { return get<Mesh>(AssetId::GrassMesh); }
+    auto grass_meshlets() const -> Meshlets { return get<Meshlets>(AssetId::GrassMeshlets); }
+    auto grass_base_color_texture() const -> Texture {
+        return get<Texture>(AssetId::GrassBaseColorTexture);
+    }
+    auto grass_material() const -> Material { return get<Material>(AssetId::GrassMaterial); }
+
+private:
+    AssetsFile _file;
+};
 
-    FileBuffer _file;
+enum class ShaderId : uint {
+    CardsBackgroundVs,
+    CardsBackgroundPs,
+    CardsDrawVs,
+    CardsDrawPs,
+    ConrasClearVs,
+    ConrasClearPs,
+    ConrasRasterVs,
+    ConrasRasterCrOffPs,
+    ConrasRasterCrOnPs,
+    ConrasDisplayVs,
+    ConrasDisplayPs,
+    CrateDrawVs,
+    CrateDrawPs,
+    TreeShadowVs,
+    TreeDrawVs,
+    TreeDrawPs,
+    RainSimCs,
+    RainDrawVs,
+    RainDrawPs,
+    AnimShadowVs,
+    AnimGroundVs,
+    AnimGroundPs,
+    AnimAnimVs,
+    AnimAnimPs,
+    FibersSimCs,
+    FibersResetCs,
+    FibersCullCs,
+    FibersLightVs,
+    FibersLightPs,
+    FibersPlaneVs,
+    FibersPlanePs,
+    FibersDebugVs,
+    FibersDebugPs,
+    EnvBackgroundVs,
+    EnvBackgroundPs,
+    EnvModelVs,
+    EnvModelPs,
+    TextBackgroundVs,
+    TextBackgroundPs,
+    TextGlyphVs,
+    TextGlyphPs,
+    SaberSceneVs,
+    SaberScenePs,
+    SaberThresholdCs,
+    SaberDownsampleCs,
+    SaberUpsampleCs,
+    SaberBlitVs,
+    SaberBlitPs,
+    GrassDrawVs,
+    GrassDrawNaivePs,
+    GrassDrawAtocPs,
 };
 
+inline constexpr uint SHADER_COUNT = 51;
+
 class Shaders {
 public:
     auto load() -> void;
 
-    auto cards_background_vs() const -> Span<const std::byte>;
-    auto cards_background_ps() const -> Span<const std::byte>;
-    auto cards_draw_vs() const -> Span<const std::byte>;
-    auto cards_draw_ps() const -> Span<const std::byte>;
-    auto conras_clear_vs() const -> Span<const std::byte>;
-    auto conras_clear_ps() const -> Span<const std::byte>;
-    auto conras_raster_vs() const -> Span<const std::byte>;
-    auto conras_raster_cr_off_ps() const -> Span<const std::byte>;
-    auto conras_raster_cr_on_ps() const -> Span<const std::byte>;
-    auto conras_display_vs() const -> Span<const std::byte>;
-    auto conras_display_ps() const -> Span<const std::byte>;
-    auto crate_draw_vs() const -> Span<const std::byte>;
-    auto crate_draw_ps() const -> Span<const std::byte>;
-    auto tree_shadow_vs() const -> Span<const std::byte>;
-    auto tree_draw_vs() const -> Span<const std::byte>;
-    auto tree_draw_ps() const -> Span<const std::byte>;
-    auto rain_sim_cs() const -> Span<const std::byte>;
-    auto rain_draw_vs() const -> Span<const std::byte>;
-    auto rain_draw_ps() const -> Span<const std::byte>;
-    auto anim_shadow_vs() const -> Span<const std::byte>;
-    auto anim_ground_vs() const -> Span<const std::byte>;
-    auto anim_ground_ps() const -> Span<const std::byte>;
-    auto anim_anim_vs() const -> Span<const std::byte>;
-    auto anim_anim_ps() const -> Span<const std::byte>;
-    auto fibers_sim_cs() const -> Span<const std::byte>;
-    auto fibers_reset_cs() const -> Span<const std::byte>;
-    auto fibers_cull_cs() const -> Span<const std::byte>;
-    auto fibers_light_vs() const -> Span<const std::byte>;
-    auto fibers_light_ps() const -> Span<const std::byte>;
-    auto fibers_plane_vs() const -> Span<const std::byte>;
-    auto fibers_plane_ps() const -> Span<const std::byte>;
-    auto fibers_debug_vs() const -> Span<const std::byte>;
-    auto fibers_debug_ps() const -> Span<const std::byte>;
-    auto env_background_vs() const -> Span<const std::byte>;
-    auto env_background_ps() const -> Span<const std::byte>;
-    auto env_model_vs() const -> Span<const std::byte>;
-    auto env_model_ps() const -> Span<const std::byte>;
-    auto text_background_vs() const -> Span<const std::byte>;
-    auto text_background_ps() const -> Span<const std::byte>;
-    auto text_glyph_vs() const -> Span<const std::byte>;
-    auto text_glyph_ps() const -> Span<const std::byte>;
-    auto saber_scene_vs() const -> Span<const std::byte>;
-    auto saber_scene_ps() const -> Span<const std::byte>;
-    auto saber_threshold_cs() const -> Span<const std::byte>;
-    auto saber_downsample_cs() const -> Span<const std::byte>;
-    auto saber_upsample_cs() const -> Span<const std::byte>;
-    auto saber_blit_vs() const -> Span<const std::byte>;
-    auto saber_blit_ps() const -> Span<const std::byte>;
-    auto grass_draw_vs() const -> Span<const std::byte>;
-    auto grass_draw_naive_ps() const -> Span<const std::byte>;
-    auto grass_draw_atoc_ps() const -> Span<const std::byte>;
+    // Swaps in the bin published by a watching baker, like `Assets::reload`.
+    auto reload() -> Option<std::vector<ShaderId>>;
+
+    auto get(ShaderId id) const -> Span<const std::byte> { return _file.get((uint)id); }
+
+    auto cards_background_vs() const -> Span<const std::byte> {
+        return get(ShaderId::CardsBackgroundVs);
+    }
+    auto cards_background_ps() const -> Span<const std::byte> {
+        return get(ShaderId::CardsBackgroundPs);
+    }
+    auto cards_draw_vs() const -> Span<const std::byte> { return get(ShaderId::CardsDrawVs); }
+    auto cards_draw_ps() const -> Span<const std::byte> { return get(ShaderId::CardsDrawPs); }
+    auto conras_clear_vs() const -> Span<const std::byte> { return get(ShaderId::ConrasClearVs); }
+    auto conras_clear_ps() const -> Span<const std::byte> { return get(ShaderId::ConrasClearPs); }
+    auto conras_raster_vs() const -> Span<const std::byte> { return get(ShaderId::ConrasRasterVs); }
+    auto conras_raster_cr_off_ps() const -> Span<const std::byte> {
+        return get(ShaderId::ConrasRasterCrOffPs);
+    }
+    auto conras_raster_cr_on_ps() const -> Span<const std::byte> {
+        return get(ShaderId::ConrasRasterCrOnPs);
+    }
+    auto conras_display_vs() const -> Span<const std::byte> {
+        return get(ShaderId::ConrasDisplayVs);
+    }
+    auto conras_display_ps() const -> Span<const std::byte> {
+        return get(ShaderId::ConrasDisplayPs);
+    }
+    auto crate_draw_vs() const -> Span<const std::byte> { return get(ShaderId::CrateDrawVs); }
+    auto crate_draw_ps() const -> Span<const std::byte> { return get(ShaderId::CrateDrawPs); }
+    auto tree_shadow_vs() const -> Span<const std::byte> { return get(ShaderId::TreeShadowVs); }
+    auto tree_draw_vs() const -> Span<const std::byte> { return get(ShaderId::TreeDrawVs); }
+    auto tree_draw_ps() const -> Span<const std::byte> { return get(ShaderId::TreeDrawPs); }
+    auto rain_sim_cs() const -> Span<const std::byte> { return get(ShaderId::RainSimCs); }
+    auto rain_draw_vs() const -> Span<const std::byte> { return get(ShaderId::RainDrawVs); }
+    auto rain_draw_ps() const -> Span<const std::byte> { return get(ShaderId::RainDrawPs); }
+    auto anim_shadow_vs() const -> Span<const std::byte> { return get(ShaderId::AnimShadowVs); }
+    auto anim_ground_vs() const -> Span<const std::byte> { return get(ShaderId::AnimGroundVs); }
+    auto anim_ground_ps() const -> Span<const std::byte> { return get(ShaderId::AnimGroundPs); }
+    auto anim_anim_vs() const -> Span<const std::byte> { return get(ShaderId::AnimAnimVs); }
+    auto anim_anim_ps() const -> Span<const std::byte> { return get(ShaderId::AnimAnimPs); }
+    auto fibers_sim_cs() const -> Span<const std::byte> { return get(ShaderId::FibersSimCs); }
+    auto fibers_reset_cs() const -> Span<const std::byte> { return get(ShaderId::FibersResetCs); }
+    auto fibers_cull_cs() const -> Span<const std::byte> { return get(ShaderId::FibersCullCs); }
+    auto fibers_light_vs() const -> Span<const std::byte> { return get(ShaderId::FibersLightVs); }
+    auto fibers_light_ps() const -> Span<const std::byte> { return get(ShaderId::FibersLightPs); }
+    auto fibers_plane_vs() const -> Span<const std::byte> { return get(ShaderId::FibersPlaneVs); }
+    auto fibers_plane_ps() const -> Span<const std::byte> { return get(ShaderId::FibersPlanePs); }
+    auto fibers_debug_vs() const -> Span<const std::byte> { return get(ShaderId::FibersDebugVs); }
+    auto fibers_debug_ps() const -> Span<const std::byte> { return get(ShaderId::FibersDebugPs); }
+    auto env_background_vs() const -> Span<const std::byte> {
+        return get(ShaderId::EnvBackgroundVs);
+    }
+    auto env_background_ps() const -> Span<const std::byte> {
+        return get(ShaderId::EnvBackgroundPs);
+    }
+    auto env_model_vs() const -> Span<const std::byte> { return get(ShaderId::EnvModelVs); }
+    auto env_model_ps() const -> Span<const std::byte> { return get(ShaderId::EnvModelPs); }
+    auto text_background_vs() const -> Span<const std::byte> {
+        return get(ShaderId::TextBackgroundVs);
+    }
+    auto text_background_ps() const -> Span<const std::byte> {
+        return get(ShaderId::TextBackgroundPs);
+    }
+    auto text_glyph_vs() const -> Span<const std::byte> { return get(ShaderId::TextGlyphVs); }
+    auto text_glyph_ps() const -> Span<const std::byte> { return get(ShaderId::TextGlyphPs); }
+    auto saber_scene_vs() const -> Span<const std::byte> { return get(ShaderId::SaberSceneVs); }
+    auto saber_scene_ps() const -> Span<const std::byte> { return get(ShaderId::SaberScenePs); }
+    auto saber_threshold_cs() const -> Span<const std::byte> {
+        return get(ShaderId::SaberThresholdCs);
+    }
+    auto saber_downsample_cs() const -> Span<const std::byte> {
+        return get(ShaderId::SaberDownsampleCs);
+    }
+    auto saber_upsample_cs() const -> Span<const std::byte> {
+        return get(ShaderId::SaberUpsampleCs);
+    }
+    auto saber_blit_vs() const -> Span<const std::byte> { return get(ShaderId::SaberBlitVs); }
+    auto saber_blit_ps() const -> Span<const std::byte> { return get(ShaderId::SaberBlitPs); }
+    auto grass_draw_vs() const -> Span<const std::byte> { return get(ShaderId::GrassDrawVs); }
+    auto grass_draw_naive_ps() const -> Span<const std::byte> {
+        return get(ShaderId::GrassDrawNaivePs);
+    }
+    auto grass_draw_atoc_ps() const -> Span<const std::byte> {
+        return get(ShaderId::GrassDrawAtocPs);
+    }
 
 private:
-    FileBuffer _file;
+    ShadersFile _file;
 };
 
 } // namespace fb::baked::buffet
@@ -2,458 +2,40 @@
 
 namespace fb::baked::griddle {
 
-#define texture_data(rp, sp, off, sz)                                                   \
-    TextureData {                                                                       \
-        .row_pitch = rp, .slice_pitch = sp, .data = transmuted_span<std::byte>(off, sz) \
-    }
-
 auto Assets::load() -> void {
-    // hash: 99aa06d3014798d86001c324468d497f
     FB_PERF_FUNC();
-    _file = FileBuffer::from_path("fb_griddle_assets.bin");
-    FB_ASSERT(_file.byte_count() == 0);
+    _file.load("fb_griddle_assets.bin", ASSET_COUNT);
 }
 
-auto Shaders::load() -> void {
-    // hash: 427fa0605bcbeda9ede702fe091204b7
+auto Assets::reload() -> Option<std::vector<AssetId>> {
     FB_PERF_FUNC();
-    _file = FileBuffer::from_path("fb_griddle_shaders.bin");
-    FB_ASSERT(_file.byte_count() == 8940);
-}
-
-// shader_hash: 75e50b1298a142b9447a9479a35ac223
-// constant_buffers: 1
-// bound_resources: 1
-// input_parameters: 2
-// output_parameters: 2
-// instruction_count: 50
-// float_instruction_count: 8
-// texture_load_instructions: 2
-/* disassembly:
-;
-; Note: shader requires additional functionality:
-;       Resource descriptor heap indexing
-;
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_VertexID              0   x           0   VERTID    uint   x   
-; SV_InstanceID            0   x           1   INSTID    uint       
-;
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Position              0   xyzw        0      POS   float   xyzw
-; ATTRIBUTE                0   xy          1     NONE   float   xy  
-;
-; shader debug name: 75e50b1298a142b9447a9479a35ac223.pdb
-; shader hash: 75e50b1298a142b9447a9479a35ac223
-;
-; Pipeline Runtime Information: 
-;
-;PSVRuntimeInfo:
-; Vertex Shader
-; OutputPositionPresent=1
-; MinimumExpectedWaveLaneCount: 0
-; MaximumExpectedWaveLaneCount: 4294967295
-; UsesViewID: false
-; SigInputElements: 2
-; SigOutputElements: 2
-; SigPatchConstOrPrimElements: 0
-; SigInputVectors: 2
-; SigOutputVectors[0]: 2
-; SigOutputVectors[1]: 0
-; SigOutputVectors[2]: 0
-; SigOutputVectors[3]: 0
-; EntryFunctionName: vs
-;
-;
-; Input signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_VertexID              0                              
-; SV_InstanceID            0                              
-;
-; Output signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Position              0          noperspective       
-; ATTRIBUTE                0                 linear       
-;
-; Buffer Definitions:
-;
-; cbuffer g_bindings
-; {
-;
-;   struct g_bindings
-;   {
-;
-;       struct struct.Bindings
-;       {
-;
-;           uint constants;                           ; Offset:    0
-;           uint vertices;                            ; Offset:    4
-;           uint texture;                             ; Offset:    8
-;           uint sampler;                             ; Offset:   12
-;       
-;       } g_bindings;                                 ; Offset:    0
-;
-;   
-;   } g_bindings;                                     ; Offset:    0 Size:    16
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; g_bindings                        cbuffer      NA          NA     CB0            cb0     1
-;
-;
-; ViewId state:
-;
-; Number of inputs: 5, outputs: 6
-; Outputs dependent on ViewId: {  }
-; Inputs contributing to computation of Outputs:
-;   output 0 depends on inputs: { 0 }
-;   output 1 depends on inputs: { 0 }
-;   output 2 depends on inputs: { 0 }
-;   output 3 depends on inputs: { 0 }
-;   output 4 depends on inputs: { 0 }
-;   output 5 depends on inputs: { 0 }
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:8-i16:16-i32:32-i64:64-f16:16-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.ResBind = type { i32, i32, i32, i8 }
-%dx.types.ResourceProperties = type { i32, i32 }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%g_bindings = type { %struct.Bindings }
-%struct.Bindings = type { i32, i32, i32, i32 }
-
-define void @vs() {
-  %1 = call %dx.types.Handle @dx.op.createHandleFromBinding(i32 217, %dx.types.ResBind { i32 0, i32 0, i32 0, i8 2 }, i32 0, i1 false)  ; CreateHandleFromBinding(bind,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.annotateHandle(i32 216, %dx.types.Handle %1, %dx.types.ResourceProperties { i32 13, i32 16 })  ; AnnotateHandle(res,props)  resource: CBuffer
-  %3 = call i32 @dx.op.loadInput.i32(i32 4, i32 0, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %4 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %2, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %5 = extractvalue %dx.types.CBufRet.i32 %4, 0
-  %6 = call %dx.types.Handle @dx.op.createHandleFromHeap(i32 218, i32 %5, i1 false, i1 false)  ; CreateHandleFromHeap(index,samplerHeap,nonUniformIndex)
-  %7 = call %dx.types.Handle @dx.op.annotateHandle(i32 216, %dx.types.Handle %6, %dx.types.ResourceProperties { i32 13, i32 820 })  ; AnnotateHandle(res,props)  resource: CBuffer
-  %8 = extractvalue %dx.types.CBufRet.i32 %4, 1
-  %9 = call %dx.types.Handle @dx.op.createHandleFromHeap(i32 218, i32 %8, i1 false, i1 false)  ; CreateHandleFromHeap(index,samplerHeap,nonUniformIndex)
-  %10 = call %dx.types.Handle @dx.op.annotateHandle(i32 216, %dx.types.Handle %9, %dx.types.ResourceProperties { i32 524, i32 16 })  ; AnnotateHandle(res,props)  resource: StructuredBuffer<stride=16>
-  %11 = call %dx.types.ResRet.f32 @dx.op.rawBufferLoad.f32(i32 139, %dx.types.Handle %10, i32 %3, i32 0, i8 3, i32 4)  ; RawBufferLoad(srv,index,elementOffset,mask,alignment)
-  %12 = extractvalue %dx.types.ResRet.f32 %11, 0
-  %13 = extractvalue %dx.types.ResRet.f32 %11, 1
-  %14 = call %dx.types.ResRet.f32 @dx.op.rawBufferLoad.f32(i32 139, %dx.types.Handle %10, i32 %3, i32 8, i8 3, i32 4)  ; RawBufferLoad(srv,index,elementOffset,mask,alignment)
-  %15 = extractvalue %dx.types.ResRet.f32 %14, 0
-  %16 = extractvalue %dx.types.ResRet.f32 %14, 1
-  %17 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %7, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %18 = extractvalue %dx.types.CBufRet.f32 %17, 0
-  %19 = extractvalue %dx.types.CBufRet.f32 %17, 1
-  %20 = extractvalue %dx.types.CBufRet.f32 %17, 2
-  %21 = extractvalue %dx.types.CBufRet.f32 %17, 3
-  %22 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %7, i32 1)  ; CBufferLoadLegacy(handle,regIndex)
-  %23 = extractvalue %dx.types.CBufRet.f32 %22, 0
-  %24 = extractvalue %dx.types.CBufRet.f32 %22, 1
-  %25 = extractvalue %dx.types.CBufRet.f32 %22, 2
-  %26 = extractvalue %dx.types.CBufRet.f32 %22, 3
-  %27 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %7, i32 3)  ; CBufferLoadLegacy(handle,regIndex)
-  %28 = extractvalue %dx.types.CBufRet.f32 %27, 0
-  %29 = extractvalue %dx.types.CBufRet.f32 %27, 1
-  %30 = extractvalue %dx.types.CBufRet.f32 %27, 2
-  %31 = extractvalue %dx.types.CBufRet.f32 %27, 3
-  %32 = fmul fast float %18, %12
-  %33 = call float @dx.op.tertiary.f32(i32 46, float %23, float %13, float %32)  ; FMad(a,b,c)
-  %34 = fadd fast float %28, %33
-  %35 = fmul fast float %19, %12
-  %36 = call float @dx.op.tertiary.f32(i32 46, float %24, float %13, float %35)  ; FMad(a,b,c)
-  %37 = fadd fast float %36, %29
-  %38 = fmul fast float %20, %12
-  %39 = call float @dx.op.tertiary.f32(i32 46, float %25, float %13, float %38)  ; FMad(a,b,c)
-  %40 = fadd fast float %39, %30
-  %41 = fmul fast float %21, %12
-  %42 = call float @dx.op.tertiary.f32(i32 46, float %26, float %13, float %41)  ; FMad(a,b,c)
-  %43 = fadd fast float %42, %31
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 0, float %34)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 1, float %37)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 2, float %40)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 3, float %43)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 0, float %15)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 1, float %16)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare i32 @dx.op.loadInput.i32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.f32(i32, i32, i32, i8, float) #1
-
-; Function Attrs: nounwind readnone
-declare %dx.types.Handle @dx.op.createHandleFromHeap(i32, i32, i1, i1) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.rawBufferLoad.f32(i32, %dx.types.Handle, i32, i32, i8, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readnone
-declare %dx.types.Handle @dx.op.annotateHandle(i32, %dx.types.Handle, %dx.types.ResourceProperties) #0
-
-; Function Attrs: nounwind readnone
-declare %dx.types.Handle @dx.op.createHandleFromBinding(i32, %dx.types.ResBind, i32, i1) #0
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind }
-attributes #2 = { nounwind readonly }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.viewIdState = !{!7}
-!dx.entryPoints = !{!8}
-
-!0 = !{!"dxcoob 1.8.2505.28 (9efbb6c32)"}
-!1 = !{i32 1, i32 8}
-!2 = !{i32 1, i32 9}
-!3 = !{!"vs", i32 6, i32 8}
-!4 = !{null, null, !5, null}
-!5 = !{!6}
-!6 = !{i32 0, %g_bindings* undef, !"", i32 0, i32 0, i32 1, i32 16, null}
-!7 = !{[7 x i32] [i32 5, i32 6, i32 63, i32 0, i32 0, i32 0, i32 0]}
-!8 = !{void ()* @vs, !"vs", !9, !4, !20}
-!9 = !{!10, !15, null}
-!10 = !{!11, !14}
-!11 = !{i32 0, !"SV_VertexID", i8 5, i8 1, !12, i8 0, i32 1, i8 1, i32 0, i8 0, !13}
-!12 = !{i32 0}
-!13 = !{i32 3, i32 1}
-!14 = !{i32 1, !"SV_InstanceID", i8 5, i8 2, !12, i8 0, i32 1, i8 1, i32 1, i8 0, null}
-!15 = !{!16, !18}
-!16 = !{i32 0, !"SV_Position", i8 9, i8 3, !12, i8 4, i32 1, i8 4, i32 0, i8 0, !17}
-!17 = !{i32 3, i32 15}
-!18 = !{i32 1, !"ATTRIBUTE", i8 9, i8 0, !12, i8 2, i32 1, i8 2, i32 1, i8 0, !19}
-!19 = !{i32 3, i32 3}
-!20 = !{i32 0, i64 1082130688}
-*/
-auto Shaders::griddle_vs() const -> Span<const std::byte> {
-    return _file.as_span().subspan(0, 4740);
+    const auto changed_ids = _file.reload("fb_griddle_assets.bin");
+    if (!changed_ids.has_value()) {
+        return std::nullopt;
+    }
+    auto ids = std::vector<AssetId>();
+    for (const auto id : changed_ids.value()) {
+        ids.push_back((AssetId)id);
+    }
+    return ids;
 }
 
-// shader_hash: d0ef76026eb0143c831f968ba60f9bcc
-// constant_buffers: 1
-// bound_resources: 1
-// input_parameters: 2
-// output_parameters: 1
-// instruction_count: 20
-// texture_normal_instructions: 1
-/* disassembly:
-;
-; Note: shader requires additional functionality:
-;       Resource descriptor heap indexing
-;       Sampler descriptor heap indexing
-;
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Position              0   xyzw        0      POS   float       
-; ATTRIBUTE                0   xy          1     NONE   float   xy  
-;
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Target                0   xyzw        0   TARGET   float   xyzw
-;
-; shader debug name: d0ef76026eb0143c831f968ba60f9bcc.pdb
-; shader hash: d0ef76026eb0143c831f968ba60f9bcc
-;
-; Pipeline Runtime Information: 
-;
-;PSVRuntimeInfo:
-; Pixel Shader
-; DepthOutput=0
-; SampleFrequency=0
-; MinimumExpectedWaveLaneCount: 0
-; MaximumExpectedWaveLaneCount: 4294967295
-; UsesViewID: false
-; SigInputElements: 2
-; SigOutputElements: 1
-; SigPatchConstOrPrimElements: 0
-; SigInputVectors: 2
-; SigOutputVectors[0]: 1
-; SigOutputVectors[1]: 0
-; SigOutputVectors[2]: 0
-; SigOutputVectors[3]: 0
-; EntryFunctionName: ps
-;
-;
-; Input signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Position              0          noperspective       
-; ATTRIBUTE                0                 linear       
-;
-; Output signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Target                0                              
-;
-; Buffer Definitions:
-;
-; cbuffer g_bindings
-; {
-;
-;   struct g_bindings
-;   {
-;
-;       struct struct.Bindings
-;       {
-;
-;           uint constants;                           ; Offset:    0
-;           uint vertices;                            ; Offset:    4
-;           uint texture;                             ; Offset:    8
-;           uint sampler;                             ; Offset:   12
-;       
-;       } g_bindings;                                 ; Offset:    0
-;
-;   
-;   } g_bindings;                                     ; Offset:    0 Size:    16
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; g_bindings                        cbuffer      NA          NA     CB0            cb0     1
-;
-;
-; ViewId state:
-;
-; Number of inputs: 6, outputs: 4
-; Outputs dependent on ViewId: {  }
-; Inputs contributing to computation of Outputs:
-;   output 0 depends on inputs: { 4, 5 }
-;   output 1 depends on inputs: { 4, 5 }
-;   output 2 depends on inputs: { 4, 5 }
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:8-i16:16-i32:32-i64:64-f16:16-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.ResBind = type { i32, i32, i32, i8 }
-%dx.types.ResourceProperties = type { i32, i32 }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%g_bindings = type { %struct.Bindings }
-%struct.Bindings = type { i32, i32, i32, i32 }
-
-define void @ps() {
-  %1 = call %dx.types.Handle @dx.op.createHandleFromBinding(i32 217, %dx.types.ResBind { i32 0, i32 0, i32 0, i8 2 }, i32 0, i1 false)  ; CreateHandleFromBinding(bind,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.annotateHandle(i32 216, %dx.types.Handle %1, %dx.types.ResourceProperties { i32 13, i32 16 })  ; AnnotateHandle(res,props)  resource: CBuffer
-  %3 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %4 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %5 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %2, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %6 = extractvalue %dx.types.CBufRet.i32 %5, 2
-  %7 = call %dx.types.Handle @dx.op.createHandleFromHeap(i32 218, i32 %6, i1 false, i1 false)  ; CreateHandleFromHeap(index,samplerHeap,nonUniformIndex)
-  %8 = call %dx.types.Handle @dx.op.annotateHandle(i32 216, %dx.types.Handle %7, %dx.types.ResourceProperties { i32 2, i32 1033 })  ; AnnotateHandle(res,props)  resource: Texture2D<4xF32>
-  %9 = extractvalue %dx.types.CBufRet.i32 %5, 3
-  %10 = call %dx.types.Handle @dx.op.createHandleFromHeap(i32 218, i32 %9, i1 true, i1 false)  ; CreateHandleFromHeap(index,samplerHeap,nonUniformIndex)
-  %11 = call %dx.types.Handle @dx.op.annotateHandle(i32 216, %dx.types.Handle %10, %dx.types.ResourceProperties { i32 14, i32 0 })  ; AnnotateHandle(res,props)  resource: SamplerState
-  %12 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %8, %dx.types.Handle %11, float %3, float %4, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %13 = extractvalue %dx.types.ResRet.f32 %12, 0
-  %14 = extractvalue %dx.types.ResRet.f32 %12, 1
-  %15 = extractvalue %dx.types.ResRet.f32 %12, 2
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 0, float %13)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 1, float %14)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 2, float %15)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 3, float 1.000000e+00)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  ret void
+auto Shaders::load() -> void {
+    FB_PERF_FUNC();
+    _file.load("fb_griddle_shaders.bin", SHADER_COUNT);
 }
 
-; Function Attrs: nounwind readnone
-declare float @dx.op.loadInput.f32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.f32(i32, i32, i32, i8, float) #1
-
-; Function Attrs: nounwind readnone
-declare %dx.types.Handle @dx.op.createHandleFromHeap(i32, i32, i1, i1) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.sample.f32(i32, %dx.types.Handle, %dx.types.Handle, float, float, float, float, i32, i32, i32, float) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readnone
-declare %dx.types.Handle @dx.op.annotateHandle(i32, %dx.types.Handle, %dx.types.ResourceProperties) #0
-
-; Function Attrs: nounwind readnone
-declare %dx.types.Handle @dx.op.createHandleFromBinding(i32, %dx.types.ResBind, i32, i1) #0
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind }
-attributes #2 = { nounwind readonly }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.viewIdState = !{!7}
-!dx.entryPoints = !{!8}
-
-!0 = !{!"dxcoob 1.8.2505.28 (9efbb6c32)"}
-!1 = !{i32 1, i32 8}
-!2 = !{i32 1, i32 9}
-!3 = !{!"ps", i32 6, i32 8}
-!4 = !{null, null, !5, null}
-!5 = !{!6}
-!6 = !{i32 0, %g_bindings* undef, !"", i32 0, i32 0, i32 1, i32 16, null}
-!7 = !{[8 x i32] [i32 6, i32 4, i32 0, i32 0, i32 0, i32 0, i32 7, i32 7]}
-!8 = !{void ()* @ps, !"ps", !9, !4, !18}
-!9 = !{!10, !15, null}
-!10 = !{!11, !13}
-!11 = !{i32 0, !"SV_Position", i8 9, i8 3, !12, i8 4, i32 1, i8 4, i32 0, i8 0, null}
-!12 = !{i32 0}
-!13 = !{i32 1, !"ATTRIBUTE", i8 9, i8 0, !12, i8 2, i32 1, i8 2, i32 1, i8 0, !14}
-!14 = !{i32 3, i32 3}
-!15 = !{!16}
-!16 = !{i32 0, !"SV_Target", i8 9, i8 16, !12, i8 0, i32 1, i8 4, i32 0, i8 0, !17}
-!17 = !{i32 3, i32 15}
-!18 = !{i32 0, i64 3229614336}
-*/
-auto Shaders::griddle_ps() const -> Span<const std::byte> {
-    return _file.as_span().subspan(4740, 4200);
+auto Shaders::reload() -> Option<std::vector<ShaderId>> {
+    FB_PERF_FUNC();
+    const auto changed_ids = _file.reload("fb_griddle_shaders.bin");
+    if (!changed_ids.has_value()) {
+        return std::nullopt;
+    }
+    auto ids = std::vector<ShaderId>();
+    for (const auto id : changed_ids.value()) {
+        ids.push_back((ShaderId)id);
+    }
+    return ids;
 }
 
-#undef texture_data
-
 } // namespace fb::baked::griddle
@@ -4,28 +4,48 @@
 
 namespace fb::baked::griddle {
 
+enum class AssetId : uint {};
+
+inline constexpr uint ASSET_COUNT = 0;
+
 class Assets {
 public:
     auto load() -> void;
 
-private:
+    // Swaps in the bin published by a watching baker, and returns the assets
+    // whose contents changed. The whole bin is replaced, so every asset got
+    // earlier is invalidated, and nothing built from them is rebuilt. None if
+    // the assets themselves changed, which takes a rebuild.
+    auto reload() -> Option<std::vector<AssetId>>;
+
     template<typename T>
-    auto transmuted_span(size_t offset, size_t element_count) const -> Span<const T> {
-        return Span<const T>((const T*)(_file.bytes() + offset), element_count);
-    }
+    auto get(AssetId id) const -> T { return _file.get<T>((uint)id); }
+
+private:
+    AssetsFile _file;
+};
 
-    FileBuffer _file;
+enum class ShaderId : uint {
+    GriddleVs,
+    GriddlePs,
 };
 
+inline constexpr uint SHADER_COUNT = 2;
+
 class Shaders {
 public:
     auto load() -> void;
 
-    auto griddle_vs() const -> Span<const std::byte>;
-    auto griddle_ps() const -> Span<const std::byte>;
+    // Swaps in the bin published by a watching baker, like `Assets::reload`.
+    auto reload() -> Option<std::vector<ShaderId>>;
+
+    auto get(ShaderId id) const -> Span<const std::byte> { return _file.get((uint)id); }
+
+    auto griddle_vs() const -> Span<const std::byte> { return get(ShaderId::GriddleVs); }
+    auto griddle_ps() const -> Span<const std::byte> { return get(ShaderId::GriddlePs); }
 
 private:
-    FileBuffer _file;
+    ShadersFile _file;
 };
 
 } // namespace fb::baked::griddle
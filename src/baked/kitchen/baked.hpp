@@ -4,33 +4,64 @@
 
 namespace fb::baked::kitchen {
 
+enum class AssetId : uint {
+    ImguiFont,
+};
+
+inline constexpr uint ASSET_COUNT = 1;
+
 class Assets {
 public:
     auto load() -> void;
 
-    auto imgui_font() const -> Copy;
+    // Swaps in the bin published by a watching baker, and returns the assets
+    // whose contents changed. The whole bin is replaced, so every asset got
+    // earlier is invalidated, and nothing built from them is rebuilt. None if
+    // the assets themselves changed, which takes a rebuild.
+    auto reload() -> Option<std::vector<AssetId>>;
 
-private:
     template<typename T>
-    auto transmuted_span(size_t offset, size_t element_count) const -> Span<const T> {
-        return Span<const T>((const T*)(_file.bytes() + offset), element_count);
-    }
+    auto get(AssetId id) const -> T { return _file.get<T>((uint)id); }
+
+    auto imgui_font() const -> Copy { return get<Copy>(AssetId::ImguiFont); }
 
-    FileBuffer _file;
+private:
+    AssetsFile _file;
 };
 
+enum class ShaderId : uint {
+    GuiDrawVs,
+    GuiDrawPs,
+    DebugDrawDrawVs,
+    DebugDrawDrawPs,
+    SpdDownsampleCs,
+};
+
+inline constexpr uint SHADER_COUNT = 5;
+
 class Shaders {
 public:
     auto load() -> void;
 
-    auto gui_draw_vs() const -> Span<const std::byte>;
-    auto gui_draw_ps() const -> Span<const std::byte>;
-    auto debug_draw_draw_vs() const -> Span<const std::byte>;
-    auto debug_draw_draw_ps() const -> Span<const std::byte>;
-    auto spd_downsample_cs() const -> Span<const std::byte>;
+    // Swaps in the bin published by a watching baker, like `Assets::reload`.
+    auto reload() -> Option<std::vector<ShaderId>>;
+
+    auto get(ShaderId id) const -> Span<const std::byte> { return _file.get((uint)id); }
+
+    auto gui_draw_vs() const -> Span<const std::byte> { return get(ShaderId::GuiDrawVs); }
+    auto gui_draw_ps() const -> Span<const std::byte> { return get(ShaderId::GuiDrawPs); }
+    auto debug_draw_draw_vs() const -> Span<const std::byte> {
+        return get(ShaderId::DebugDrawDrawVs);
+    }
+    auto debug_draw_draw_ps() const -> Span<const std::byte> {
+        return get(ShaderId::DebugDrawDrawPs);
+    }
+    auto spd_downsample_cs() const -> Span<const std::byte> {
+        return get(ShaderId::SpdDownsampleCs);
+    }
 
 private:
-    FileBuffer _file;
+    ShadersFile _file;
 };
 
 } // namespace fb::baked::kitchen
@@ -4,33 +4,72 @@
 
 namespace fb::baked::raydiance {
 
+enum class AssetId : uint {
+    CubeMesh,
+    CubeMeshlets,
+    SphereMesh,
+    SphereMeshlets,
+    RoundedCubeMesh,
+    RoundedCubeMeshlets,
+    RoundedCubeBaseColorTexture,
+    RoundedCubeMaterial,
+    PlaneMesh,
+    PlaneMeshlets,
+    PlaneTexture,
+};
+
+inline constexpr uint ASSET_COUNT = 11;
+
 class Assets {
 public:
     auto load() -> void;
 
-    auto cube_mesh() const -> Mesh;
-    auto sphere_mesh() const -> Mesh;
-    auto rounded_cube_mesh() const -> Mesh;
-    auto rounded_cube_base_color_texture() const -> Texture;
-    auto rounded_cube_material() const -> Material;
-    auto plane_mesh() const -> Mesh;
-    auto plane_texture() const -> Texture;
+    // Swaps in the bin published by a watching baker, and returns the assets
+    // whose contents changed. The whole bin is replaced, so every asset got
+    // earlier is invalidated, and nothing built from them is rebuilt. None if
+    // the assets themselves changed, which takes a rebuild.
+    auto reload() -> Option<std::vector<AssetId>>;
 
-private:
     template<typename T>
-    auto transmuted_span(size_t offset, size_t element_count) const -> Span<const T> {
-        return Span<const T>((const T*)(_file.bytes() + offset), element_count);
+    auto get(AssetId id) const -> T { return _file.get<T>((uint)id); }
+
+    auto cube_mesh() const -> Mesh { return get<Mesh>(AssetId::CubeMesh); }
+    auto cube_meshlets() const -> Meshlets { return get<Meshlets>(AssetId::CubeMeshlets); }
+    auto sphere_mesh() const -> Mesh { return get<Mesh>(AssetId::SphereMesh); }
+    auto sphere_meshlets() const -> Meshlets { return get<Meshlets>(AssetId::SphereMeshlets); }
+    auto rounded_cube_mesh() const -> Mesh { return get<Mesh>(AssetId::RoundedCubeMesh); }
+    auto rounded_cube_meshlets() const -> Meshlets {
+        return get<Meshlets>(AssetId::RoundedCubeMeshlets);
+    }
+    auto rounded_cube_base_color_texture() const -> Texture {
+        return get<Texture>(AssetId::RoundedCubeBaseColorTexture);
     }
+    auto rounded_cube_material() const -> Material {
+        return get<Material>(AssetId::RoundedCubeMaterial);
+    }
+    auto plane_mesh() const -> Mesh { return get<Mesh>(AssetId::PlaneMesh); }
+    auto plane_meshlets() const -> Meshlets { return get<Meshlets>(AssetId::PlaneMeshlets); }
+    auto plane_texture() const -> Texture { return get<Texture>(AssetId::PlaneTexture); }
 
-    FileBuffer _file;
+private:
+    AssetsFile _file;
 };
 
+enum class ShaderId : uint {};
+
+inline constexpr uint SHADER_COUNT = 0;
+
 class Shaders {
 public:
     auto load() -> void;
 
+    // Swaps in the bin published by a watching baker, like `Assets::reload`.
+    auto reload() -> Option<std::vector<ShaderId>>;
+
+    auto get(ShaderId id) const -> Span<const std::byte> { return _file.get((uint)id); }
+
 private:
-    FileBuffer _file;
+    ShadersFile _file;
 };
 
 } // namespace fb::baked::raydiance
@@ -4,47 +4,98 @@
 
 namespace fb::baked::stockcube {
 
+enum class AssetId : uint {
+    FarmFieldHdrTexture,
+    WinterEveningHdrTexture,
+    ShanghaiBundHdrTexture,
+    IndustrialSunset02PureskyHdrTexture,
+    SkyboxMesh,
+    SkyboxMeshlets,
+    SphereMesh,
+    SphereMeshlets,
+};
+
+inline constexpr uint ASSET_COUNT = 8;
+
 class Assets {
 public:
     auto load() -> void;
 
-    auto farm_field_hdr_texture() const -> Texture;
-    auto winter_evening_hdr_texture() const -> Texture;
-    auto shanghai_bund_hdr_texture() const -> Texture;
-    auto industrial_sunset_02_puresky_hdr_texture() const -> Texture;
-    auto skybox_mesh() const -> Mesh;
-    auto sphere_mesh() const -> Mesh;
+    // Swaps in the bin published by a watching baker, and returns the assets
+    // whose contents changed. The whole bin is replaced, so every asset got
+    // earlier is invalidated, and nothing built from them is rebuilt. None if
+    // the assets themselves changed, which takes a rebuild.
+    auto reload() -> Option<std::vector<AssetId>>;
 
-private:
     template<typename T>
-    auto transmuted_span(size_t offset, size_t element_count) const -> Span<const T> {
-        return Span<const T>((const T*)(_file.bytes() + offset), element_count);
+    auto get(AssetId id) const -> T { return _file.get<T>((uint)id); }
+
+    auto farm_field_hdr_texture() const -> Texture {
+        return get<Texture>(AssetId::FarmFieldHdrTexture);
+    }
+    auto winter_evening_hdr_texture() const -> Texture {
+        return get<Texture>(AssetId::WinterEveningHdrTexture);
+    }
+    auto shanghai_bund_hdr_texture() const -> Texture {
+        return get<Texture>(AssetId::ShanghaiBundHdrTexture);
     }
+    auto industrial_sunset_02_puresky_hdr_texture() const -> Texture {
+        return get<Texture>(AssetId::IndustrialSunset02PureskyHdrTexture);
+    }
+    auto skybox_mesh() const -> Mesh { return get<Mesh>(AssetId::SkyboxMesh); }
+    auto skybox_meshlets() const -> Meshlets { return get<Meshlets>(AssetId::SkyboxMeshlets); }
+    auto sphere_mesh() const -> Mesh { return get<Mesh>(AssetId::SphereMesh); }
+    auto sphere_meshlets() const -> Meshlets { return get<Meshlets>(AssetId::SphereMeshlets); }
+
+private:
+    AssetsFile _file;
+};
 
-    FileBuffer _file;
+enum class ShaderId : uint {
+    CfrCs,
+    LutCs,
+    IrrAccCs,
+    IrrDivCs,
+    RadAccCs,
+    RadDivCs,
+    BgVs,
+    BgPs,
+    ModelVs,
+    ModelPs,
+    ScreenVs,
+    ScreenPs,
+    BlitVs,
+    BlitPs,
 };
 
+inline constexpr uint SHADER_COUNT = 14;
+
 class Shaders {
 public:
     auto load() -> void;
 
-    auto cfr_cs() const -> Span<const std::byte>;
-    auto lut_cs() const -> Span<const std::byte>;
-    auto irr_acc_cs() const -> Span<const std::byte>;
-    auto irr_div_cs() const -> Span<const std::byte>;
-    auto rad_acc_cs() const -> Span<const std::byte>;
-    auto rad_div_cs() const -> Span<const std::byte>;
-    auto bg_vs() const -> Span<const std::byte>;
-    auto bg_ps() const -> Span<const std::byte>;
-    auto model_vs() const -> Span<const std::byte>;
-    auto model_ps() const -> Span<const std::byte>;
-    auto screen_vs() const -> Span<const std::byte>;
-    auto screen_ps() const -> Span<const std::byte>;
-    auto blit_vs() const -> Span<const std::byte>;
-    auto blit_ps() const -> Span<const std::byte>;
+    // Swaps in the bin published by a watching baker, like `Assets::reload`.
+    auto reload() -> Option<std::vector<ShaderId>>;
+
+    auto get(ShaderId id) const -> Span<const std::byte> { return _file.get((uint)id); }
+
+    auto cfr_cs() const -> Span<const std::byte> { return get(ShaderId::CfrCs); }
+    auto lut_cs() const -> Span<const std::byte> { return get(ShaderId::LutCs); }
+    auto irr_acc_cs() const -> Span<const std::byte> { return get(ShaderId::IrrAccCs); }
+    auto irr_div_cs() const -> Span<const std::byte> { return get(ShaderId::IrrDivCs); }
+    auto rad_acc_cs() const -> Span<const std::byte> { return get(ShaderId::RadAccCs); }
+    auto rad_div_cs() const -> Span<const std::byte> { return get(ShaderId::RadDivCs); }
+    auto bg_vs() const -> Span<const std::byte> { return get(ShaderId::BgVs); }
+    auto bg_ps() const -> Span<const std::byte> { return get(ShaderId::BgPs); }
+    auto model_vs() const -> Span<const std::byte> { return get(ShaderId::ModelVs); }
+    auto model_ps() const -> Span<const std::byte> { return get(ShaderId::ModelPs); }
+    auto screen_vs() const -> Span<const std::byte> { return get(ShaderId::ScreenVs); }
+    auto screen_ps() const -> Span<const std::byte> { return get(ShaderId::ScreenPs); }
+    auto blit_vs() const -> Span<const std::byte> { return get(ShaderId::BlitVs); }
+    auto blit_ps() const -> Span<const std::byte> { return get(ShaderId::BlitPs); }
 
 private:
-    FileBuffer _file;
+    ShadersFile _file;
 };
 
 } // namespace fb::baked::stockcube
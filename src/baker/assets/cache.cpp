@@ -0,0 +1,381 @@
+#include "cache.hpp"
+
+#include <filesystem>
+
+namespace fb {
+
+//
+// Keys.
+//
+
+static auto asset_task_key_bytes(
+    std::string_view assets_dir,
+    const AssetTask& asset_task,
+    bool hash_inputs
+) -> std::vector<std::byte> {
+    auto key_bytes = std::vector<std::byte>();
+    auto arc = SerializingArchive(key_bytes);
+    const auto value = [&](auto v) { arc & v; };
+    const auto string = [&](std::string_view v) {
+        auto s = std::string(v);
+        arc & s;
+    };
+    const auto input = [&](std::string_view path) {
+        if (!hash_inputs) {
+            return;
+        }
+        const auto file = FileBuffer::from_path(std::format("{}/{}", assets_dir, path));
+        value(hash128(file.as_span()));
+    };
+
+    value(ASSET_BAKER_VERSION);
+    value((uint)asset_task.index());
+    std::visit(
+        overloaded {
+            [&](const AssetTaskCopy& task) {
+                string(task.name);
+                string(task.path);
+                input(task.path);
+            },
+            [&](const AssetTaskTexture& task) {
+                string(task.name);
+                string(task.path);
+                value(task.format);
+                value(task.color_space);
+                input(task.path);
+            },
+            [&](const AssetTaskHdrTexture& task) {
+                string(task.name);
+                string(task.path);
+                input(task.path);
+            },
+            [&](const AssetTaskGltf& task) {
+                string(task.name);
+                string(task.path);
+                value(task.weld_epsilons);
+                value(task.lods);
+                value(task.compact_vertices);
+                value(task.short_index_chunks);
+                input(task.path);
+            },
+            [&](const AssetTaskProceduralCube& task) {
+                string(task.name);
+                value(task.extents);
+                value(task.inverted);
+            },
+            [&](const AssetTaskProceduralSphere& task) {
+                string(task.name);
+                value(task.radius);
+                value(task.tesselation);
+                value(task.inverted);
+            },
+            [&](const AssetTaskProceduralLowPolyGround& task) {
+                string(task.name);
+                value(task.vertex_count_x);
+                value(task.vertex_count_y);
+                value(task.side_length);
+                value(task.height_variation);
+            },
+            [&](const AssetTaskProceduralTexturedPlane& task) {
+                string(task.name);
+                value(task.texture_resolution);
+                value(task.side_length);
+                value(task.color_a);
+                value(task.color_b);
+            },
+            [&](const AssetTaskStockcubeOutput& task) {
+                string(task.name);
+                string(task.bin_path);
+                string(task.json_path);
+                input(task.bin_path);
+                input(task.json_path);
+            },
+            [&](const AssetTaskTtf& task) {
+                string(task.name);
+                string(task.path);
+                value(task.depth);
+                input(task.path);
+            },
+            [&](const AssetTaskNull&) {},
+        },
+        asset_task
+    );
+    return key_bytes;
+}
+
+auto asset_task_params_key(const AssetTask& asset_task) -> Hash128 {
+    return hash128(asset_task_key_bytes({}, asset_task, false));
+}
+
+auto asset_task_key(std::string_view assets_dir, const AssetTask& asset_task) -> Hash128 {
+    return hash128(asset_task_key_bytes(assets_dir, asset_task, true));
+}
+
+auto asset_task_input_paths(const AssetTask& asset_task) -> std::vector<std::string_view> {
+    using Paths = std::vector<std::string_view>;
+    return std::visit(
+        overloaded {
+            [](const AssetTaskCopy& task) { return Paths {task.path}; },
+            [](const AssetTaskTexture& task) { return Paths {task.path}; },
+            [](const AssetTaskHdrTexture& task) { return Paths {task.path}; },
+            [](const AssetTaskGltf& task) { return Paths {task.path}; },
+            [](const AssetTaskStockcubeOutput& task) {
+                return Paths {task.bin_path, task.json_path};
+            },
+            [](const AssetTaskTtf& task) { return Paths {task.path}; },
+            [](const auto&) { return Paths {}; },
+        },
+        asset_task
+    );
+}
+
+//
+// Serialization.
+//
+
+inline constexpr uint ASSET_CACHE_MAGIC = 0x43414246; // "FBAC"
+
+// Entries are this header, the archived assets, then the bytes of the bin.
+struct AssetCacheHeader {
+    uint magic;
+    uint version;
+    uint64_t assets_byte_count;
+    Hash128 assets_hash;
+    uint64_t bin_byte_count;
+    Hash128 bin_hash;
+};
+
+template<size_t I = 0>
+static auto asset_from_index(size_t index) -> Asset {
+    if constexpr (I < std::variant_size_v<Asset>) {
+        if (index == I) {
+            return Asset(std::in_place_index<I>);
+        }
+        return asset_from_index<I + 1>(index);
+    } else {
+        FB_FATAL();
+    }
+}
+
+template<Archive A>
+static auto archive(AssetSpan& span, A& arc) -> void {
+    arc & span.type & span.offset & span.element_count & span.byte_count & span.alignment;
+    arc & span.hash;
+}
+
+template<Archive A>
+static auto archive(AssetTextureData& data, A& arc) -> void {
+    arc & data.row_pitch & data.slice_pitch;
+}
+
+template<Archive A>
+static auto archive(Asset& asset, A& arc) -> void {
+    auto index = (uint)asset.index();
+    arc & index;
+    if constexpr (std::is_same_v<A, DeserializingArchive>) {
+        asset = asset_from_index(index);
+    }
+
+    // Everything except spans.
+    std::visit(
+        overloaded {
+            [&](AssetCopy& a) { arc & a.name; },
+            [&](AssetMesh& a) {
+                arc & a.name & a.transform & a.index_format & a.bounds & a.quantization;
+                arc & a.stats;
+            },
+            [&](AssetTexture& a) {
+                arc & a.name & a.format & a.width & a.height & a.channel_count & a.mip_count;
+                for (uint mip = 0; mip < a.mip_count; mip++) {
+                    archive(a.datas[mip], arc);
+                }
+            },
+            [&](AssetCubeTexture& a) {
+                arc & a.name & a.format & a.width & a.height & a.channel_count & a.mip_count;
+                for (uint slice = 0; slice < 6; slice++) {
+                    for (uint mip = 0; mip < a.mip_count; mip++) {
+                        archive(a.datas[slice][mip], arc);
+                    }
+                }
+            },
+            [&](AssetMaterial& a) { arc & a.name & a.alpha_cutoff & a.alpha_mode; },
+            [&](AssetAnimationMesh& a) {
+                arc & a.name & a.transform & a.node_count & a.joint_count & a.duration;
+                arc & a.index_format & a.bounds & a.quantization & a.stats;
+            },
+            [&](AssetFont& a) { arc & a.name & a.ascender & a.descender & a.space_advance; },
+            [&](AssetMeshlets& a) { arc & a.name; },
+        },
+        asset
+    );
+
+    // Spans.
+    for_each_asset_span(asset, [&](AssetSpan& span) { archive(span, arc); });
+}
+
+auto serialize_assets(SerializingArchive& arc, Span<const Asset> assets) -> void {
+    auto asset_count = (uint64_t)assets.size();
+    arc & asset_count;
+    for (auto asset : assets) { // Copy, archive() takes a mutable reference.
+        archive(asset, arc);
+    }
+}
+
+auto deserialize_assets(DeserializingArchive& arc) -> std::vector<Asset> {
+    auto asset_count = uint64_t(0);
+    arc & asset_count;
+    auto assets = std::vector<Asset>(asset_count);
+    for (auto& asset : assets) {
+        archive(asset, arc);
+    }
+    return assets;
+}
+
+//
+// Cache.
+//
+
+AssetCache::AssetCache(std::string_view cache_dir, SharedCacheClient* shared)
+    : _cache_dir(cache_dir)
+    , _shared(shared) {
+    create_directories(_cache_dir);
+}
+
+auto AssetCache::entry_path(Hash128 key) const -> std::string {
+    return std::format("{}/{}.bin", _cache_dir, key);
+}
+
+auto AssetCache::prefetch(Span<const Hash128> keys) -> void {
+    if (!enabled() || _shared == nullptr) {
+        return;
+    }
+    auto missing_keys = std::vector<Hash128>();
+    for (const auto key : keys) {
+        if (!file_exists(entry_path(key))) {
+            missing_keys.push_back(key);
+        }
+    }
+    _shared->prefetch(missing_keys);
+}
+
+auto AssetCache::load(Hash128 key) -> Option<AssetTaskOutput> {
+    if (!enabled()) {
+        return std::nullopt;
+    }
+
+    // Miss, unless the shared cache has the entry.
+    const auto path = entry_path(key);
+    if (!file_exists(path) && (_shared == nullptr || !_shared->fetch_to_file(key, path))) {
+        _miss_count++;
+        return std::nullopt;
+    }
+
+    // Validate. The bin is only hashed, in bounded chunks.
+    auto header = AssetCacheHeader {};
+    const auto header_bytes = read_file_range(path, 0, sizeof(header));
+    if (header_bytes.size() == sizeof(header)) {
+        std::memcpy(&header, header_bytes.data(), sizeof(header));
+    }
+    auto error = std::error_code();
+    const auto file_byte_count = std::filesystem::file_size(path, error);
+    const auto bin_offset = sizeof(header) + header.assets_byte_count;
+    auto assets_bytes = std::vector<std::byte>();
+    const auto valid = [&]() {
+        if (header.magic != ASSET_CACHE_MAGIC || header.version != ASSET_BAKER_VERSION || error
+            || file_byte_count != bin_offset + header.bin_byte_count) {
+            return false;
+        }
+        assets_bytes = read_file_range(path, sizeof(header), header.assets_byte_count);
+        return assets_bytes.size() == header.assets_byte_count
+            && hash128(assets_bytes) == header.assets_hash
+            && hash_file_range(path, bin_offset, header.bin_byte_count) == header.bin_hash;
+    }();
+    if (!valid) {
+        FB_LOG_WARN("Ignoring invalid asset cache entry: {}", path);
+        _miss_count++;
+        return std::nullopt;
+    }
+
+    // Hit.
+    auto arc = DeserializingArchive(assets_bytes);
+    auto output = AssetTaskOutput {
+        .assets = deserialize_assets(arc),
+        .bin = std::make_shared<const AssetTaskBin>(
+            path,
+            bin_offset,
+            header.bin_byte_count,
+            header.bin_hash,
+            false
+        ),
+    };
+    FB_ASSERT(arc.fully_consumed());
+    _hit_count++;
+    return output;
+}
+
+auto AssetCache::store(Hash128 key, const AssetTaskOutput& output) -> void {
+    if (!enabled()) {
+        return;
+    }
+
+    // Archive the assets. The bin is copied from its file.
+    auto assets_bytes = std::vector<std::byte>();
+    auto arc = SerializingArchive(assets_bytes);
+    serialize_assets(arc, output.assets);
+    const auto& bin = *output.bin;
+    const auto header = AssetCacheHeader {
+        .magic = ASSET_CACHE_MAGIC,
+        .version = ASSET_BAKER_VERSION,
+        .assets_byte_count = assets_bytes.size(),
+        .assets_hash = hash128(assets_bytes),
+        .bin_byte_count = bin.byte_count(),
+        .bin_hash = bin.hash(),
+    };
+
+    // Write through a temporary file, so that readers never see partial entries.
+    const auto path = entry_path(key);
+    const auto temp_path = std::format("{}.{}.tmp", path, GetCurrentThreadId());
+    auto writer = FileWriter(temp_path);
+    writer.write(std::as_bytes(Span<const AssetCacheHeader>(&header, 1)));
+    writer.write(assets_bytes);
+    writer.write_file(bin.path(), bin.offset(), bin.byte_count());
+    writer.close();
+    move_file(path, temp_path);
+    if (_shared != nullptr) {
+        _shared->put_file(key, path);
+    }
+}
+
+//
+// Memo.
+//
+
+auto AssetTaskMemo::expect(Hash128 key) -> void {
+    std::scoped_lock lock(_mutex);
+    auto& entry = _entries[key];
+    if (!entry) {
+        entry = std::make_shared<Entry>();
+    }
+    entry->expected_count++;
+}
+
+auto AssetTaskMemo::release(Hash128 key, std::shared_ptr<Entry> entry) -> AssetTaskOutput {
+    // The last expected request drops the entry from the table. If nobody else
+    // holds it anymore, the output can be moved out instead of copied.
+    {
+        std::scoped_lock lock(_mutex);
+        if (entry->expected_count > 1) {
+            entry->expected_count--;
+            return entry->output;
+        }
+        if (const auto it = _entries.find(key); it != _entries.end() && it->second == entry) {
+            _entries.erase(it);
+        }
+    }
+    if (entry.use_count() == 1) {
+        return std::move(entry->output);
+    }
+    return entry->output;
+}
+
+} // namespace fb
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "tasks.hpp"
+#include "../utils/shared_cache.hpp"
+
+#include <atomic>
+#include <mutex>
+
+namespace fb {
+
+// Bump whenever a change to the baker alters what any asset task produces, so
+// that stale cache entries are never reused.
+inline constexpr uint ASSET_BAKER_VERSION = 11;
+
+// Content-addressed key of an asset task: the baker version, the task's type
+// and parameters, and the bytes of every input file it reads.
+auto asset_task_key(std::string_view assets_dir, const AssetTask& asset_task) -> Hash128;
+
+// Key of an asset task's type and parameters only. Identical tasks of
+// different apps share it.
+auto asset_task_params_key(const AssetTask& asset_task) -> Hash128;
+
+// Files read by an asset task, relative to the assets directory. These are the
+// inputs its key hashes.
+auto asset_task_input_paths(const AssetTask& asset_task) -> std::vector<std::string_view>;
+
+// Assets of task outputs, as stored in cache entries and sent by bake farm
+// workers, ahead of the bytes of their bins.
+auto serialize_assets(SerializingArchive& arc, Span<const Asset> assets) -> void;
+auto deserialize_assets(DeserializingArchive& arc) -> std::vector<Asset>;
+
+// Persistent on-disk store of asset task outputs, one file per key. A default
+// constructed cache is disabled: it never hits and never writes. With a shared
+// cache, local misses are fetched from it, and stored entries are put to it.
+// Entries are streamed from the task's bin, and loaded outputs refer to the
+// bin bytes within the entry, so that neither is held in memory.
+class AssetCache {
+    FB_NO_COPY_MOVE(AssetCache);
+
+public:
+    AssetCache() = default;
+    explicit AssetCache(std::string_view cache_dir, SharedCacheClient* shared = nullptr);
+
+    auto enabled() const -> bool { return !_cache_dir.empty(); }
+    auto prefetch(Span<const Hash128> keys) -> void;
+    auto load(Hash128 key) -> Option<AssetTaskOutput>;
+    auto store(Hash128 key, const AssetTaskOutput& output) -> void;
+
+    auto hit_count() const -> uint { return _hit_count.load(); }
+    auto miss_count() const -> uint { return _miss_count.load(); }
+
+private:
+    auto entry_path(Hash128 key) const -> std::string;
+
+    std::string _cache_dir;
+    SharedCacheClient* _shared = nullptr;
+    std::atomic<uint> _hit_count = 0;
+    std::atomic<uint> _miss_count = 0;
+};
+
+// Table of task outputs shared by apps that bake concurrently, so that
+// identical tasks run once per bake. The first request of a key bakes, and
+// later ones wait for it. Entries live until the last request registered with
+// `expect` took its copy; unregistered requests bake and drop their entry.
+class AssetTaskMemo {
+    FB_NO_COPY_MOVE(AssetTaskMemo);
+
+public:
+    AssetTaskMemo() = default;
+
+    auto expect(Hash128 key) -> void;
+
+    template<typename Bake>
+    auto take(Hash128 key, Bake&& bake) -> AssetTaskOutput {
+        auto entry = std::shared_ptr<Entry>();
+        {
+            std::scoped_lock lock(_mutex);
+            auto& slot = _entries[key];
+            if (!slot) {
+                slot = std::make_shared<Entry>();
+            }
+            entry = slot;
+        }
+        auto baked = false;
+        std::call_once(entry->once, [&]() {
+            entry->output = bake();
+            baked = true;
+        });
+        if (!baked) {
+            _reuse_count++;
+        }
+        return release(key, std::move(entry));
+    }
+
+    auto reuse_count() const -> uint { return _reuse_count.load(); }
+
+private:
+    struct Entry {
+        std::once_flag once;
+        AssetTaskOutput output;
+        uint expected_count = 0;
+    };
+
+    auto release(Hash128 key, std::shared_ptr<Entry> entry) -> AssetTaskOutput;
+
+    std::mutex _mutex;
+    std::unordered_map<Hash128, std::shared_ptr<Entry>> _entries;
+    std::atomic<uint> _reuse_count = 0;
+};
+
+} // namespace fb
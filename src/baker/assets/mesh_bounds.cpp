@@ -0,0 +1,195 @@
+#include "mesh_bounds.hpp"
+#include "../utils/profiler.hpp"
+
+#include <emmintrin.h>
+
+namespace fb {
+
+// Growing toward the farthest point settles within a few passes, past which
+// the sphere is only shrunk to its farthest point.
+static constexpr uint MAX_SPHERE_GROW_PASS_COUNT = 16;
+
+// Points as a structure of arrays, padded to a multiple of 4 with copies of
+// the first point, which move no bound.
+struct SoaPoints {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+};
+
+static auto soa_points(Span<const float3> points) -> SoaPoints {
+    const auto padded_count = (points.size() + 3) & ~size_t(3);
+    auto soa = SoaPoints {
+        .x = std::vector<float>(padded_count, points[0].x),
+        .y = std::vector<float>(padded_count, points[0].y),
+        .z = std::vector<float>(padded_count, points[0].z),
+    };
+    for (size_t i = 0; i < points.size(); i++) {
+        soa.x[i] = points[i].x;
+        soa.y[i] = points[i].y;
+        soa.z[i] = points[i].z;
+    }
+    return soa;
+}
+
+static auto horizontal_min(__m128 v) -> float {
+    alignas(16) auto lanes = std::array<float, 4>();
+    _mm_store_ps(lanes.data(), v);
+    return std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+}
+
+static auto horizontal_max(__m128 v) -> float {
+    alignas(16) auto lanes = std::array<float, 4>();
+    _mm_store_ps(lanes.data(), v);
+    return std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+}
+
+static auto soa_box(const SoaPoints& points) -> std::tuple<float3, float3> {
+    auto min_x = _mm_loadu_ps(&points.x[0]);
+    auto min_y = _mm_loadu_ps(&points.y[0]);
+    auto min_z = _mm_loadu_ps(&points.z[0]);
+    auto max_x = min_x;
+    auto max_y = min_y;
+    auto max_z = min_z;
+    for (size_t i = 4; i < points.x.size(); i += 4) {
+        const auto x = _mm_loadu_ps(&points.x[i]);
+        const auto y = _mm_loadu_ps(&points.y[i]);
+        const auto z = _mm_loadu_ps(&points.z[i]);
+        min_x = _mm_min_ps(min_x, x);
+        min_y = _mm_min_ps(min_y, y);
+        min_z = _mm_min_ps(min_z, z);
+        max_x = _mm_max_ps(max_x, x);
+        max_y = _mm_max_ps(max_y, y);
+        max_z = _mm_max_ps(max_z, z);
+    }
+    return {
+        float3(horizontal_min(min_x), horizontal_min(min_y), horizontal_min(min_z)),
+        float3(horizontal_max(max_x), horizontal_max(max_y), horizontal_max(max_z)),
+    };
+}
+
+// Index of the point farthest from `center`, the first of them on ties, and
+// its squared distance.
+static auto soa_farthest(const SoaPoints& points, float3 center) -> std::tuple<uint, float> {
+    const auto center_x = _mm_set1_ps(center.x);
+    const auto center_y = _mm_set1_ps(center.y);
+    const auto center_z = _mm_set1_ps(center.z);
+    auto best_distances = _mm_set1_ps(-1.0f);
+    auto best_indices = _mm_setzero_si128();
+    auto indices = _mm_setr_epi32(0, 1, 2, 3);
+    const auto index_step = _mm_set1_epi32(4);
+    for (size_t i = 0; i < points.x.size(); i += 4) {
+        const auto dx = _mm_sub_ps(_mm_loadu_ps(&points.x[i]), center_x);
+        const auto dy = _mm_sub_ps(_mm_loadu_ps(&points.y[i]), center_y);
+        const auto dz = _mm_sub_ps(_mm_loadu_ps(&points.z[i]), center_z);
+        const auto distances =
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        const auto farther = _mm_castps_si128(_mm_cmpgt_ps(distances, best_distances));
+        best_distances = _mm_max_ps(distances, best_distances);
+        best_indices = _mm_or_si128(
+            _mm_and_si128(farther, indices),
+            _mm_andnot_si128(farther, best_indices)
+        );
+        indices = _mm_add_epi32(indices, index_step);
+    }
+
+    // Padding copies the first point, so ties going to the lowest index keep
+    // the result within the points.
+    alignas(16) auto lane_distances = std::array<float, 4>();
+    alignas(16) auto lane_indices = std::array<uint, 4>();
+    _mm_store_ps(lane_distances.data(), best_distances);
+    _mm_store_si128((__m128i*)lane_indices.data(), best_indices);
+    auto best = 0u;
+    for (uint lane = 1; lane < 4; lane++) {
+        if (lane_distances[lane] > lane_distances[best]
+            || (lane_distances[lane] == lane_distances[best]
+                && lane_indices[lane] < lane_indices[best])) {
+            best = lane;
+        }
+    }
+    return {lane_indices[best], lane_distances[best]};
+}
+
+auto point_bounds(Span<const float3> points) -> AssetBounds {
+    if (points.empty()) {
+        return {};
+    }
+    const auto soa = soa_points(points);
+    const auto [min, max] = soa_box(soa);
+
+    // Centered on the box.
+    const auto box_center = (min + max) * 0.5f;
+    const auto [box_farthest, box_distance_squared] = soa_farthest(soa, box_center);
+    const auto box_radius = std::sqrt(box_distance_squared);
+
+    // Ritter's, through the farthest point from the first point and the
+    // farthest point from that one, grown toward the farthest point left out.
+    const auto [a, a_distance_squared] = soa_farthest(soa, points[0]);
+    const auto [b, ab_distance_squared] = soa_farthest(soa, points[a]);
+    auto center = (points[a] + points[b]) * 0.5f;
+    auto radius = std::sqrt(ab_distance_squared) * 0.5f;
+    for (uint pass = 0; pass < MAX_SPHERE_GROW_PASS_COUNT; pass++) {
+        const auto [farthest, farthest_distance_squared] = soa_farthest(soa, center);
+        const auto distance = std::sqrt(farthest_distance_squared);
+        if (distance <= radius) {
+            break;
+        }
+        const auto grown_radius = (radius + distance) * 0.5f;
+        center += (points[farthest] - center) * ((grown_radius - radius) / distance);
+        radius = grown_radius;
+    }
+    const auto [farthest, farthest_distance_squared] = soa_farthest(soa, center);
+    radius = std::sqrt(farthest_distance_squared);
+
+    if (box_radius <= radius) {
+        center = box_center;
+        radius = box_radius;
+    }
+    return AssetBounds {
+        .min = min,
+        .max = max,
+        .center = center,
+        .radius = radius,
+    };
+}
+
+auto build_bounds(
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes,
+    Span<const float3> positions
+) -> MeshBounds {
+    FB_BAKE_ZONE("bounds");
+
+    // Vertices are taken once per submesh, and once for the whole mesh.
+    auto submesh_marks = std::vector<uint>(positions.size(), ~0u);
+    auto mesh_marks = std::vector<bool>(positions.size(), false);
+    auto submesh_points = std::vector<float3>();
+    auto mesh_points = std::vector<float3>();
+    auto bounds = MeshBounds {
+        .bounds = {},
+        .submesh_bounds = std::vector<AssetBounds>(submeshes.size()),
+    };
+    for (uint submesh_index = 0; submesh_index < submeshes.size(); submesh_index++) {
+        const auto& submesh = submeshes[submesh_index];
+        FB_ASSERT(submesh.start_index + submesh.index_count <= indices.size());
+        submesh_points.clear();
+        for (uint i = 0; i < submesh.index_count; i++) {
+            const auto v = indices[submesh.start_index + i] + submesh.base_vertex;
+            FB_ASSERT(v < positions.size());
+            if (submesh_marks[v] == submesh_index) {
+                continue;
+            }
+            submesh_marks[v] = submesh_index;
+            submesh_points.push_back(positions[v]);
+            if (!mesh_marks[v]) {
+                mesh_marks[v] = true;
+                mesh_points.push_back(positions[v]);
+            }
+        }
+        bounds.submesh_bounds[submesh_index] = point_bounds(submesh_points);
+    }
+    bounds.bounds = point_bounds(mesh_points);
+    return bounds;
+}
+
+} // namespace fb
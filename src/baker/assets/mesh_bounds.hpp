@@ -0,0 +1,39 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace fb {
+
+// Bounds of a mesh, and of each of its submeshes, over the vertices that their
+// triangles use.
+struct MeshBounds {
+    AssetBounds bounds;
+    std::vector<AssetBounds> submesh_bounds;
+};
+
+// Box and sphere around `points`, 4 points at a time with SSE2. The sphere is
+// the smaller of the one centered on the box, and Ritter's (Ritter, "An
+// Efficient Bounding Sphere") grown toward the farthest point, each shrunk to
+// its farthest point. Empty points have empty bounds.
+auto point_bounds(Span<const float3> points) -> AssetBounds;
+
+auto build_bounds(
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes,
+    Span<const float3> positions
+) -> MeshBounds;
+
+template<typename Vertex>
+auto build_mesh_bounds(
+    Span<const Vertex> vertices,
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes
+) -> MeshBounds {
+    auto positions = std::vector<float3>(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        positions[i] = vertices[i].position;
+    }
+    return build_bounds(indices, submeshes, positions);
+}
+
+} // namespace fb
@@ -0,0 +1,82 @@
+#include "mesh_indices.hpp"
+
+namespace fb {
+
+auto mesh_index_format(Span<const AssetIndex> indices) -> DXGI_FORMAT {
+    for (const auto index : indices) {
+        if (index >= SHORT_INDEX_VERTEX_COUNT) {
+            return DXGI_FORMAT_R32_UINT;
+        }
+    }
+    return DXGI_FORMAT_R16_UINT;
+}
+
+auto short_indices(Span<const AssetIndex> indices) -> std::vector<AssetShortIndex> {
+    auto result = std::vector<AssetShortIndex>(indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+        FB_ASSERT(indices[i] < SHORT_INDEX_VERTEX_COUNT);
+        result[i] = (AssetShortIndex)indices[i];
+    }
+    return result;
+}
+
+auto split_short_index_submeshes(Span<AssetIndex> indices, Span<const AssetSubmesh> submeshes)
+    -> Option<std::vector<AssetSubmesh>> {
+    const auto triangle_range = [&](const AssetSubmesh& submesh, uint i) {
+        const auto* triangle = &indices[submesh.start_index + i];
+        const auto min = std::min(triangle[0], std::min(triangle[1], triangle[2]));
+        const auto max = std::max(triangle[0], std::max(triangle[1], triangle[2]));
+        return std::tuple(min + submesh.base_vertex, max + submesh.base_vertex);
+    };
+
+    // Every triangle must fit on its own.
+    for (const auto& submesh : submeshes) {
+        FB_ASSERT(submesh.index_count % 3 == 0);
+        FB_ASSERT(submesh.start_index + submesh.index_count <= indices.size());
+        for (uint i = 0; i < submesh.index_count; i += 3) {
+            const auto [min, max] = triangle_range(submesh, i);
+            if (max - min >= SHORT_INDEX_VERTEX_COUNT) {
+                return std::nullopt;
+            }
+        }
+    }
+
+    auto result = std::vector<AssetSubmesh>();
+    for (const auto& submesh : submeshes) {
+        const auto submesh_indices = indices.subspan(submesh.start_index, submesh.index_count);
+        if (mesh_index_format(submesh_indices) == DXGI_FORMAT_R16_UINT) {
+            result.push_back(submesh);
+            continue;
+        }
+
+        // Runs, rebased once they end.
+        auto run = AssetSubmesh {.index_count = 0, .start_index = submesh.start_index};
+        auto run_min = ~0u;
+        auto run_max = 0u;
+        const auto finish_run = [&]() {
+            for (uint i = 0; i < run.index_count; i++) {
+                auto& index = indices[run.start_index + i];
+                index = index + submesh.base_vertex - run_min;
+            }
+            run.base_vertex = run_min;
+            result.push_back(run);
+        };
+        for (uint i = 0; i < submesh.index_count; i += 3) {
+            const auto [min, max] = triangle_range(submesh, i);
+            if (run.index_count > 0
+                && std::max(run_max, max) - std::min(run_min, min) >= SHORT_INDEX_VERTEX_COUNT) {
+                finish_run();
+                run = AssetSubmesh {.index_count = 0, .start_index = submesh.start_index + i};
+                run_min = ~0u;
+                run_max = 0u;
+            }
+            run.index_count += 3;
+            run_min = std::min(run_min, min);
+            run_max = std::max(run_max, max);
+        }
+        finish_run();
+    }
+    return result;
+}
+
+} // namespace fb
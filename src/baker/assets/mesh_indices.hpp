@@ -0,0 +1,24 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace fb {
+
+// 16-bit indices address this many vertices from the base vertex of their
+// submesh.
+inline constexpr uint SHORT_INDEX_VERTEX_COUNT = 65536;
+
+// 16-bit if every index fits, 32-bit otherwise.
+auto mesh_index_format(Span<const AssetIndex> indices) -> DXGI_FORMAT;
+
+auto short_indices(Span<const AssetIndex> indices) -> std::vector<AssetShortIndex>;
+
+// Splits the submeshes whose indices don't fit 16 bits into runs of triangles
+// that do, in order, each based on its lowest vertex. Vertices numbered in
+// order of first use, as `optimize_vertex_fetch` leaves them, keep the runs
+// long. Submeshes that fit are kept as they are. Returns None, leaving the
+// indices as they were, if a single triangle spans too many vertices.
+auto split_short_index_submeshes(Span<AssetIndex> indices, Span<const AssetSubmesh> submeshes)
+    -> Option<std::vector<AssetSubmesh>>;
+
+} // namespace fb
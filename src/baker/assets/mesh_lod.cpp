@@ -0,0 +1,513 @@
+#include "mesh_lod.hpp"
+#include "mesh_order.hpp"
+#include "mesh_weld.hpp"
+#include "../utils/profiler.hpp"
+
+namespace fb {
+
+//
+// Quadrics.
+//
+
+// Planes along borders, perpendicular to their triangle, keep borders in
+// place. They weigh this much more than the triangles, per squared length.
+static constexpr double BORDER_PLANE_WEIGHT = 10.0;
+
+// Collapses that turn a triangle by more than about 75 degrees are rejected,
+// which includes flipping it.
+static constexpr float MIN_TRIANGLE_TURN_COS = 0.25f;
+
+// Sum of the squared distances to planes, weighted by area.
+struct Quadric {
+    double a00 = 0.0;
+    double a11 = 0.0;
+    double a22 = 0.0;
+    double a01 = 0.0;
+    double a02 = 0.0;
+    double a12 = 0.0;
+    double b0 = 0.0;
+    double b1 = 0.0;
+    double b2 = 0.0;
+    double c = 0.0;
+    double weight = 0.0;
+};
+
+static auto plane_quadric(const float3& normal, const float3& point, double weight) -> Quadric {
+    const auto n0 = (double)normal.x;
+    const auto n1 = (double)normal.y;
+    const auto n2 = (double)normal.z;
+    const auto d = -(n0 * point.x + n1 * point.y + n2 * point.z);
+    return {
+        .a00 = weight * n0 * n0,
+        .a11 = weight * n1 * n1,
+        .a22 = weight * n2 * n2,
+        .a01 = weight * n0 * n1,
+        .a02 = weight * n0 * n2,
+        .a12 = weight * n1 * n2,
+        .b0 = weight * d * n0,
+        .b1 = weight * d * n1,
+        .b2 = weight * d * n2,
+        .c = weight * d * d,
+        .weight = weight,
+    };
+}
+
+static auto operator+(const Quadric& a, const Quadric& b) -> Quadric {
+    return {
+        .a00 = a.a00 + b.a00,
+        .a11 = a.a11 + b.a11,
+        .a22 = a.a22 + b.a22,
+        .a01 = a.a01 + b.a01,
+        .a02 = a.a02 + b.a02,
+        .a12 = a.a12 + b.a12,
+        .b0 = a.b0 + b.b0,
+        .b1 = a.b1 + b.b1,
+        .b2 = a.b2 + b.b2,
+        .c = a.c + b.c,
+        .weight = a.weight + b.weight,
+    };
+}
+
+// Mean squared distance of `p` to the planes.
+static auto quadric_error(const Quadric& q, const float3& p) -> double {
+    if (q.weight == 0.0) {
+        return 0.0;
+    }
+    const auto x = (double)p.x;
+    const auto y = (double)p.y;
+    const auto z = (double)p.z;
+    const auto error = q.a00 * x * x + q.a11 * y * y + q.a22 * z * z
+        + 2.0 * (q.a01 * x * y + q.a02 * x * z + q.a12 * y * z)
+        + 2.0 * (q.b0 * x + q.b1 * y + q.b2 * z) + q.c;
+    return std::max(error / q.weight, 0.0);
+}
+
+//
+// Simplification.
+//
+
+enum class VertexKind : uint8_t {
+    Manifold,
+    Border,
+    Locked,
+};
+
+static constexpr auto edge_key(AssetIndex a, AssetIndex b) -> uint64_t {
+    return ((uint64_t)a << 32) | b;
+}
+
+// Directed edges of the triangles, sorted.
+class EdgeSet {
+public:
+    explicit EdgeSet(Span<const AssetIndex> indices) {
+        _edges.reserve(indices.size());
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            for (uint corner = 0; corner < 3; corner++) {
+                const auto a = indices[i + corner];
+                const auto b = indices[i + (corner + 1) % 3];
+                _edges.push_back(edge_key(a, b));
+            }
+        }
+        std::sort(_edges.begin(), _edges.end());
+    }
+
+    auto count(AssetIndex a, AssetIndex b) const -> size_t {
+        const auto [begin, end] = std::equal_range(_edges.begin(), _edges.end(), edge_key(a, b));
+        return (size_t)(end - begin);
+    }
+
+    // Edges used by a single triangle.
+    auto is_border(AssetIndex a, AssetIndex b) const -> bool {
+        return count(a, b) + count(b, a) == 1;
+    }
+
+private:
+    std::vector<uint64_t> _edges;
+};
+
+static auto triangle_normal(const float3& p0, const float3& p1, const float3& p2) -> float3 {
+    return float3_cross(p1 - p0, p2 - p0);
+}
+
+auto simplify_triangles(
+    Span<const AssetIndex> indices,
+    Span<const float3> positions,
+    Span<const uint8_t> locked_vertices,
+    uint target_triangle_count,
+    float max_error
+) -> std::tuple<std::vector<AssetIndex>, float> {
+    FB_BAKE_ZONE("simplify");
+    FB_ASSERT(indices.size() % 3 == 0);
+    FB_ASSERT(locked_vertices.size() == positions.size());
+    const auto vertex_count = (uint)positions.size();
+    auto result = std::vector<AssetIndex>(indices.begin(), indices.end());
+    auto error = 0.0f;
+
+    // Seams and locked vertices never move.
+    const auto position_ids = weld_keys(std::as_bytes(positions), sizeof(float3));
+    auto position_vertex_counts = std::vector<uint>(vertex_count, 0);
+    for (const auto id : position_ids) {
+        position_vertex_counts[id]++;
+    }
+    auto fixed = std::vector<bool>(vertex_count);
+    for (uint v = 0; v < vertex_count; v++) {
+        fixed[v] = locked_vertices[v] != 0 || position_vertex_counts[position_ids[v]] > 1;
+    }
+
+    // Quadrics of the triangles, and of the planes along borders.
+    auto quadrics = std::vector<Quadric>(vertex_count);
+    {
+        const auto edges = EdgeSet(result);
+        for (size_t i = 0; i < result.size(); i += 3) {
+            const auto* triangle = &result[i];
+            const auto normal = triangle_normal(
+                positions[triangle[0]],
+                positions[triangle[1]],
+                positions[triangle[2]]
+            );
+            const auto length = std::sqrt(float3_dot(normal, normal));
+            if (length == 0.0f) {
+                continue;
+            }
+            const auto unit_normal = normal / length;
+            const auto face = plane_quadric(unit_normal, positions[triangle[0]], 0.5 * length);
+            for (uint corner = 0; corner < 3; corner++) {
+                auto& quadric = quadrics[triangle[corner]];
+                quadric = quadric + face;
+            }
+            for (uint corner = 0; corner < 3; corner++) {
+                const auto a = triangle[corner];
+                const auto b = triangle[(corner + 1) % 3];
+                if (!edges.is_border(a, b)) {
+                    continue;
+                }
+                const auto edge = positions[b] - positions[a];
+                const auto edge_normal = float3_cross(edge, unit_normal);
+                const auto edge_length = std::sqrt(float3_dot(edge_normal, edge_normal));
+                if (edge_length == 0.0f) {
+                    continue;
+                }
+                const auto border = plane_quadric(
+                    edge_normal / edge_length,
+                    positions[a],
+                    BORDER_PLANE_WEIGHT * (double)float3_dot(edge, edge)
+                );
+                quadrics[a] = quadrics[a] + border;
+                quadrics[b] = quadrics[b] + border;
+            }
+        }
+    }
+
+    // Passes of collapses that don't share a triangle, so that every one is
+    // checked against the triangles as they are.
+    const auto max_cost = (double)max_error * (double)max_error;
+    auto kinds = std::vector<VertexKind>(vertex_count);
+    auto border_edge_counts = std::vector<uint>(vertex_count);
+    auto offsets = std::vector<uint>(vertex_count + 1);
+    auto vertex_triangles = std::vector<uint>();
+    auto remap = std::vector<AssetIndex>(vertex_count);
+    auto touched = std::vector<bool>(vertex_count);
+    auto v_neighbors = std::vector<AssetIndex>();
+    auto u_neighbors = std::vector<AssetIndex>();
+    while (result.size() / 3 > target_triangle_count) {
+        const auto triangle_count = (uint)(result.size() / 3);
+
+        // Kinds.
+        const auto edges = EdgeSet(result);
+        std::fill(border_edge_counts.begin(), border_edge_counts.end(), 0);
+        for (uint v = 0; v < vertex_count; v++) {
+            kinds[v] = fixed[v] ? VertexKind::Locked : VertexKind::Manifold;
+        }
+        for (size_t i = 0; i < result.size(); i += 3) {
+            for (uint corner = 0; corner < 3; corner++) {
+                const auto a = result[i + corner];
+                const auto b = result[i + (corner + 1) % 3];
+                if (edges.count(a, b) > 1) {
+                    kinds[a] = VertexKind::Locked;
+                    kinds[b] = VertexKind::Locked;
+                } else if (edges.count(b, a) == 0) {
+                    border_edge_counts[a]++;
+                    border_edge_counts[b]++;
+                }
+            }
+        }
+        for (uint v = 0; v < vertex_count; v++) {
+            if (kinds[v] == VertexKind::Manifold && border_edge_counts[v] > 0) {
+                kinds[v] = border_edge_counts[v] == 2 ? VertexKind::Border : VertexKind::Locked;
+            }
+        }
+
+        // Triangles of every vertex.
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (const auto index : result) {
+            offsets[index + 1]++;
+        }
+        for (uint v = 0; v < vertex_count; v++) {
+            offsets[v + 1] += offsets[v];
+        }
+        vertex_triangles.resize(result.size());
+        {
+            auto cursors = std::vector<uint>(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < result.size(); i++) {
+                vertex_triangles[cursors[result[i]]++] = (uint)(i / 3);
+            }
+        }
+        const auto triangles_of = [&](AssetIndex v) {
+            const auto count = offsets[v + 1] - offsets[v];
+            return Span<const uint>(vertex_triangles).subspan(offsets[v], count);
+        };
+
+        // Cheapest collapse of every vertex, onto one of its neighbors.
+        struct Collapse {
+            AssetIndex v;
+            AssetIndex u;
+            double cost;
+        };
+        auto collapses = std::vector<Collapse>();
+        for (uint v = 0; v < vertex_count; v++) {
+            if (kinds[v] == VertexKind::Locked) {
+                continue;
+            }
+            auto best = Option<Collapse>();
+            for (const auto t : triangles_of(v)) {
+                for (uint corner = 0; corner < 3; corner++) {
+                    const auto u = result[t * 3 + corner];
+                    if (u == v) {
+                        continue;
+                    }
+                    if (kinds[v] == VertexKind::Border && !edges.is_border(v, u)) {
+                        continue;
+                    }
+                    const auto cost = quadric_error(quadrics[v] + quadrics[u], positions[u]);
+                    if (!best.has_value() || cost < best->cost) {
+                        best = Collapse {v, u, cost};
+                    }
+                }
+            }
+            if (best.has_value() && best->cost <= max_cost) {
+                collapses.push_back(*best);
+            }
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const auto& a, const auto& b) {
+            return a.cost != b.cost ? a.cost < b.cost : a.v < b.v;
+        });
+
+        if (collapses.empty()) {
+            break;
+        }
+
+        // Collapse, cheapest first. A pass doesn't go past the cost of the
+        // collapses it would take to reach the target, two triangles each, so
+        // that costlier ones wait for the cheaper ones they were blocked by.
+        const auto wanted_count =
+            std::min((triangle_count - target_triangle_count + 1) / 2, (uint)collapses.size());
+        const auto pass_max_cost = collapses[std::max(wanted_count, 1u) - 1].cost;
+        for (uint v = 0; v < vertex_count; v++) {
+            remap[v] = v;
+        }
+        std::fill(touched.begin(), touched.end(), false);
+        const auto neighbors_of = [&](AssetIndex v, std::vector<AssetIndex>& neighbors) {
+            neighbors.clear();
+            for (const auto t : triangles_of(v)) {
+                for (uint corner = 0; corner < 3; corner++) {
+                    if (result[t * 3 + corner] != v) {
+                        neighbors.push_back(result[t * 3 + corner]);
+                    }
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        };
+        auto removed_count = 0u;
+        for (const auto& collapse : collapses) {
+            if (removed_count >= triangle_count - target_triangle_count
+                || collapse.cost > pass_max_cost) {
+                break;
+            }
+            const auto v = collapse.v;
+            const auto u = collapse.u;
+            if (touched[v] || touched[u]) {
+                continue;
+            }
+
+            // The edge's triangles go, and no other triangle may fold over.
+            // Sharing more neighbors than triangles would leave a fin.
+            auto shared_count = 0u;
+            auto turns = false;
+            for (const auto t : triangles_of(v)) {
+                const auto* triangle = &result[t * 3];
+                if (triangle[0] == u || triangle[1] == u || triangle[2] == u) {
+                    shared_count++;
+                    continue;
+                }
+                auto moved = std::array<float3, 3>();
+                for (uint corner = 0; corner < 3; corner++) {
+                    moved[corner] = positions[triangle[corner] == v ? u : triangle[corner]];
+                }
+                const auto before = triangle_normal(
+                    positions[triangle[0]],
+                    positions[triangle[1]],
+                    positions[triangle[2]]
+                );
+                const auto after = triangle_normal(moved[0], moved[1], moved[2]);
+                const auto lengths = std::sqrt(float3_dot(before, before))
+                    * std::sqrt(float3_dot(after, after));
+                if (float3_dot(before, after) <= MIN_TRIANGLE_TURN_COS * lengths) {
+                    turns = true;
+                    break;
+                }
+            }
+            if (turns) {
+                continue;
+            }
+            neighbors_of(v, v_neighbors);
+            neighbors_of(u, u_neighbors);
+            auto common_count = 0u;
+            for (const auto neighbor : v_neighbors) {
+                if (neighbor != u
+                    && std::binary_search(u_neighbors.begin(), u_neighbors.end(), neighbor)) {
+                    common_count++;
+                }
+            }
+            if (common_count != shared_count) {
+                continue;
+            }
+
+            remap[v] = u;
+            quadrics[u] = quadrics[u] + quadrics[v];
+            touched[v] = true;
+            touched[u] = true;
+            for (const auto neighbor : v_neighbors) {
+                touched[neighbor] = true;
+            }
+            removed_count += shared_count;
+            error = std::max(error, (float)std::sqrt(collapse.cost));
+        }
+        if (removed_count == 0) {
+            break;
+        }
+
+        // Drop the triangles that collapsed.
+        auto kept_count = size_t(0);
+        for (size_t i = 0; i < result.size(); i += 3) {
+            const auto a = remap[result[i + 0]];
+            const auto b = remap[result[i + 1]];
+            const auto c = remap[result[i + 2]];
+            if (a == b || b == c || c == a) {
+                continue;
+            }
+            result[kept_count++] = a;
+            result[kept_count++] = b;
+            result[kept_count++] = c;
+        }
+        result.resize(kept_count);
+    }
+    return {std::move(result), error};
+}
+
+//
+// Levels of detail.
+//
+
+auto build_lods(
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes,
+    Span<const float3> positions,
+    const AssetLodChain& chain
+) -> MeshLods {
+    FB_BAKE_ZONE("lods");
+    FB_ASSERT(chain.level_count <= MAX_LOD_LEVEL_COUNT);
+    auto lods = MeshLods();
+    if (chain.level_count == 0 || positions.empty()) {
+        return lods;
+    }
+    const auto vertex_count = (uint)positions.size();
+
+    // Vertices of more than one submesh.
+    static constexpr uint NO_SUBMESH = ~0u;
+    auto vertex_submeshes = std::vector<uint>(vertex_count, NO_SUBMESH);
+    auto locked_vertices = std::vector<uint8_t>(vertex_count, 0);
+    auto source_triangle_count = 0u;
+    for (uint s = 0; s < submeshes.size(); s++) {
+        const auto& submesh = submeshes[s];
+        FB_ASSERT(submesh.start_index + submesh.index_count <= indices.size());
+        for (uint i = 0; i < submesh.index_count; i++) {
+            const auto v = indices[submesh.start_index + i] + submesh.base_vertex;
+            FB_ASSERT(v < vertex_count);
+            if (vertex_submeshes[v] == NO_SUBMESH) {
+                vertex_submeshes[v] = s;
+            } else if (vertex_submeshes[v] != s) {
+                locked_vertices[v] = 1;
+            }
+        }
+        source_triangle_count += submesh.index_count / 3;
+    }
+
+    // Errors are relative to the largest extent.
+    auto min_position = positions[0];
+    auto max_position = positions[0];
+    for (const auto& position : positions) {
+        for (uint axis = 0; axis < 3; axis++) {
+            min_position[axis] = std::min(min_position[axis], position[axis]);
+            max_position[axis] = std::max(max_position[axis], position[axis]);
+        }
+    }
+    const auto extents = max_position - min_position;
+    const auto extent = std::max(extents.x, std::max(extents.y, extents.z));
+
+    // Levels, each from the mesh itself.
+    auto previous_triangle_count = source_triangle_count;
+    auto previous_error = 0.0f;
+    for (uint level_index = 0; level_index < chain.level_count; level_index++) {
+        const auto& level = chain.levels[level_index];
+        auto level_indices = std::vector<AssetIndex>();
+        auto level_submeshes = std::vector<AssetSubmesh>();
+        auto level_error = previous_error;
+        for (const auto& submesh : submeshes) {
+            auto submesh_indices = std::vector<AssetIndex>(submesh.index_count);
+            for (uint i = 0; i < submesh.index_count; i++) {
+                submesh_indices[i] = indices[submesh.start_index + i] + submesh.base_vertex;
+            }
+            const auto target_triangle_count =
+                (uint)(level.triangle_ratio * (float)(submesh.index_count / 3));
+            auto [simplified, error] = simplify_triangles(
+                submesh_indices,
+                positions,
+                locked_vertices,
+                target_triangle_count,
+                level.max_error * extent
+            );
+            optimize_vertex_cache(Span<AssetIndex>(simplified), vertex_count);
+            level_submeshes.push_back(
+                AssetSubmesh {
+                    .index_count = (uint)simplified.size(),
+                    .start_index = (uint)(lods.indices.size() + level_indices.size()),
+                    .base_vertex = submesh.base_vertex,
+                }
+            );
+            for (const auto index : simplified) {
+                level_indices.push_back(index - submesh.base_vertex);
+            }
+            level_error = std::max(level_error, error);
+        }
+
+        // Drop levels that barely simplify.
+        const auto level_triangle_count = (uint)(level_indices.size() / 3);
+        if ((float)level_triangle_count > LOD_MAX_TRIANGLE_RATIO * (float)previous_triangle_count) {
+            continue;
+        }
+        lods.lods.push_back(
+            AssetMeshLod {
+                .start_submesh = (uint)lods.submeshes.size(),
+                .error = level_error,
+            }
+        );
+        lods.indices.insert(lods.indices.end(), level_indices.begin(), level_indices.end());
+        lods.submeshes.insert(lods.submeshes.end(), level_submeshes.begin(), level_submeshes.end());
+        previous_triangle_count = level_triangle_count;
+        previous_error = level_error;
+    }
+    return lods;
+}
+
+} // namespace fb
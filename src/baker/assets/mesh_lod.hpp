@@ -0,0 +1,73 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace fb {
+
+// A level of detail keeps about `triangle_ratio` of the triangles of the mesh,
+// as long as its surface strays by no more than `max_error` from the mesh's,
+// relative to the largest extent of the mesh's bounds.
+struct AssetLodLevel {
+    float triangle_ratio;
+    float max_error;
+};
+
+// Levels of detail to bake after the mesh itself, each simplified from the
+// mesh. Levels that keep more than `LOD_MAX_TRIANGLE_RATIO` of the triangles
+// of the level before them are dropped.
+inline constexpr uint MAX_LOD_LEVEL_COUNT = 7;
+inline constexpr float LOD_MAX_TRIANGLE_RATIO = 0.9f;
+
+struct AssetLodChain {
+    uint level_count = 0;
+    std::array<AssetLodLevel, MAX_LOD_LEVEL_COUNT> levels = {};
+};
+
+// Levels of detail of a mesh, over the mesh's vertices. Every level has one
+// submesh per submesh of the mesh, with indices from `indices`.
+struct MeshLods {
+    std::vector<AssetIndex> indices;
+    std::vector<AssetSubmesh> submeshes;
+    std::vector<AssetMeshLod> lods;
+};
+
+// Collapses edges of a triangle list onto one of their vertices, cheapest
+// first by quadric error (Garland and Heckbert, "Surface Simplification Using
+// Quadric Error Metrics"), until at most `target_triangle_count` triangles are
+// left or the next collapse would stray by more than `max_error`. Borders only
+// collapse along themselves. Vertices that share their position with another
+// vertex, which are attribute seams, and vertices whose `locked_vertices` is
+// set don't move. No vertex is created, so vertex attributes are kept as they
+// are. Returns the indices and the error, in position units.
+auto simplify_triangles(
+    Span<const AssetIndex> indices,
+    Span<const float3> positions,
+    Span<const uint8_t> locked_vertices,
+    uint target_triangle_count,
+    float max_error
+) -> std::tuple<std::vector<AssetIndex>, float>;
+
+// Simplifies every submesh for every level of `chain`. Vertices used by more
+// than one submesh are locked, so that submeshes don't crack apart.
+auto build_lods(
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes,
+    Span<const float3> positions,
+    const AssetLodChain& chain
+) -> MeshLods;
+
+template<typename Vertex>
+auto build_mesh_lods(
+    Span<const Vertex> vertices,
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes,
+    const AssetLodChain& chain
+) -> MeshLods {
+    auto positions = std::vector<float3>(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        positions[i] = vertices[i].position;
+    }
+    return build_lods(indices, submeshes, positions, chain);
+}
+
+} // namespace fb
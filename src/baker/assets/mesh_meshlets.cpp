@@ -0,0 +1,191 @@
+#include "mesh_meshlets.hpp"
+#include "../utils/profiler.hpp"
+
+namespace fb {
+
+static constexpr uint NO_LOCAL_VERTEX = ~0u;
+
+// Normal cones wider than this, as the cosine of their half angle, cull too
+// little to be worth testing, and are left empty.
+static constexpr float MIN_CONE_COS_ANGLE = 0.1f;
+
+// Sphere through the two farthest of the extreme points along each axis,
+// grown to cover every point (Ritter, "An Efficient Bounding Sphere"). The
+// radius is then shrunk to the farthest point.
+static auto bounding_sphere(Span<const float3> points) -> std::tuple<float3, float> {
+    FB_ASSERT(!points.empty());
+    auto min_points = std::array<float3, 3> {points[0], points[0], points[0]};
+    auto max_points = std::array<float3, 3> {points[0], points[0], points[0]};
+    for (const auto& point : points) {
+        for (uint axis = 0; axis < 3; axis++) {
+            if (point[axis] < min_points[axis][axis]) {
+                min_points[axis] = point;
+            }
+            if (point[axis] > max_points[axis][axis]) {
+                max_points[axis] = point;
+            }
+        }
+    }
+    auto widest_axis = 0u;
+    auto widest_distance = 0.0f;
+    for (uint axis = 0; axis < 3; axis++) {
+        const auto distance = float3_distance(min_points[axis], max_points[axis]);
+        if (distance > widest_distance) {
+            widest_axis = axis;
+            widest_distance = distance;
+        }
+    }
+
+    auto center = (min_points[widest_axis] + max_points[widest_axis]) * 0.5f;
+    auto radius = widest_distance * 0.5f;
+    for (const auto& point : points) {
+        const auto distance = float3_distance(point, center);
+        if (distance > radius) {
+            const auto grown_radius = (radius + distance) * 0.5f;
+            center += (point - center) * ((grown_radius - radius) / distance);
+            radius = grown_radius;
+        }
+    }
+    radius = 0.0f;
+    for (const auto& point : points) {
+        radius = std::max(radius, float3_distance(point, center));
+    }
+    return {center, radius};
+}
+
+// Bounding sphere, and the cone that holds the normals of every triangle
+// (Kubisch, "Introduction to Turing Mesh Shaders"). The apex is placed so that
+// every triangle is backfacing from any point in the negative cone.
+static auto set_meshlet_bounds(
+    AssetMeshlet& meshlet,
+    Span<const uint> vertices,
+    Span<const uint> triangles,
+    Span<const float3> positions
+) -> void {
+    auto meshlet_positions = std::vector<float3>(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        meshlet_positions[i] = positions[vertices[i]];
+    }
+    const auto [center, radius] = bounding_sphere(meshlet_positions);
+    meshlet.center = center;
+    meshlet.radius = radius;
+    meshlet.cone_apex = center;
+    meshlet.cone_axis = float3(0.0f, 0.0f, 0.0f);
+    meshlet.cone_cutoff = 1.0f;
+
+    // Normals, none for degenerate triangles.
+    auto corners = std::vector<float3>();
+    auto normals = std::vector<float3>();
+    auto normal_sum = float3(0.0f, 0.0f, 0.0f);
+    for (const auto triangle : triangles) {
+        const auto local = unpack_meshlet_triangle(triangle);
+        const auto& p0 = meshlet_positions[local.x];
+        const auto& p1 = meshlet_positions[local.y];
+        const auto& p2 = meshlet_positions[local.z];
+        const auto normal = float3_cross(p1 - p0, p2 - p0);
+        const auto length = std::sqrt(float3_dot(normal, normal));
+        if (length == 0.0f) {
+            continue;
+        }
+        corners.push_back(p0);
+        normals.push_back(normal / length);
+        normal_sum += normals.back();
+    }
+    if (float3_dot(normal_sum, normal_sum) == 0.0f) {
+        return;
+    }
+
+    // Cone.
+    const auto axis = float3_normalize(normal_sum);
+    auto min_cos_angle = 1.0f;
+    for (const auto& normal : normals) {
+        min_cos_angle = std::min(min_cos_angle, float3_dot(normal, axis));
+    }
+    if (min_cos_angle <= MIN_CONE_COS_ANGLE) {
+        return;
+    }
+    auto apex_distance = 0.0f;
+    for (size_t i = 0; i < normals.size(); i++) {
+        const auto distance =
+            float3_dot(center - corners[i], normals[i]) / float3_dot(axis, normals[i]);
+        apex_distance = std::max(apex_distance, distance);
+    }
+    meshlet.cone_apex = center - axis * apex_distance;
+    meshlet.cone_axis = axis;
+    meshlet.cone_cutoff = std::sqrt(1.0f - min_cos_angle * min_cos_angle);
+}
+
+auto build_meshlets(
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes,
+    Span<const float3> positions
+) -> MeshletBuffers {
+    FB_BAKE_ZONE("meshlets");
+    static_assert(MESHLET_MAX_VERTEX_COUNT <= 256, "Local indices are 8 bits");
+    auto buffers = MeshletBuffers();
+
+    // Index of every vertex in the current meshlet.
+    auto local_vertices = std::vector<uint>(positions.size(), NO_LOCAL_VERTEX);
+    auto meshlet = AssetMeshlet {};
+    const auto finish_meshlet = [&]() {
+        if (meshlet.triangle_count == 0) {
+            return;
+        }
+        const auto vertices =
+            Span<const uint>(buffers.vertices).subspan(meshlet.vertex_offset);
+        const auto triangles =
+            Span<const uint>(buffers.triangles).subspan(meshlet.triangle_offset);
+        set_meshlet_bounds(meshlet, vertices, triangles, positions);
+        for (const auto vertex : vertices) {
+            local_vertices[vertex] = NO_LOCAL_VERTEX;
+        }
+        buffers.meshlets.push_back(meshlet);
+        meshlet = AssetMeshlet {
+            .vertex_offset = (uint)buffers.vertices.size(),
+            .triangle_offset = (uint)buffers.triangles.size(),
+        };
+    };
+
+    for (const auto& submesh : submeshes) {
+        FB_ASSERT(submesh.index_count % 3 == 0);
+        FB_ASSERT(submesh.start_index + submesh.index_count <= indices.size());
+        const auto start_meshlet = (uint)buffers.meshlets.size();
+        for (uint i = 0; i < submesh.index_count; i += 3) {
+            auto corners = std::array<uint, 3>();
+            for (uint corner = 0; corner < 3; corner++) {
+                corners[corner] = indices[submesh.start_index + i + corner] + submesh.base_vertex;
+                FB_ASSERT(corners[corner] < positions.size());
+            }
+            const auto [a, b, c] = corners;
+
+            // New vertices, once each.
+            const auto new_vertex_count = (uint)(local_vertices[a] == NO_LOCAL_VERTEX)
+                + (uint)(local_vertices[b] == NO_LOCAL_VERTEX && b != a)
+                + (uint)(local_vertices[c] == NO_LOCAL_VERTEX && c != a && c != b);
+            if (meshlet.vertex_count + new_vertex_count > MESHLET_MAX_VERTEX_COUNT
+                || meshlet.triangle_count == MESHLET_MAX_TRIANGLE_COUNT) {
+                finish_meshlet();
+            }
+            for (const auto vertex : corners) {
+                if (local_vertices[vertex] == NO_LOCAL_VERTEX) {
+                    local_vertices[vertex] = meshlet.vertex_count++;
+                    buffers.vertices.push_back(vertex);
+                }
+            }
+            buffers.triangles.push_back(
+                pack_meshlet_triangle(local_vertices[a], local_vertices[b], local_vertices[c])
+            );
+            meshlet.triangle_count++;
+        }
+        finish_meshlet();
+        buffers.submeshes.push_back(
+            AssetMeshletSubmesh {
+                .meshlet_count = (uint)buffers.meshlets.size() - start_meshlet,
+                .start_meshlet = start_meshlet,
+            }
+        );
+    }
+    return buffers;
+}
+
+} // namespace fb
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace fb {
+
+// Meshlets of a mesh, and the vertices and triangles they point into.
+// Meshlet vertices are vertices of the mesh, with the base vertex of their
+// submesh applied. Triangles are three indices into the vertices of their
+// meshlet, packed by `pack_meshlet_triangle`.
+struct MeshletBuffers {
+    std::vector<AssetMeshlet> meshlets;
+    std::vector<uint> vertices;
+    std::vector<uint> triangles;
+    std::vector<AssetMeshletSubmesh> submeshes;
+};
+
+inline constexpr auto pack_meshlet_triangle(uint a, uint b, uint c) -> uint {
+    return a | (b << 8) | (c << 16);
+}
+
+inline constexpr auto unpack_meshlet_triangle(uint triangle) -> uint3 {
+    return {triangle & 0xff, (triangle >> 8) & 0xff, (triangle >> 16) & 0xff};
+}
+
+// Splits every submesh into meshlets of at most `MESHLET_MAX_VERTEX_COUNT`
+// vertices and `MESHLET_MAX_TRIANGLE_COUNT` triangles. Triangles are taken in
+// index order, which `optimize_mesh` already made local, and a meshlet ends
+// when the next triangle doesn't fit. Meshlets don't span submeshes.
+auto build_meshlets(
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes,
+    Span<const float3> positions
+) -> MeshletBuffers;
+
+template<typename Vertex>
+auto build_mesh_meshlets(
+    Span<const Vertex> vertices,
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes
+) -> MeshletBuffers {
+    auto positions = std::vector<float3>(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        positions[i] = vertices[i].position;
+    }
+    return build_meshlets(indices, submeshes, positions);
+}
+
+} // namespace fb
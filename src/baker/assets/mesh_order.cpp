@@ -0,0 +1,418 @@
+#include "mesh_order.hpp"
+#include "../utils/profiler.hpp"
+
+#include <numeric>
+
+namespace fb {
+
+//
+// Cache simulation.
+//
+
+// FIFO cache of `VERTEX_CACHE_FIFO_SIZE`, as the time every vertex entered it.
+// A vertex is still in it until as many others entered after it.
+class FifoCache {
+public:
+    explicit FifoCache(uint vertex_count)
+        : _entry_times(vertex_count, 0) {}
+
+    auto reset() -> void { _time += VERTEX_CACHE_FIFO_SIZE + 1; }
+
+    auto miss_count(AssetIndex index) -> uint {
+        FB_ASSERT(index < _entry_times.size());
+        if (_time - _entry_times[index] <= VERTEX_CACHE_FIFO_SIZE) {
+            return 0;
+        }
+        _entry_times[index] = _time++;
+        return 1;
+    }
+
+    auto triangle_miss_count(const AssetIndex* triangle) -> uint {
+        return miss_count(triangle[0]) + miss_count(triangle[1]) + miss_count(triangle[2]);
+    }
+
+private:
+    std::vector<uint> _entry_times;
+    uint _time = VERTEX_CACHE_FIFO_SIZE + 1;
+};
+
+auto vertex_cache_miss_count(Span<const AssetIndex> indices, uint vertex_count) -> uint {
+    auto cache = FifoCache(vertex_count);
+    auto miss_count = 0u;
+    for (const auto index : indices) {
+        miss_count += cache.miss_count(index);
+    }
+    return miss_count;
+}
+
+//
+// Vertex cache.
+//
+
+static constexpr float CACHE_DECAY_POWER = 1.5f;
+static constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+static constexpr float VALENCE_BOOST_POWER = 0.5f;
+static constexpr uint NO_TRIANGLE = ~0u;
+
+// Vertices of the last triangle score the same, so that the next one doesn't
+// favor one of its edges. Vertices with few triangles left get a boost, so
+// that lone triangles aren't left behind.
+static auto vertex_score(int cache_position, uint valence) -> float {
+    if (valence == 0) {
+        return -1.0f;
+    }
+    auto score = 0.0f;
+    if (cache_position >= 0 && cache_position < 3) {
+        score = LAST_TRIANGLE_SCORE;
+    } else if (cache_position >= 3) {
+        const auto scale = 1.0f / (float)(VERTEX_CACHE_LRU_SIZE - 3);
+        score = std::pow(1.0f - (float)(cache_position - 3) * scale, CACHE_DECAY_POWER);
+    }
+    return score + VALENCE_BOOST_SCALE * std::pow((float)valence, -VALENCE_BOOST_POWER);
+}
+
+auto optimize_vertex_cache(Span<AssetIndex> indices, uint vertex_count) -> void {
+    FB_ASSERT(indices.size() % 3 == 0);
+    const auto triangle_count = indices.size() / 3;
+    if (triangle_count == 0) {
+        return;
+    }
+
+    // Triangles of every vertex.
+    auto valences = std::vector<uint>(vertex_count, 0);
+    for (const auto index : indices) {
+        FB_ASSERT(index < vertex_count);
+        valences[index]++;
+    }
+    auto offsets = std::vector<uint>(vertex_count + 1, 0);
+    for (uint v = 0; v < vertex_count; v++) {
+        offsets[v + 1] = offsets[v] + valences[v];
+    }
+    auto vertex_triangles = std::vector<uint>(indices.size());
+    {
+        auto cursors = std::vector<uint>(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < indices.size(); i++) {
+            vertex_triangles[cursors[indices[i]]++] = (uint)(i / 3);
+        }
+    }
+
+    // Scores.
+    auto cache_positions = std::vector<int>(vertex_count, -1);
+    auto vertex_scores = std::vector<float>(vertex_count);
+    for (uint v = 0; v < vertex_count; v++) {
+        vertex_scores[v] = vertex_score(-1, valences[v]);
+    }
+    const auto triangle_score = [&](size_t t) {
+        return vertex_scores[indices[t * 3 + 0]] + vertex_scores[indices[t * 3 + 1]]
+            + vertex_scores[indices[t * 3 + 2]];
+    };
+    auto triangle_scores = std::vector<float>(triangle_count);
+    auto best = NO_TRIANGLE;
+    for (size_t t = 0; t < triangle_count; t++) {
+        triangle_scores[t] = triangle_score(t);
+        if (best == NO_TRIANGLE || triangle_scores[t] > triangle_scores[best]) {
+            best = (uint)t;
+        }
+    }
+
+    // Emit the best triangle, then rescore the vertices whose cache position
+    // changed, and pick the next best among their triangles.
+    auto emitted = std::vector<bool>(triangle_count, false);
+    auto output = std::vector<AssetIndex>();
+    output.reserve(indices.size());
+    auto cache = std::vector<AssetIndex>();
+    auto next_cache = std::vector<AssetIndex>();
+    auto evicted = std::vector<AssetIndex>();
+    auto cursor = size_t(0);
+    for (size_t emitted_count = 0; emitted_count < triangle_count; emitted_count++) {
+        // Dead end, take the next triangle in input order.
+        if (best == NO_TRIANGLE) {
+            while (emitted[cursor]) {
+                cursor++;
+            }
+            best = (uint)cursor;
+        }
+
+        // Emit.
+        const auto* triangle = &indices[best * 3];
+        emitted[best] = true;
+        output.insert(output.end(), triangle, triangle + 3);
+        for (uint k = 0; k < 3; k++) {
+            valences[triangle[k]]--;
+        }
+
+        // Triangle first, then the rest of the cache in LRU order.
+        next_cache.clear();
+        for (uint k = 0; k < 3; k++) {
+            if (std::find(next_cache.begin(), next_cache.end(), triangle[k]) == next_cache.end()) {
+                next_cache.push_back(triangle[k]);
+            }
+        }
+        for (const auto v : cache) {
+            if (v != triangle[0] && v != triangle[1] && v != triangle[2]) {
+                next_cache.push_back(v);
+            }
+        }
+        evicted.clear();
+        for (size_t i = VERTEX_CACHE_LRU_SIZE; i < next_cache.size(); i++) {
+            evicted.push_back(next_cache[i]);
+            cache_positions[next_cache[i]] = -1;
+            vertex_scores[next_cache[i]] = vertex_score(-1, valences[next_cache[i]]);
+        }
+        next_cache.resize(std::min(next_cache.size(), (size_t)VERTEX_CACHE_LRU_SIZE));
+        std::swap(cache, next_cache);
+        for (size_t i = 0; i < cache.size(); i++) {
+            cache_positions[cache[i]] = (int)i;
+            vertex_scores[cache[i]] = vertex_score((int)i, valences[cache[i]]);
+        }
+
+        // Rescore, ties go to the earlier triangle.
+        best = NO_TRIANGLE;
+        const auto rescore = [&](AssetIndex v) {
+            for (uint i = offsets[v]; i < offsets[v + 1]; i++) {
+                const auto t = vertex_triangles[i];
+                if (emitted[t]) {
+                    continue;
+                }
+                triangle_scores[t] = triangle_score(t);
+                if (best == NO_TRIANGLE || triangle_scores[t] > triangle_scores[best]
+                    || (triangle_scores[t] == triangle_scores[best] && t < best)) {
+                    best = t;
+                }
+            }
+        };
+        for (const auto v : cache) {
+            rescore(v);
+        }
+        for (const auto v : evicted) {
+            rescore(v);
+        }
+    }
+
+    std::copy(output.begin(), output.end(), indices.begin());
+}
+
+//
+// Overdraw.
+//
+
+auto optimize_overdraw(Span<AssetIndex> indices, Span<const float3> positions, float threshold)
+    -> void {
+    FB_ASSERT(indices.size() % 3 == 0);
+    const auto triangle_count = (uint)(indices.size() / 3);
+    if (triangle_count < 2) {
+        return;
+    }
+    auto cache = FifoCache((uint)positions.size());
+
+    // Hard boundaries, where all three vertices miss, which is usually a new
+    // patch of the mesh.
+    auto hard_starts = std::vector<uint>();
+    for (uint t = 0; t < triangle_count; t++) {
+        if (cache.triangle_miss_count(&indices[t * 3]) == 3 || t == 0) {
+            hard_starts.push_back(t);
+        }
+    }
+    hard_starts.push_back(triangle_count);
+
+    // Soft boundaries, wherever the misses of the cluster so far, with a cold
+    // cache, are within the threshold of the whole hard cluster.
+    auto cluster_starts = std::vector<uint>();
+    for (size_t h = 0; h + 1 < hard_starts.size(); h++) {
+        const auto start = hard_starts[h];
+        const auto end = hard_starts[h + 1];
+        cache.reset();
+        auto miss_count = 0u;
+        for (uint t = start; t < end; t++) {
+            miss_count += cache.triangle_miss_count(&indices[t * 3]);
+        }
+        const auto threshold_acmr = (float)miss_count / (float)(end - start) * threshold;
+
+        cache.reset();
+        auto cluster_start = start;
+        auto cluster_miss_count = 0u;
+        cluster_starts.push_back(start);
+        for (uint t = start; t + 1 < end; t++) {
+            cluster_miss_count += cache.triangle_miss_count(&indices[t * 3]);
+            const auto acmr = (float)cluster_miss_count / (float)(t + 1 - cluster_start);
+            if (acmr <= threshold_acmr) {
+                cluster_start = t + 1;
+                cluster_starts.push_back(cluster_start);
+                cluster_miss_count = 0;
+                cache.reset();
+            }
+        }
+    }
+    cluster_starts.push_back(triangle_count);
+    const auto cluster_count = cluster_starts.size() - 1;
+
+    // Area weighted centroids and normals.
+    struct Cluster {
+        float3 centroid;
+        float3 normal;
+        float area;
+    };
+    auto clusters = std::vector<Cluster>(cluster_count);
+    auto mesh_centroid = FLOAT3_ZERO;
+    auto mesh_area = 0.0f;
+    for (size_t c = 0; c < cluster_count; c++) {
+        auto& cluster = clusters[c];
+        cluster = {FLOAT3_ZERO, FLOAT3_ZERO, 0.0f};
+        for (uint t = cluster_starts[c]; t < cluster_starts[c + 1]; t++) {
+            const auto p0 = positions[indices[t * 3 + 0]];
+            const auto p1 = positions[indices[t * 3 + 1]];
+            const auto p2 = positions[indices[t * 3 + 2]];
+            const auto normal = float3_cross(p1 - p0, p2 - p0);
+            const auto area = std::sqrt(float3_dot(normal, normal));
+            cluster.centroid += (p0 + p1 + p2) * (area / 3.0f);
+            cluster.normal += normal;
+            cluster.area += area;
+        }
+        mesh_centroid += cluster.centroid;
+        mesh_area += cluster.area;
+        if (cluster.area > 0.0f) {
+            cluster.centroid /= cluster.area;
+        }
+    }
+    if (mesh_area > 0.0f) {
+        mesh_centroid /= mesh_area;
+    }
+
+    // Clusters facing out of the mesh first, as they likely occlude the rest.
+    auto sort_keys = std::vector<float>(cluster_count, 0.0f);
+    for (size_t c = 0; c < cluster_count; c++) {
+        const auto& cluster = clusters[c];
+        const auto normal_length = std::sqrt(float3_dot(cluster.normal, cluster.normal));
+        if (cluster.area > 0.0f && normal_length > 0.0f) {
+            sort_keys[c] =
+                float3_dot(cluster.centroid - mesh_centroid, cluster.normal) / normal_length;
+        }
+    }
+    auto cluster_order = std::vector<uint>(cluster_count);
+    std::iota(cluster_order.begin(), cluster_order.end(), 0);
+    std::stable_sort(cluster_order.begin(), cluster_order.end(), [&](uint a, uint b) {
+        return sort_keys[a] > sort_keys[b];
+    });
+
+    auto output = std::vector<AssetIndex>();
+    output.reserve(indices.size());
+    for (const auto c : cluster_order) {
+        output.insert(
+            output.end(),
+            indices.begin() + cluster_starts[c] * 3,
+            indices.begin() + cluster_starts[c + 1] * 3
+        );
+    }
+    std::copy(output.begin(), output.end(), indices.begin());
+}
+
+//
+// Vertex fetch.
+//
+
+auto optimize_vertex_fetch(Span<AssetIndex> indices, uint vertex_count) -> std::vector<uint> {
+    static constexpr uint NO_VERTEX = ~0u;
+
+    auto remap = std::vector<uint>(vertex_count, NO_VERTEX);
+    auto vertex_order = std::vector<uint>();
+    vertex_order.reserve(vertex_count);
+    for (auto& index : indices) {
+        FB_ASSERT(index < vertex_count);
+        if (remap[index] == NO_VERTEX) {
+            remap[index] = (uint)vertex_order.size();
+            vertex_order.push_back(index);
+        }
+        index = remap[index];
+    }
+    for (uint v = 0; v < vertex_count; v++) {
+        if (remap[v] == NO_VERTEX) {
+            remap[v] = (uint)vertex_order.size();
+            vertex_order.push_back(v);
+        }
+    }
+    return vertex_order;
+}
+
+//
+// Mesh.
+//
+
+auto optimize_mesh_order(
+    Span<AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes,
+    Span<const float3> positions
+) -> std::tuple<std::vector<uint>, AssetMeshStats> {
+    FB_BAKE_ZONE("mesh order");
+
+    // Submeshes are drawn separately, each starts with a cold cache.
+    const auto vertex_count = (uint)positions.size();
+    const auto submesh_indices = [&](const AssetSubmesh& submesh) {
+        return indices.subspan(submesh.start_index, submesh.index_count);
+    };
+    const auto miss_count = [&]() {
+        auto count = 0u;
+        for (const auto& submesh : submeshes) {
+            const auto submesh_vertex_count = vertex_count - submesh.base_vertex;
+            count += vertex_cache_miss_count(submesh_indices(submesh), submesh_vertex_count);
+        }
+        return count;
+    };
+    auto stats = AssetMeshStats {
+        .source_vertex_count = vertex_count,
+        .vertex_count = vertex_count,
+        .triangle_count = (uint)(indices.size() / 3),
+        .source_miss_count = miss_count(),
+        .miss_count = 0,
+    };
+
+    // Triangles.
+    for (const auto& submesh : submeshes) {
+        const auto submesh_positions = positions.subspan(submesh.base_vertex);
+        const auto submesh_vertex_count = (uint)submesh_positions.size();
+        optimize_vertex_cache(submesh_indices(submesh), submesh_vertex_count);
+        optimize_overdraw(submesh_indices(submesh), submesh_positions, OVERDRAW_CACHE_THRESHOLD);
+    }
+
+    // Vertices.
+    auto vertex_order = std::vector<uint>();
+    const auto zero_based = std::all_of(submeshes.begin(), submeshes.end(), [](const auto& s) {
+        return s.base_vertex == 0;
+    });
+    if (zero_based) {
+        vertex_order = optimize_vertex_fetch(indices, vertex_count);
+    } else {
+        vertex_order.resize(vertex_count);
+        std::iota(vertex_order.begin(), vertex_order.end(), 0);
+    }
+
+    stats.miss_count = miss_count();
+    return {std::move(vertex_order), stats};
+}
+
+auto asset_mesh_stats(const Asset& asset) -> Option<AssetMeshStats> {
+    return std::visit(
+        overloaded {
+            [](const AssetMesh& a) -> Option<AssetMeshStats> { return a.stats; },
+            [](const AssetAnimationMesh& a) -> Option<AssetMeshStats> { return a.stats; },
+            [](const auto&) -> Option<AssetMeshStats> { return std::nullopt; },
+        },
+        asset
+    );
+}
+
+auto total_mesh_stats(Span<const Asset> assets) -> AssetMeshStats {
+    auto total = AssetMeshStats {};
+    for (const auto& asset : assets) {
+        if (const auto stats = asset_mesh_stats(asset); stats.has_value()) {
+            total.source_vertex_count += stats->source_vertex_count;
+            total.vertex_count += stats->vertex_count;
+            total.triangle_count += stats->triangle_count;
+            total.source_miss_count += stats->source_miss_count;
+            total.miss_count += stats->miss_count;
+        }
+    }
+    return total;
+}
+
+} // namespace fb
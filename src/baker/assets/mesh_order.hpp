@@ -0,0 +1,73 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace fb {
+
+// Entries of the FIFO post-transform vertex cache that stats and overdraw
+// clusters simulate, a conservative size for current GPUs.
+inline constexpr uint VERTEX_CACHE_FIFO_SIZE = 16;
+
+// Entries of the LRU cache the triangle order is optimized for. Its scores
+// favor recent vertices, which also hit in smaller FIFO caches.
+inline constexpr uint VERTEX_CACHE_LRU_SIZE = 32;
+
+// Overdraw clusters may be this much worse than the cache order they split,
+// in misses per triangle.
+inline constexpr float OVERDRAW_CACHE_THRESHOLD = 1.05f;
+
+// Misses of a FIFO cache of `VERTEX_CACHE_FIFO_SIZE`, starting empty.
+auto vertex_cache_miss_count(Span<const AssetIndex> indices, uint vertex_count) -> uint;
+
+// Reorders triangles for vertex cache locality (Forsyth, "Linear-Speed Vertex
+// Cache Optimisation"). Ties go to the earlier triangle, so the order only
+// depends on the input.
+auto optimize_vertex_cache(Span<AssetIndex> indices, uint vertex_count) -> void;
+
+// Splits the triangles, in cache order, into clusters where the cache restarts
+// or where the misses so far stay within `threshold` of the whole, then sorts
+// clusters so that the ones facing out of the mesh draw first (Sander et al.,
+// "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw").
+auto optimize_overdraw(Span<AssetIndex> indices, Span<const float3> positions, float threshold)
+    -> void;
+
+// Renumbers vertices in order of first use, unused ones last. Returns the
+// source vertex of every new vertex.
+auto optimize_vertex_fetch(Span<AssetIndex> indices, uint vertex_count) -> std::vector<uint>;
+
+// Runs the three passes above on a mesh. Triangles stay in their submesh.
+// Vertices are only renumbered if every submesh starts at vertex 0, as the
+// ranges of the others aren't known. Returns the source vertex of every
+// vertex, and the stats before and after.
+auto optimize_mesh_order(
+    Span<AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes,
+    Span<const float3> positions
+) -> std::tuple<std::vector<uint>, AssetMeshStats>;
+
+// Stats of a mesh or animation mesh, none for other assets.
+auto asset_mesh_stats(const Asset& asset) -> Option<AssetMeshStats>;
+
+// Sum of the stats of every mesh and animation mesh.
+auto total_mesh_stats(Span<const Asset> assets) -> AssetMeshStats;
+
+template<typename Vertex>
+auto optimize_mesh(
+    std::vector<Vertex>& vertices,
+    Span<AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes
+) -> AssetMeshStats {
+    auto positions = std::vector<float3>(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        positions[i] = vertices[i].position;
+    }
+    const auto [vertex_order, stats] = optimize_mesh_order(indices, submeshes, positions);
+    auto ordered_vertices = std::vector<Vertex>(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        ordered_vertices[i] = vertices[vertex_order[i]];
+    }
+    vertices = std::move(ordered_vertices);
+    return stats;
+}
+
+} // namespace fb
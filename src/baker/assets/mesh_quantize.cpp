@@ -0,0 +1,195 @@
+#include "mesh_quantize.hpp"
+#include "../utils/profiler.hpp"
+
+namespace fb {
+
+// Decoders, as in `baked_types.hpp`, which the baker doesn't include.
+
+static auto decode_snorm16(uint bits) -> float {
+    return std::max((float)(int16_t)(bits & 0xffff) / 32767.0f, -1.0f);
+}
+
+static auto decode_octahedral(float2 e) -> float3 {
+    auto n = float3(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+    const auto t = std::max(-n.z, 0.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return float3_normalize(n);
+}
+
+static auto tangent_basis(float3 n) -> std::tuple<float3, float3> {
+    const auto z_sign = n.z >= 0.0f ? 1.0f : -1.0f;
+    const auto a = -1.0f / (z_sign + n.z);
+    const auto b = n.x * n.y * a;
+    return {
+        float3(1.0f + z_sign * n.x * n.x * a, z_sign * b, -z_sign * n.x),
+        float3(b, z_sign + n.y * n.y * a, -n.y),
+    };
+}
+
+// Encoders.
+
+static auto encode_unorm16(float v) -> uint {
+    return (uint)std::round(std::clamp(v, 0.0f, 1.0f) * 65535.0f);
+}
+
+// Octahedral encoding (Cigolle et al., "A Survey of Efficient Representations
+// for Independent Unit Vectors"), rounded to whichever of the four snorm16
+// neighbors decodes closest to `n`.
+static auto encode_octahedral(float3 n) -> uint {
+    n /= std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    auto e = float2(n.x, n.y);
+    if (n.z < 0.0f) {
+        e = float2(
+            (1.0f - std::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f),
+            (1.0f - std::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f)
+        );
+    }
+
+    auto best_bits = 0u;
+    auto best_dot = -2.0f;
+    const auto x = std::clamp(e.x, -1.0f, 1.0f) * 32767.0f;
+    const auto y = std::clamp(e.y, -1.0f, 1.0f) * 32767.0f;
+    for (const auto qx : {std::floor(x), std::ceil(x)}) {
+        for (const auto qy : {std::floor(y), std::ceil(y)}) {
+            const auto bits = ((uint)(int)qx & 0xffff) | (((uint)(int)qy & 0xffff) << 16);
+            const auto decoded =
+                decode_octahedral(float2(decode_snorm16(bits), decode_snorm16(bits >> 16)));
+            const auto dot = float3_dot(decoded, n);
+            if (dot > best_dot) {
+                best_bits = bits;
+                best_dot = dot;
+            }
+        }
+    }
+    return best_bits;
+}
+
+auto vertex_quantization(Span<const float3> positions) -> AssetVertexQuantization {
+    if (positions.empty()) {
+        return {};
+    }
+    auto min = positions[0];
+    auto max = positions[0];
+    for (const auto& position : positions) {
+        for (uint axis = 0; axis < 3; axis++) {
+            min[axis] = std::min(min[axis], position[axis]);
+            max[axis] = std::max(max[axis], position[axis]);
+        }
+    }
+    return AssetVertexQuantization {
+        .position_min = min,
+        .position_scale = (max - min) / 65535.0f,
+    };
+}
+
+auto compact_vertex(const AssetVertex& vertex, const AssetVertexQuantization& quantization)
+    -> AssetCompactVertex {
+    // Position.
+    auto position = std::array<uint, 3>();
+    for (uint axis = 0; axis < 3; axis++) {
+        const auto scale = quantization.position_scale[axis];
+        const auto offset = vertex.position[axis] - quantization.position_min[axis];
+        position[axis] = scale > 0.0f ? encode_unorm16(offset / (scale * 65535.0f)) : 0;
+    }
+
+    // Normal, then the tangent around the normal as decoded.
+    const auto normal_bits = encode_octahedral(vertex.normal);
+    const auto normal =
+        decode_octahedral(float2(decode_snorm16(normal_bits), decode_snorm16(normal_bits >> 16)));
+    const auto [t0, t1] = tangent_basis(normal);
+    const auto source_tangent = float3(vertex.tangent.x, vertex.tangent.y, vertex.tangent.z);
+    const auto tangent = source_tangent - normal * float3_dot(normal, source_tangent);
+    const auto angle = std::atan2(float3_dot(tangent, t1), float3_dot(tangent, t0));
+    auto tangent_bits = (uint)std::round((angle + FLOAT_PI) / (2.0f * FLOAT_PI) * 32767.0f);
+    tangent_bits = std::min(tangent_bits, 0x7fffu) | (vertex.tangent.w < 0.0f ? 0x8000u : 0u);
+
+    return AssetCompactVertex {
+        .position_xy = position[0] | (position[1] << 16),
+        .position_z_tangent = position[2] | (tangent_bits << 16),
+        .normal = normal_bits,
+        .texcoord = (uint)half_from_float(vertex.texcoord.x)
+            | ((uint)half_from_float(vertex.texcoord.y) << 16),
+    };
+}
+
+auto compact_skinning_vertex(
+    const AssetSkinningVertex& vertex,
+    const AssetVertexQuantization& quantization
+) -> AssetCompactSkinningVertex {
+    // Weights, normalized to 255.
+    auto weight_sum = 0.0f;
+    for (uint i = 0; i < 4; i++) {
+        weight_sum += std::max(vertex.weight[i], 0.0f);
+    }
+    auto weights = std::array<uint, 4>();
+    auto largest = 0u;
+    auto total = 0u;
+    for (uint i = 0; i < 4; i++) {
+        const auto weight = std::max(vertex.weight[i], 0.0f);
+        weights[i] = weight_sum > 0.0f ? (uint)std::round(weight / weight_sum * 255.0f) : 0;
+        total += weights[i];
+        if (weights[i] > weights[largest]) {
+            largest = i;
+        }
+    }
+    if (total > 0) {
+        weights[largest] = weights[largest] + 255 - total;
+    }
+
+    auto joints = 0u;
+    auto packed_weights = 0u;
+    for (uint i = 0; i < 4; i++) {
+        FB_ASSERT(vertex.joint[i] < MAX_COMPACT_JOINT_COUNT);
+        joints |= vertex.joint[i] << (i * 8);
+        packed_weights |= weights[i] << (i * 8);
+    }
+    return AssetCompactSkinningVertex {
+        .vertex = compact_vertex(
+            AssetVertex {
+                .position = vertex.position,
+                .normal = vertex.normal,
+                .texcoord = vertex.texcoord,
+                .tangent = vertex.tangent,
+            },
+            quantization
+        ),
+        .joints = joints,
+        .weights = packed_weights,
+    };
+}
+
+auto compact_vertices(Span<const AssetVertex> vertices) -> CompactVertices<AssetCompactVertex> {
+    FB_BAKE_ZONE("compact vertices");
+    auto positions = std::vector<float3>(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        positions[i] = vertices[i].position;
+    }
+    auto compact = CompactVertices<AssetCompactVertex> {
+        .quantization = vertex_quantization(positions),
+        .vertices = std::vector<AssetCompactVertex>(vertices.size()),
+    };
+    for (size_t i = 0; i < vertices.size(); i++) {
+        compact.vertices[i] = compact_vertex(vertices[i], compact.quantization);
+    }
+    return compact;
+}
+
+auto compact_vertices(Span<const AssetSkinningVertex> vertices)
+    -> CompactVertices<AssetCompactSkinningVertex> {
+    FB_BAKE_ZONE("compact vertices");
+    auto positions = std::vector<float3>(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        positions[i] = vertices[i].position;
+    }
+    auto compact = CompactVertices<AssetCompactSkinningVertex> {
+        .quantization = vertex_quantization(positions),
+        .vertices = std::vector<AssetCompactSkinningVertex>(vertices.size()),
+    };
+    for (size_t i = 0; i < vertices.size(); i++) {
+        compact.vertices[i] = compact_skinning_vertex(vertices[i], compact.quantization);
+    }
+    return compact;
+}
+
+} // namespace fb
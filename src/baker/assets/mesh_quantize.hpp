@@ -0,0 +1,36 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace fb {
+
+// Compact joints are uint8.
+inline constexpr uint MAX_COMPACT_JOINT_COUNT = 256;
+
+template<typename CompactVertex>
+struct CompactVertices {
+    AssetVertexQuantization quantization;
+    std::vector<CompactVertex> vertices;
+};
+
+// Bounds of the positions, which compact positions are quantized within.
+auto vertex_quantization(Span<const float3> positions) -> AssetVertexQuantization;
+
+// Quantizes a vertex to the layout of `baked::CompactVertex`. Normals take the
+// closest of the octahedral encodings around theirs, and tangents are made
+// orthogonal to the decoded normal before they are turned into an angle.
+auto compact_vertex(const AssetVertex& vertex, const AssetVertexQuantization& quantization)
+    -> AssetCompactVertex;
+
+// Weights are normalized, and their rounding error goes to the largest one,
+// so that they still sum to 1. Joints must be under `MAX_COMPACT_JOINT_COUNT`.
+auto compact_skinning_vertex(
+    const AssetSkinningVertex& vertex,
+    const AssetVertexQuantization& quantization
+) -> AssetCompactSkinningVertex;
+
+auto compact_vertices(Span<const AssetVertex> vertices) -> CompactVertices<AssetCompactVertex>;
+auto compact_vertices(Span<const AssetSkinningVertex> vertices)
+    -> CompactVertices<AssetCompactSkinningVertex>;
+
+} // namespace fb
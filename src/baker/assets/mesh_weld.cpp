@@ -0,0 +1,48 @@
+#include "mesh_weld.hpp"
+#include "../utils/profiler.hpp"
+
+namespace fb {
+
+auto weld_keys(Span<const std::byte> keys, size_t key_size) -> std::vector<uint> {
+    FB_BAKE_ZONE("weld");
+    FB_ASSERT(key_size > 0 && keys.size() % key_size == 0);
+    static constexpr uint EMPTY_SLOT = ~0u;
+
+    // Open addressing with linear probing, at most half full. Slots hold the
+    // first key of every distinct key, and the vertex it became.
+    struct Slot {
+        uint key_index;
+        uint vertex;
+    };
+    const auto key_count = keys.size() / key_size;
+    auto slot_count = size_t(16);
+    while (slot_count < 2 * key_count) {
+        slot_count *= 2;
+    }
+    const auto slot_mask = slot_count - 1;
+    auto slots = std::vector<Slot>(slot_count, Slot {EMPTY_SLOT, 0});
+
+    auto remap = std::vector<uint>(key_count);
+    auto vertex_count = 0u;
+    for (size_t i = 0; i < key_count; i++) {
+        const auto key = keys.subspan(i * key_size, key_size);
+        auto slot_index = hash128(key).low & slot_mask;
+        for (;;) {
+            auto& slot = slots[slot_index];
+            if (slot.key_index == EMPTY_SLOT) {
+                slot = Slot {(uint)i, vertex_count++};
+                remap[i] = slot.vertex;
+                break;
+            }
+            const auto other = keys.subspan(slot.key_index * key_size, key_size);
+            if (std::memcmp(key.data(), other.data(), key_size) == 0) {
+                remap[i] = slot.vertex;
+                break;
+            }
+            slot_index = (slot_index + 1) & slot_mask;
+        }
+    }
+    return remap;
+}
+
+} // namespace fb
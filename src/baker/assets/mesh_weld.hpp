@@ -0,0 +1,58 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace fb {
+
+// Vertices are welded when their bytes are identical. With an epsilon, the
+// position, normal or texcoord is first rounded to a multiple of it, so that
+// nearly identical vertices weld too. Zero keeps the attribute exact.
+struct WeldEpsilons {
+    float position = 0.0f;
+    float normal = 0.0f;
+    float texcoord = 0.0f;
+};
+
+// Vertex of every key, numbered in order of first occurrence: keys with
+// identical bytes get the same vertex. Keys are `key_size` bytes each.
+auto weld_keys(Span<const std::byte> keys, size_t key_size) -> std::vector<uint>;
+
+// Merges vertices as described by `epsilons`, keeping the first of each, and
+// remaps `indices`.
+template<typename Vertex>
+auto weld_vertices(std::vector<Vertex>& vertices, Span<AssetIndex> indices, WeldEpsilons epsilons)
+    -> void {
+    static_assert(std::is_trivially_copyable_v<Vertex>);
+    static_assert(sizeof(Vertex) % sizeof(float) == 0, "Vertices must not have padding");
+
+    // Keys.
+    const auto round = [](float value, float epsilon) {
+        // Adding zero turns -0 into +0.
+        return epsilon > 0.0f ? std::round(value / epsilon) + 0.0f : value;
+    };
+    auto keys = vertices;
+    for (auto& key : keys) {
+        for (uint i = 0; i < 3; i++) {
+            key.position[i] = round(key.position[i], epsilons.position);
+            key.normal[i] = round(key.normal[i], epsilons.normal);
+        }
+        for (uint i = 0; i < 2; i++) {
+            key.texcoord[i] = round(key.texcoord[i], epsilons.texcoord);
+        }
+    }
+    const auto remap = weld_keys(std::as_bytes(Span<const Vertex>(keys)), sizeof(Vertex));
+
+    // Vertices.
+    auto welded_vertices = std::vector<Vertex>();
+    for (size_t i = 0; i < vertices.size(); i++) {
+        if (remap[i] == welded_vertices.size()) {
+            welded_vertices.push_back(vertices[i]);
+        }
+    }
+    vertices = std::move(welded_vertices);
+    for (auto& index : indices) {
+        index = remap[index];
+    }
+}
+
+} // namespace fb
@@ -1,4 +1,12 @@
 #include "tasks.hpp"
+#include "cache.hpp"
+#include "mesh_bounds.hpp"
+#include "mesh_indices.hpp"
+#include "mesh_lod.hpp"
+#include "mesh_meshlets.hpp"
+#include "mesh_order.hpp"
+#include "mesh_quantize.hpp"
+#include "mesh_weld.hpp"
 #include "../formats/gltf.hpp"
 #include "../formats/mikktspace.hpp"
 #include "../utils/names.hpp"
@@ -9,26 +17,41 @@
 
 namespace fb {
 
+// Streams the spans of one task to its bin file as they are written, so that
+// a task never holds more than the data it is working on.
 class AssetsWriter {
 public:
-    AssetsWriter(std::vector<std::byte>& data)
-        : _data(data) {}
+    AssetsWriter(FileWriter& file)
+        : _file(file) {}
 
+    // Spans are packed in the task's bin, `alignment` only applies once they
+    // are laid out in the assets bin.
     template<typename T>
-    auto write(std::string_view type, Span<const T> elements) -> AssetSpan {
-        auto offset = _data.size();
-        _data.resize(offset + elements.size_bytes());
-        std::memcpy(_data.data() + offset, elements.data(), elements.size_bytes());
+    auto write(
+        std::string_view type,
+        Span<const T> elements,
+        size_t alignment = ASSET_SPAN_ALIGNMENT
+    ) -> AssetSpan {
+        static_assert(alignof(T) <= ASSET_SPAN_ALIGNMENT);
+        const auto offset = _file.byte_count();
+        const auto bytes = std::as_bytes(elements);
+        _file.write(bytes);
         return {
             .type = std::string(type),
             .offset = offset,
             .element_count = elements.size(),
-            .byte_count = elements.size_bytes(),
+            .byte_count = bytes.size(),
+            .alignment = alignment,
+            .hash = hash128(bytes),
         };
     }
 
+    auto write_texture_data(Span<const std::byte> bytes) -> AssetSpan {
+        return write("std::byte", bytes, ASSET_TEXTURE_DATA_ALIGNMENT);
+    }
+
 private:
-    std::vector<std::byte>& _data;
+    FileWriter& _file;
 };
 
 auto mipmapped_texture_asset(
@@ -38,6 +61,8 @@ auto mipmapped_texture_asset(
     DXGI_FORMAT texture_format,
     AssetColorSpace color_space
 ) -> Asset {
+    FB_BAKE_ZONE("mipmaps");
+
     // Mipmapper state.
     std::array<AssetTextureData, MAX_MIP_COUNT> texture_datas = {};
     uint texture_data_count = 0;
@@ -58,7 +83,7 @@ auto mipmapped_texture_asset(
     texture_datas[texture_data_count++] = AssetTextureData {
         .row_pitch = dst_width * texture.channel_count(),
         .slice_pitch = dst_width * dst_height * texture.channel_count(),
-        .data = assets_writer.write("std::byte", Span<const std::byte>(dst_buffer)),
+        .data = assets_writer.write_texture_data(dst_buffer),
     };
 
     // Compute the rest of the mip levels.
@@ -106,7 +131,7 @@ auto mipmapped_texture_asset(
         texture_datas[texture_data_count++] = AssetTextureData {
             .row_pitch = dst_width * texture.channel_count(),
             .slice_pitch = dst_width * dst_height * texture.channel_count(),
-            .data = assets_writer.write("std::byte", Span<const std::byte>(dst_buffer)),
+            .data = assets_writer.write_texture_data(dst_buffer),
         };
     }
 
@@ -122,6 +147,173 @@ auto mipmapped_texture_asset(
     };
 }
 
+struct MeshIndexSpans {
+    DXGI_FORMAT format;
+    AssetSpan indices;
+    AssetSpan short_indices;
+    AssetSpan lod_indices;
+    AssetSpan short_lod_indices;
+};
+
+// 16-bit indices if every index fits, 32-bit otherwise, with the spans of the
+// other format left empty. Levels of detail use the format of the mesh, as
+// they index the same vertices.
+auto write_mesh_indices(
+    AssetsWriter& assets_writer,
+    Span<const AssetIndex> indices,
+    Span<const AssetIndex> lod_indices
+) -> MeshIndexSpans {
+    const auto format = mesh_index_format(indices);
+    if (format == DXGI_FORMAT_R32_UINT) {
+        return MeshIndexSpans {
+            .format = format,
+            .indices = assets_writer.write("Index", indices),
+            .short_indices = assets_writer.write("ShortIndex", Span<const AssetShortIndex>()),
+            .lod_indices = assets_writer.write("Index", lod_indices),
+            .short_lod_indices = assets_writer.write("ShortIndex", Span<const AssetShortIndex>()),
+        };
+    }
+    return MeshIndexSpans {
+        .format = format,
+        .indices = assets_writer.write("Index", Span<const AssetIndex>()),
+        .short_indices = assets_writer.write(
+            "ShortIndex",
+            Span<const AssetShortIndex>(short_indices(indices))
+        ),
+        .lod_indices = assets_writer.write("Index", Span<const AssetIndex>()),
+        .short_lod_indices = assets_writer.write(
+            "ShortIndex",
+            Span<const AssetShortIndex>(short_indices(lod_indices))
+        ),
+    };
+}
+
+template<typename Vertex>
+auto meshlets_asset(
+    AssetsWriter& assets_writer,
+    const std::string& meshlets_name,
+    Span<const Vertex> vertices,
+    Span<const AssetIndex> indices,
+    Span<const AssetSubmesh> submeshes
+) -> Asset {
+    const auto buffers = build_mesh_meshlets(vertices, indices, submeshes);
+    return AssetMeshlets {
+        .name = meshlets_name,
+        .meshlets = assets_writer.write("Meshlet", Span<const AssetMeshlet>(buffers.meshlets)),
+        .vertices = assets_writer.write("uint", Span<const uint>(buffers.vertices)),
+        .triangles = assets_writer.write("uint", Span<const uint>(buffers.triangles)),
+        .submeshes = assets_writer.write(
+            "MeshletSubmesh",
+            Span<const AssetMeshletSubmesh>(buffers.submeshes)
+        ),
+    };
+}
+
+// Mesh asset of a single level of detail, optimized, followed by its meshlets.
+// Statistics count `source_vertex_count` vertices before welding, or the
+// vertices as given.
+auto write_mesh_assets(
+    AssetsWriter& assets_writer,
+    UniqueNames& names,
+    std::string_view name,
+    std::vector<AssetVertex>& vertices,
+    std::vector<AssetIndex>& indices,
+    Span<const AssetSubmesh> submeshes,
+    Option<uint> source_vertex_count = std::nullopt
+) -> std::array<Asset, 2> {
+    auto stats = optimize_mesh(vertices, Span(indices), submeshes);
+    if (source_vertex_count.has_value()) {
+        stats.source_vertex_count = source_vertex_count.value();
+    }
+    const auto index_spans = write_mesh_indices(assets_writer, indices, {});
+    const auto bounds = build_mesh_bounds(Span<const AssetVertex>(vertices), indices, submeshes);
+    auto mesh = AssetMesh {
+        .name = names.unique(std::format("{}_mesh", name)),
+        .vertices = assets_writer.write("Vertex", Span<const AssetVertex>(vertices)),
+        .index_format = index_spans.format,
+        .indices = index_spans.indices,
+        .short_indices = index_spans.short_indices,
+        .submeshes = assets_writer.write("Submesh", submeshes),
+        .bounds = bounds.bounds,
+        .submesh_bounds =
+            assets_writer.write("Bounds", Span<const AssetBounds>(bounds.submesh_bounds)),
+        .lod_indices = index_spans.lod_indices,
+        .short_lod_indices = index_spans.short_lod_indices,
+        .lod_submeshes = assets_writer.write("Submesh", Span<const AssetSubmesh>()),
+        .lods = assets_writer.write("MeshLod", Span<const AssetMeshLod>()),
+        .compact_vertices = assets_writer.write("CompactVertex", Span<const AssetCompactVertex>()),
+        .stats = stats,
+    };
+    auto meshlets = meshlets_asset(
+        assets_writer,
+        names.unique(std::format("{}_meshlets", name)),
+        Span<const AssetVertex>(vertices),
+        indices,
+        submeshes
+    );
+    return {std::move(mesh), std::move(meshlets)};
+}
+
+// Mesh assets of a generated shape, with one vertex per corner, for its
+// tangent, welded back together.
+auto write_shape_mesh_assets(
+    AssetsWriter& assets_writer,
+    UniqueNames& names,
+    std::string_view name,
+    Span<const float3> positions,
+    Span<const float3> normals,
+    Span<const float2> texcoords,
+    std::vector<AssetIndex> indices,
+    ThreadPool* pool
+) -> std::array<Asset, 2> {
+    // Compute tangents.
+    auto corner_tangents = std::vector<float4>(indices.size());
+    generate_tangents(
+        GenerateTangentsDesc {
+            .positions = positions,
+            .normals = normals,
+            .texcoords = texcoords,
+            .indices = indices,
+            .tangents = Span(corner_tangents),
+            .pool = pool,
+        }
+    );
+
+    // Convert, one vertex per corner, welded.
+    auto vertices = std::vector<AssetVertex>(indices.size());
+    for (uint i = 0; i < vertices.size(); ++i) {
+        const auto v = indices[i];
+        vertices[i] = AssetVertex {
+            .position = positions[v],
+            .normal = normals[v],
+            .texcoord = texcoords[v],
+            .tangent = corner_tangents[i],
+        };
+        indices[i] = i;
+    }
+    weld_vertices(vertices, Span(indices), WeldEpsilons {});
+
+    // Submesh.
+    const auto submeshes = std::vector<AssetSubmesh> {
+        AssetSubmesh {
+            .index_count = (uint)indices.size(),
+            .start_index = 0,
+            .base_vertex = 0,
+        },
+    };
+
+    // Mesh.
+    return write_mesh_assets(
+        assets_writer,
+        names,
+        name,
+        vertices,
+        indices,
+        submeshes,
+        (uint)positions.size()
+    );
+}
+
 auto create_box(
     std::vector<float3>& positions,
     std::vector<float3>& normals,
@@ -261,817 +453,1082 @@ auto create_sphere(
     FB_ASSERT(positions.size() == texcoords.size());
 }
 
-auto bake_assets(std::string_view assets_dir, Span<const AssetTask> asset_tasks)
-    -> std::tuple<std::vector<Asset>, std::vector<std::byte>> {
+auto bake_asset_task(std::string_view assets_dir, const AssetTask& asset_task, ThreadPool* pool)
+    -> AssetTaskOutput {
+    // Every task writes into its own bin, a temporary file, so all offsets are
+    // relative to the start of that file until `bake_assets` stitches the bins
+    // together.
     auto assets = std::vector<Asset>();
-    auto assets_bin = std::vector<std::byte>();
-    auto assets_writer = AssetsWriter(assets_bin);
+    const auto task_bin_path = create_temp_path();
+    auto bin_writer = FileWriter(task_bin_path);
+    auto assets_writer = AssetsWriter(bin_writer);
     auto names = UniqueNames();
-    FB_LOG_INFO("Baking {} asset tasks", asset_tasks.size());
-    size_t asset_index = 0;
-    for (const auto& asset_task : asset_tasks) {
-        // Log.
-        FB_LOG_INFO(
-            "{}/{} - {}",
-            ++asset_index,
-            asset_tasks.size(),
-            asset_task_name(asset_task.index())
-        );
-
-        // Match.
-        std::visit(
-            overloaded {
-                [&](const AssetTaskCopy& task) {
-                    const auto path = std::format("{}/{}", assets_dir, task.path);
-                    const auto file = FileBuffer::from_path(path);
-                    assets.emplace_back(
-                        AssetCopy {
-                            .name = names.unique(std::string(task.name)),
-                            .data = assets_writer.write("std::byte", file.as_span()),
-                        }
-                    );
-                },
-                [&](const AssetTaskTexture& task) {
-                    const auto path = std::format("{}/{}", assets_dir, task.path);
-                    const auto file = FileBuffer::from_path(path);
-                    const auto image = LdrImage::from_image(file.as_span());
-                    assets.push_back(mipmapped_texture_asset(
-                        assets_writer,
-                        names.unique(std::format("{}_texture", task.name)),
-                        image,
-                        task.format,
-                        task.color_space
-                    ));
-                },
-                [&](const AssetTaskHdrTexture& task) {
-                    const auto file = FileBuffer::from_path(std::format("{}/{}", assets_dir, task.path));
-                    const auto image = HdrImage::from_image(file.as_span());
-                    assets.emplace_back(
-                        AssetTexture {
-                            .name = names.unique(std::format("{}_hdr_texture", task.name)),
-                            .format = image.format(),
-                            .width = image.width(),
-                            .height = image.height(),
-                            .channel_count = image.channel_count(),
-                            .mip_count = 1,
-                            .datas = {AssetTextureData {
-                                .row_pitch = image.row_pitch(),
-                                .slice_pitch = image.slice_pitch(),
-                                .data = assets_writer.write("std::byte", image.data()),
-                            }},
-                        }
-                    );
-                },
-                [&](const AssetTaskGltf& task) {
-                    // Load GLTF.
-                    const auto path = std::format("{}/{}", assets_dir, task.path);
-                    GltfModel model(path);
-                    const auto positions = model.vertex_positions();
-                    const auto normals = model.vertex_normals();
-                    const auto texcoords = model.vertex_texcoords();
-                    const auto joints = model.vertex_joints();
-                    const auto weights = model.vertex_weights();
-                    const auto indices = model.indices();
-                    const auto submeshes = model.submeshes();
-                    auto tangents = std::vector<float4>(positions.size());
-                    generate_tangents(
-                        GenerateTangentsDesc {
-                            .positions = positions,
-                            .normals = normals,
-                            .texcoords = texcoords,
-                            .indices = indices,
-                            .tangents = Span(tangents),
-                        }
-                    );
 
-                    // Submeshes.
-                    auto asset_submeshes = std::vector<AssetSubmesh>();
-                    for (const auto& submesh : submeshes) {
-                        asset_submeshes.push_back(
-                            AssetSubmesh {
-                                .index_count = submesh.index_count,
-                                .start_index = submesh.start_index,
-                                .base_vertex = 0,
-                            }
-                        );
+    // Match.
+    std::visit(
+        overloaded {
+            [&](const AssetTaskCopy& task) {
+                const auto path = std::format("{}/{}", assets_dir, task.path);
+                const auto file = FileBuffer::from_path(path);
+                assets.emplace_back(
+                    AssetCopy {
+                        .name = names.unique(std::string(task.name)),
+                        .data = assets_writer.write("std::byte", file.as_span()),
                     }
-
-                    // Animated vs non-animated.
-                    if (joints.empty()) {
-                        auto vertices = std::vector<AssetVertex>(positions.size());
-                        for (size_t i = 0; i < vertices.size(); ++i) {
-                            vertices[i] = AssetVertex {
-                                .position = positions[i],
-                                .normal = normals[i],
-                                .texcoord = texcoords[i],
-                                .tangent = tangents[i],
-                            };
-                        }
-
-                        assets.emplace_back(
-                            AssetMesh {
-                                .name = names.unique(std::format("{}_mesh", task.name)),
-                                .transform = model.root_transform(),
-                                .vertices = assets_writer
-                                                .write("Vertex", Span<const AssetVertex>(vertices)),
-                                .indices = assets_writer.write("Index", indices),
-                                .submeshes = assets_writer.write(
-                                    "Submesh",
-                                    Span<const AssetSubmesh>(asset_submeshes)
-                                ),
-                            }
-                        );
-                    } else {
-                        auto vertices = std::vector<AssetSkinningVertex>(positions.size());
-                        for (size_t i = 0; i < vertices.size(); ++i) {
-                            vertices[i] = AssetSkinningVertex {
-                                .position = positions[i],
-                                .normal = normals[i],
-                                .texcoord = texcoords[i],
-                                .tangent = tangents[i],
-                                .joint = joints[i],
-                                .weight = weights[i],
-                            };
-                        }
-
-                        assets.emplace_back(
-                            AssetAnimationMesh {
-                                .name = names.unique(std::format("{}_animation_mesh", task.name)),
-                                .transform = model.root_transform(),
-                                .node_count = model.node_count(),
-                                .joint_count = model.joint_count(),
-                                .duration = model.animation_duration(),
-                                .skinning_vertices = assets_writer.write(
-                                    "SkinningVertex",
-                                    Span<const AssetSkinningVertex>(vertices)
-                                ),
-                                .indices = assets_writer.write("Index", indices),
-                                .submeshes = assets_writer.write(
-                                    "Submesh",
-                                    Span<const AssetSubmesh>(asset_submeshes)
-                                ),
-                                .joint_nodes = assets_writer.write("uint", model.joint_nodes()),
-                                .joint_inverse_binds =
-                                    assets_writer.write("float4x4", model.joint_inverse_binds()),
-                                .node_parents = assets_writer.write("uint", model.node_parents()),
-                                .node_channels =
-                                    assets_writer.write("AnimationChannel", model.node_channels()),
-                                .node_channels_times_t =
-                                    assets_writer.write("float", model.node_channels_times_t()),
-                                .node_channels_times_r =
-                                    assets_writer.write("float", model.node_channels_times_r()),
-                                .node_channels_times_s =
-                                    assets_writer.write("float", model.node_channels_times_s()),
-                                .node_channels_values_t =
-                                    assets_writer.write("float3", model.node_channels_values_t()),
-                                .node_channels_values_r = assets_writer.write(
-                                    "float_quat",
-                                    model.node_channels_values_r()
-                                ),
-                                .node_channels_values_s =
-                                    assets_writer.write("float3", model.node_channels_values_s()),
-                            }
-                        );
-                    }
-
-                    // Textures.
-                    {
-                        assets.push_back(mipmapped_texture_asset(
-                            assets_writer,
-                            names.unique(std::format("{}_base_color_texture", task.name)),
-                            model.base_color_texture(),
-                            GLTF_BASE_COLOR_TEXTURE_FORMAT,
-                            AssetColorSpace::Srgb
-                        ));
-                    }
-                    if (model.normal_texture().has_value()) {
-                        assets.push_back(mipmapped_texture_asset(
-                            assets_writer,
-                            names.unique(std::format("{}_normal_texture", task.name)),
-                            model.normal_texture().value().get(),
-                            GLTF_NORMAL_TEXTURE_FORMAT,
-                            AssetColorSpace::Linear
-                        ));
-                    }
-                    if (model.metallic_roughness_texture().has_value()) {
-                        assets.push_back(mipmapped_texture_asset(
-                            assets_writer,
-                            names.unique(std::format("{}_metallic_roughness_texture", task.name)),
-                            model.metallic_roughness_texture().value().get(),
-                            GLTF_METALLIC_ROUGHNESS_TEXTURE_FORMAT,
-                            AssetColorSpace::Linear
-                        ));
+                );
+            },
+            [&](const AssetTaskTexture& task) {
+                const auto path = std::format("{}/{}", assets_dir, task.path);
+                const auto file = FileBuffer::from_path(path);
+                const auto image = LdrImage::from_image(file.as_span());
+                assets.push_back(mipmapped_texture_asset(
+                    assets_writer,
+                    names.unique(std::format("{}_texture", task.name)),
+                    image,
+                    task.format,
+                    task.color_space
+                ));
+            },
+            [&](const AssetTaskHdrTexture& task) {
+                const auto file = FileBuffer::from_path(std::format("{}/{}", assets_dir, task.path));
+                const auto image = HdrImage::from_image(file.as_span());
+                assets.emplace_back(
+                    AssetTexture {
+                        .name = names.unique(std::format("{}_hdr_texture", task.name)),
+                        .format = image.format(),
+                        .width = image.width(),
+                        .height = image.height(),
+                        .channel_count = image.channel_count(),
+                        .mip_count = 1,
+                        .datas = {AssetTextureData {
+                            .row_pitch = image.row_pitch(),
+                            .slice_pitch = image.slice_pitch(),
+                            .data = assets_writer.write_texture_data(image.data()),
+                        }},
                     }
-
-                    // Materials.
-                    {
-                        assets.emplace_back(
-                            AssetMaterial {
-                                .name = names.unique(std::format("{}_material", task.name)),
-                                .alpha_cutoff = model.alpha_cutoff(),
-                                .alpha_mode = (AssetAlphaMode)model.alpha_mode(),
-                            }
-                        );
+                );
+            },
+            [&](const AssetTaskGltf& task) {
+                // Load GLTF.
+                const auto path = std::format("{}/{}", assets_dir, task.path);
+                GltfModel model(path);
+                const auto positions = model.vertex_positions();
+                const auto normals = model.vertex_normals();
+                const auto texcoords = model.vertex_texcoords();
+                const auto joints = model.vertex_joints();
+                const auto weights = model.vertex_weights();
+                const auto model_indices = model.indices();
+                const auto submeshes = model.submeshes();
+                auto tangents = std::vector<float4>(model_indices.size());
+                generate_tangents(
+                    GenerateTangentsDesc {
+                        .positions = positions,
+                        .normals = normals,
+                        .texcoords = texcoords,
+                        .indices = model_indices,
+                        .tangents = Span(tangents),
+                        .pool = pool,
                     }
-                },
-                [&](const AssetTaskProceduralCube& task) {
-                    // Generate.
-                    auto vertex_positions = std::vector<float3>();
-                    auto vertex_normals = std::vector<float3>();
-                    auto vertex_texcoords = std::vector<float2>();
-                    auto indices = std::vector<uint>();
-                    create_box(
-                        vertex_positions,
-                        vertex_normals,
-                        vertex_texcoords,
-                        indices,
-                        {task.extents, task.extents, task.extents},
-                        task.inverted,
-                        task.inverted
-                    );
-
-                    // Compute tangents.
-                    auto vertex_tangents = std::vector<float4>(vertex_positions.size());
-                    generate_tangents(
-                        GenerateTangentsDesc {
-                            .positions = vertex_positions,
-                            .normals = vertex_normals,
-                            .texcoords = vertex_texcoords,
-                            .indices = indices,
-                            .tangents = Span(vertex_tangents),
+                );
+
+                // One vertex per corner, with its tangent, welded below.
+                auto indices = std::vector<AssetIndex>(model_indices.size());
+                for (uint i = 0; i < indices.size(); i++) {
+                    indices[i] = i;
+                }
+
+                // Submeshes.
+                auto asset_submeshes = std::vector<AssetSubmesh>();
+                for (const auto& submesh : submeshes) {
+                    asset_submeshes.push_back(
+                        AssetSubmesh {
+                            .index_count = submesh.index_count,
+                            .start_index = submesh.start_index,
+                            .base_vertex = 0,
                         }
                     );
+                }
 
-                    // Convert.
-                    auto vertices = std::vector<AssetVertex>(vertex_positions.size());
+                // Animated vs non-animated.
+                if (joints.empty()) {
+                    auto vertices = std::vector<AssetVertex>(indices.size());
                     for (size_t i = 0; i < vertices.size(); ++i) {
+                        const auto v = model_indices[i];
                         vertices[i] = AssetVertex {
-                            .position = vertex_positions[i],
-                            .normal = vertex_normals[i],
-                            .texcoord = vertex_texcoords[i],
-                            .tangent = vertex_tangents[i],
+                            .position = positions[v],
+                            .normal = normals[v],
+                            .texcoord = texcoords[v],
+                            .tangent = tangents[i],
                         };
                     }
+                    weld_vertices(vertices, Span(indices), task.weld_epsilons);
+                    auto stats = optimize_mesh(vertices, Span(indices), asset_submeshes);
+                    stats.source_vertex_count = (uint)positions.size();
+                    if (task.short_index_chunks) {
+                        auto chunks = split_short_index_submeshes(Span(indices), asset_submeshes);
+                        if (chunks.has_value()) {
+                            asset_submeshes = std::move(chunks.value());
+                        } else {
+                            FB_LOG_WARN(
+                                "{}: a triangle spans too many vertices for 16-bit indices",
+                                task.name
+                            );
+                        }
+                    }
+                    const auto lods = build_mesh_lods(
+                        Span<const AssetVertex>(vertices),
+                        indices,
+                        asset_submeshes,
+                        task.lods
+                    );
+                    const auto compact = task.compact_vertices
+                        ? compact_vertices(Span<const AssetVertex>(vertices))
+                        : CompactVertices<AssetCompactVertex>();
+                    const auto index_spans =
+                        write_mesh_indices(assets_writer, indices, lods.indices);
+                    const auto bounds = build_mesh_bounds(
+                        Span<const AssetVertex>(vertices),
+                        indices,
+                        asset_submeshes
+                    );
 
-                    // Submesh.
-                    const auto submeshes = std::vector<AssetSubmesh> {
-                        AssetSubmesh {
-                            .index_count = (uint)indices.size(),
-                            .start_index = 0,
-                            .base_vertex = 0,
-                        },
-                    };
-
-                    // Mesh.
                     assets.emplace_back(
                         AssetMesh {
                             .name = names.unique(std::format("{}_mesh", task.name)),
-                            .vertices =
-                                assets_writer.write("Vertex", Span<const AssetVertex>(vertices)),
-                            .indices =
-                                assets_writer.write("Index", Span<const AssetIndex>(indices)),
-                            .submeshes =
-                                assets_writer.write("Submesh", Span<const AssetSubmesh>(submeshes)),
+                            .transform = model.root_transform(),
+                            .vertices = assets_writer
+                                            .write("Vertex", Span<const AssetVertex>(vertices)),
+                            .index_format = index_spans.format,
+                            .indices = index_spans.indices,
+                            .short_indices = index_spans.short_indices,
+                            .submeshes = assets_writer.write(
+                                "Submesh",
+                                Span<const AssetSubmesh>(asset_submeshes)
+                            ),
+                            .bounds = bounds.bounds,
+                            .submesh_bounds = assets_writer.write(
+                                "Bounds",
+                                Span<const AssetBounds>(bounds.submesh_bounds)
+                            ),
+                            .lod_indices = index_spans.lod_indices,
+                            .short_lod_indices = index_spans.short_lod_indices,
+                            .lod_submeshes = assets_writer.write(
+                                "Submesh",
+                                Span<const AssetSubmesh>(lods.submeshes)
+                            ),
+                            .lods =
+                                assets_writer.write("MeshLod", Span<const AssetMeshLod>(lods.lods)),
+                            .quantization = compact.quantization,
+                            .compact_vertices = assets_writer.write(
+                                "CompactVertex",
+                                Span<const AssetCompactVertex>(compact.vertices)
+                            ),
+                            .stats = stats,
                         }
                     );
-                },
-                [&](const AssetTaskProceduralSphere& task) {
-                    // Generate.
-                    auto vertex_positions = std::vector<float3>();
-                    auto vertex_normals = std::vector<float3>();
-                    auto vertex_texcoords = std::vector<float2>();
-                    auto indices = std::vector<uint>();
-                    create_sphere(
-                        vertex_positions,
-                        vertex_normals,
-                        vertex_texcoords,
+                    assets.push_back(meshlets_asset(
+                        assets_writer,
+                        names.unique(std::format("{}_meshlets", task.name)),
+                        Span<const AssetVertex>(vertices),
                         indices,
-                        2.0f * task.radius,
-                        task.tesselation,
-                        task.inverted,
-                        task.inverted
+                        asset_submeshes
+                    ));
+                } else {
+                    auto vertices = std::vector<AssetSkinningVertex>(indices.size());
+                    for (size_t i = 0; i < vertices.size(); ++i) {
+                        const auto v = model_indices[i];
+                        vertices[i] = AssetSkinningVertex {
+                            .position = positions[v],
+                            .normal = normals[v],
+                            .texcoord = texcoords[v],
+                            .tangent = tangents[i],
+                            .joint = joints[v],
+                            .weight = weights[v],
+                        };
+                    }
+                    weld_vertices(vertices, Span(indices), task.weld_epsilons);
+                    auto stats = optimize_mesh(vertices, Span(indices), asset_submeshes);
+                    stats.source_vertex_count = (uint)positions.size();
+                    if (task.short_index_chunks) {
+                        auto chunks = split_short_index_submeshes(Span(indices), asset_submeshes);
+                        if (chunks.has_value()) {
+                            asset_submeshes = std::move(chunks.value());
+                        } else {
+                            FB_LOG_WARN(
+                                "{}: a triangle spans too many vertices for 16-bit indices",
+                                task.name
+                            );
+                        }
+                    }
+                    const auto lods = build_mesh_lods(
+                        Span<const AssetSkinningVertex>(vertices),
+                        indices,
+                        asset_submeshes,
+                        task.lods
+                    );
+                    if (task.compact_vertices && model.joint_count() > MAX_COMPACT_JOINT_COUNT) {
+                        FB_LOG_WARN(
+                            "{}: {} joints don't fit compact vertices, skipping them",
+                            task.name,
+                            model.joint_count()
+                        );
+                    }
+                    const auto compact =
+                        task.compact_vertices && model.joint_count() <= MAX_COMPACT_JOINT_COUNT
+                        ? compact_vertices(Span<const AssetSkinningVertex>(vertices))
+                        : CompactVertices<AssetCompactSkinningVertex>();
+                    const auto index_spans =
+                        write_mesh_indices(assets_writer, indices, lods.indices);
+                    const auto bounds = build_mesh_bounds(
+                        Span<const AssetSkinningVertex>(vertices),
+                        indices,
+                        asset_submeshes
                     );
 
-                    // Compute tangents.
-                    auto vertex_tangents = std::vector<float4>(vertex_positions.size());
-                    generate_tangents(
-                        GenerateTangentsDesc {
-                            .positions = vertex_positions,
-                            .normals = vertex_normals,
-                            .texcoords = vertex_texcoords,
-                            .indices = indices,
-                            .tangents = Span(vertex_tangents),
+                    assets.emplace_back(
+                        AssetAnimationMesh {
+                            .name = names.unique(std::format("{}_animation_mesh", task.name)),
+                            .transform = model.root_transform(),
+                            .node_count = model.node_count(),
+                            .joint_count = model.joint_count(),
+                            .duration = model.animation_duration(),
+                            .skinning_vertices = assets_writer.write(
+                                "SkinningVertex",
+                                Span<const AssetSkinningVertex>(vertices)
+                            ),
+                            .index_format = index_spans.format,
+                            .indices = index_spans.indices,
+                            .short_indices = index_spans.short_indices,
+                            .submeshes = assets_writer.write(
+                                "Submesh",
+                                Span<const AssetSubmesh>(asset_submeshes)
+                            ),
+                            .bounds = bounds.bounds,
+                            .submesh_bounds = assets_writer.write(
+                                "Bounds",
+                                Span<const AssetBounds>(bounds.submesh_bounds)
+                            ),
+                            .lod_indices = index_spans.lod_indices,
+                            .short_lod_indices = index_spans.short_lod_indices,
+                            .lod_submeshes = assets_writer.write(
+                                "Submesh",
+                                Span<const AssetSubmesh>(lods.submeshes)
+                            ),
+                            .lods =
+                                assets_writer.write("MeshLod", Span<const AssetMeshLod>(lods.lods)),
+                            .quantization = compact.quantization,
+                            .compact_skinning_vertices = assets_writer.write(
+                                "CompactSkinningVertex",
+                                Span<const AssetCompactSkinningVertex>(compact.vertices)
+                            ),
+                            .joint_nodes = assets_writer.write("uint", model.joint_nodes()),
+                            .joint_inverse_binds =
+                                assets_writer.write("float4x4", model.joint_inverse_binds()),
+                            .node_parents = assets_writer.write("uint", model.node_parents()),
+                            .node_channels =
+                                assets_writer.write("AnimationChannel", model.node_channels()),
+                            .node_channels_times_t =
+                                assets_writer.write("float", model.node_channels_times_t()),
+                            .node_channels_times_r =
+                                assets_writer.write("float", model.node_channels_times_r()),
+                            .node_channels_times_s =
+                                assets_writer.write("float", model.node_channels_times_s()),
+                            .node_channels_values_t =
+                                assets_writer.write("float3", model.node_channels_values_t()),
+                            .node_channels_values_r = assets_writer.write(
+                                "float_quat",
+                                model.node_channels_values_r()
+                            ),
+                            .node_channels_values_s =
+                                assets_writer.write("float3", model.node_channels_values_s()),
+                            .stats = stats,
                         }
                     );
+                }
 
-                    // Convert.
-                    auto vertices = std::vector<AssetVertex>(vertex_positions.size());
-                    for (size_t i = 0; i < vertices.size(); ++i) {
-                        vertices[i] = AssetVertex {
-                            .position = vertex_positions[i],
-                            .normal = vertex_normals[i],
-                            .texcoord = vertex_texcoords[i],
-                            .tangent = vertex_tangents[i],
-                        };
-                    }
-
-                    // Submesh.
-                    const auto submeshes = std::vector<AssetSubmesh> {
-                        AssetSubmesh {
-                            .index_count = (uint)indices.size(),
-                            .start_index = 0,
-                            .base_vertex = 0,
-                        },
-                    };
+                // Textures.
+                {
+                    assets.push_back(mipmapped_texture_asset(
+                        assets_writer,
+                        names.unique(std::format("{}_base_color_texture", task.name)),
+                        model.base_color_texture(),
+                        GLTF_BASE_COLOR_TEXTURE_FORMAT,
+                        AssetColorSpace::Srgb
+                    ));
+                }
+                if (model.normal_texture().has_value()) {
+                    assets.push_back(mipmapped_texture_asset(
+                        assets_writer,
+                        names.unique(std::format("{}_normal_texture", task.name)),
+                        model.normal_texture().value().get(),
+                        GLTF_NORMAL_TEXTURE_FORMAT,
+                        AssetColorSpace::Linear
+                    ));
+                }
+                if (model.metallic_roughness_texture().has_value()) {
+                    assets.push_back(mipmapped_texture_asset(
+                        assets_writer,
+                        names.unique(std::format("{}_metallic_roughness_texture", task.name)),
+                        model.metallic_roughness_texture().value().get(),
+                        GLTF_METALLIC_ROUGHNESS_TEXTURE_FORMAT,
+                        AssetColorSpace::Linear
+                    ));
+                }
 
-                    // Mesh.
+                // Materials.
+                {
                     assets.emplace_back(
-                        AssetMesh {
-                            .name = names.unique(std::format("{}_mesh", task.name)),
-                            .vertices =
-                                assets_writer.write("Vertex", Span<const AssetVertex>(vertices)),
-                            .indices =
-                                assets_writer.write("Index", Span<const AssetIndex>(indices)),
-                            .submeshes =
-                                assets_writer.write("Submesh", Span<const AssetSubmesh>(submeshes)),
+                        AssetMaterial {
+                            .name = names.unique(std::format("{}_material", task.name)),
+                            .alpha_cutoff = model.alpha_cutoff(),
+                            .alpha_mode = (AssetAlphaMode)model.alpha_mode(),
                         }
                     );
-                },
-                [&](const AssetTaskProceduralLowPolyGround& task) {
-                    // Generate vertices.
-                    const auto cell_count_x = task.vertex_count_x;
-                    const auto cell_count_y = task.vertex_count_y;
-                    const auto cell_vertex_count = cell_count_x * cell_count_y;
-                    auto cell_vertices = std::vector<float3>(cell_vertex_count);
-                    auto cell_vertices_visited = std::vector<bool>(cell_vertex_count, false);
-                    const auto base_height = task.side_length * std::sqrtf(3.0f) / 2.0f;
-                    for (uint cell_y = 0; cell_y < cell_count_y; cell_y++) {
-                        for (uint cell_x = 0; cell_x < cell_count_x; cell_x++) {
-                            const auto offset_x = cell_y % 2 == 1 ? 0.5f * task.side_length : 0.0f;
-
-                            const auto cell_index = cell_y * cell_count_x + cell_x;
-                            auto cell_position = float3();
-                            cell_position.x = offset_x + (float)cell_x * task.side_length;
-                            cell_position.y = 0.0f;
-                            cell_position.z = (float)cell_y * base_height;
-                            cell_vertices[cell_index] = cell_position;
+                }
+            },
+            [&](const AssetTaskProceduralCube& task) {
+                // Generate.
+                auto vertex_positions = std::vector<float3>();
+                auto vertex_normals = std::vector<float3>();
+                auto vertex_texcoords = std::vector<float2>();
+                auto indices = std::vector<uint>();
+                create_box(
+                    vertex_positions,
+                    vertex_normals,
+                    vertex_texcoords,
+                    indices,
+                    {task.extents, task.extents, task.extents},
+                    task.inverted,
+                    task.inverted
+                );
+
+                // Mesh.
+                auto mesh_assets = write_shape_mesh_assets(
+                    assets_writer,
+                    names,
+                    task.name,
+                    vertex_positions,
+                    vertex_normals,
+                    vertex_texcoords,
+                    std::move(indices),
+                    pool
+                );
+                std::ranges::move(mesh_assets, std::back_inserter(assets));
+            },
+            [&](const AssetTaskProceduralSphere& task) {
+                // Generate.
+                auto vertex_positions = std::vector<float3>();
+                auto vertex_normals = std::vector<float3>();
+                auto vertex_texcoords = std::vector<float2>();
+                auto indices = std::vector<uint>();
+                create_sphere(
+                    vertex_positions,
+                    vertex_normals,
+                    vertex_texcoords,
+                    indices,
+                    2.0f * task.radius,
+                    task.tesselation,
+                    task.inverted,
+                    task.inverted
+                );
+
+                // Mesh.
+                auto mesh_assets = write_shape_mesh_assets(
+                    assets_writer,
+                    names,
+                    task.name,
+                    vertex_positions,
+                    vertex_normals,
+                    vertex_texcoords,
+                    std::move(indices),
+                    pool
+                );
+                std::ranges::move(mesh_assets, std::back_inserter(assets));
+            },
+            [&](const AssetTaskProceduralLowPolyGround& task) {
+                // Generate vertices.
+                const auto cell_count_x = task.vertex_count_x;
+                const auto cell_count_y = task.vertex_count_y;
+                const auto cell_vertex_count = cell_count_x * cell_count_y;
+                auto cell_vertices = std::vector<float3>(cell_vertex_count);
+                auto cell_vertices_visited = std::vector<bool>(cell_vertex_count, false);
+                const auto base_height = task.side_length * std::sqrtf(3.0f) / 2.0f;
+                for (uint cell_y = 0; cell_y < cell_count_y; cell_y++) {
+                    for (uint cell_x = 0; cell_x < cell_count_x; cell_x++) {
+                        const auto offset_x = cell_y % 2 == 1 ? 0.5f * task.side_length : 0.0f;
+
+                        const auto cell_index = cell_y * cell_count_x + cell_x;
+                        auto cell_position = float3();
+                        cell_position.x = offset_x + (float)cell_x * task.side_length;
+                        cell_position.y = 0.0f;
+                        cell_position.z = (float)cell_y * base_height;
+                        cell_vertices[cell_index] = cell_position;
+                    }
+                }
+
+                // Re-center.
+                float3 cell_center = float3(0.0f, 0.0f, 0.0f);
+                for (const auto& v : cell_vertices) {
+                    cell_center += v;
+                }
+                cell_center /= (float)cell_vertices.size();
+                for (auto& v : cell_vertices) {
+                    v -= cell_center;
+                }
+
+                // Adjust heights.
+                Pcg rand;
+                for (auto& v : cell_vertices) {
+                    v.y += task.height_variation * rand.random_float();
+                }
+
+                // Connect and push faces.
+                auto vertices = std::vector<AssetVertex>();
+                auto indices = std::vector<uint>();
+                const auto push_face = [&](uint a, uint b, uint c) {
+                    const float3 p_a = cell_vertices[a];
+                    const float3 p_b = cell_vertices[b];
+                    const float3 p_c = cell_vertices[c];
+
+                    const float3 d_ab = p_b - p_a;
+                    const float3 d_ac = p_c - p_a;
+                    const float3 n = float3_normalize(float3_cross(d_ab, d_ac));
+
+                    AssetVertex v_a;
+                    AssetVertex v_b;
+                    AssetVertex v_c;
+
+                    v_a.position = p_a;
+                    v_b.position = p_b;
+                    v_c.position = p_c;
+
+                    v_a.normal = n;
+                    v_b.normal = n;
+                    v_c.normal = n;
+
+                    v_a.texcoord = float2(0.5f, 0.5f);
+                    v_b.texcoord = float2(0.5f, 0.5f);
+                    v_c.texcoord = float2(0.5f, 0.5f);
+
+                    v_a.tangent = float4(1.0f, 0.0f, 0.0f, 1.0f);
+                    v_b.tangent = float4(1.0f, 0.0f, 0.0f, 1.0f);
+                    v_c.tangent = float4(1.0f, 0.0f, 0.0f, 1.0f);
+
+                    const uint i_a = (uint)vertices.size();
+                    const uint i_b = i_a + 1;
+                    const uint i_c = i_a + 2;
+
+                    vertices.push_back(v_a);
+                    vertices.push_back(v_b);
+                    vertices.push_back(v_c);
+
+                    indices.push_back(i_a);
+                    indices.push_back(i_b);
+                    indices.push_back(i_c);
+
+                    cell_vertices_visited[a] = true;
+                    cell_vertices_visited[b] = true;
+                    cell_vertices_visited[c] = true;
+                };
+                for (uint j = 0; j < cell_count_y - 1; j++) {
+                    for (uint i = 0; i < cell_count_x - 1; i++) {
+                        const uint curr_offset_x = cell_count_x * j;
+                        const uint next_offset_x = cell_count_x * (j + 1);
+                        std::array<uint, 6> face_indices;
+                        if (j % 2 == 0) {
+                            face_indices[0] = curr_offset_x + i;
+                            face_indices[1] = next_offset_x + i;
+                            face_indices[2] = curr_offset_x + i + 1;
+                            face_indices[3] = curr_offset_x + i + 1;
+                            face_indices[4] = next_offset_x + i;
+                            face_indices[5] = next_offset_x + i + 1;
+                        } else {
+                            face_indices[0] = curr_offset_x + i;
+                            face_indices[1] = next_offset_x + i;
+                            face_indices[2] = next_offset_x + i + 1;
+                            face_indices[3] = curr_offset_x + i;
+                            face_indices[4] = next_offset_x + i + 1;
+                            face_indices[5] = curr_offset_x + i + 1;
                         }
+                        push_face(face_indices[0], face_indices[1], face_indices[2]);
+                        push_face(face_indices[3], face_indices[4], face_indices[5]);
                     }
+                }
 
-                    // Re-center.
-                    float3 cell_center = float3(0.0f, 0.0f, 0.0f);
-                    for (const auto& v : cell_vertices) {
-                        cell_center += v;
+                // Verify all vertices were visited.
+                uint visited_count = 0;
+                for (uint i = 0; i < cell_vertices.size(); i++) {
+                    if (cell_vertices_visited[i]) {
+                        visited_count++;
+                    } else {
+                        FB_LOG_INFO("Was not visited: {}: {}", i, (bool)cell_vertices_visited[i]);
                     }
-                    cell_center /= (float)cell_vertices.size();
-                    for (auto& v : cell_vertices) {
-                        v -= cell_center;
+                }
+                FB_ASSERT(visited_count == cell_vertices.size());
+
+                // Submesh.
+                const auto submeshes = std::vector<AssetSubmesh> {
+                    AssetSubmesh {
+                        .index_count = (uint)indices.size(),
+                        .start_index = 0,
+                        .base_vertex = 0,
+                    },
+                };
+
+                // Mesh.
+                auto mesh_assets = write_mesh_assets(
+                    assets_writer,
+                    names,
+                    task.name,
+                    vertices,
+                    indices,
+                    submeshes
+                );
+                std::ranges::move(mesh_assets, std::back_inserter(assets));
+            },
+            [&](const AssetTaskProceduralTexturedPlane& task) {
+                // Generate.
+                const auto half_extents = task.side_length / 2.0f;
+                const auto normal = float3(0.0f, 1.0f, 0.0f);
+                const auto tangent = float4(1.0f, 0.0f, 0.0f, 1.0f);
+                auto vertices = std::vector<AssetVertex>();
+                auto indices = std::vector<uint>();
+                vertices.push_back(
+                    AssetVertex {
+                        .position = float3(-half_extents, 0.0f, -half_extents),
+                        .normal = normal,
+                        .texcoord = float2(0.0f, 0.0f),
+                        .tangent = tangent,
                     }
-
-                    // Adjust heights.
-                    Pcg rand;
-                    for (auto& v : cell_vertices) {
-                        v.y += task.height_variation * rand.random_float();
+                );
+                vertices.push_back(
+                    AssetVertex {
+                        .position = float3(-half_extents, 0.0f, half_extents),
+                        .normal = normal,
+                        .texcoord = float2(0.0f, 1.0f),
+                        .tangent = tangent,
                     }
-
-                    // Connect and push faces.
-                    auto vertices = std::vector<AssetVertex>();
-                    auto indices = std::vector<uint>();
-                    const auto push_face = [&](uint a, uint b, uint c) {
-                        const float3 p_a = cell_vertices[a];
-                        const float3 p_b = cell_vertices[b];
-                        const float3 p_c = cell_vertices[c];
-
-                        const float3 d_ab = p_b - p_a;
-                        const float3 d_ac = p_c - p_a;
-                        const float3 n = float3_normalize(float3_cross(d_ab, d_ac));
-
-                        AssetVertex v_a;
-                        AssetVertex v_b;
-                        AssetVertex v_c;
-
-                        v_a.position = p_a;
-                        v_b.position = p_b;
-                        v_c.position = p_c;
-
-                        v_a.normal = n;
-                        v_b.normal = n;
-                        v_c.normal = n;
-
-                        v_a.texcoord = float2(0.5f, 0.5f);
-                        v_b.texcoord = float2(0.5f, 0.5f);
-                        v_c.texcoord = float2(0.5f, 0.5f);
-
-                        v_a.tangent = float4(1.0f, 0.0f, 0.0f, 1.0f);
-                        v_b.tangent = float4(1.0f, 0.0f, 0.0f, 1.0f);
-                        v_c.tangent = float4(1.0f, 0.0f, 0.0f, 1.0f);
-
-                        const uint i_a = (uint)vertices.size();
-                        const uint i_b = i_a + 1;
-                        const uint i_c = i_a + 2;
-
-                        vertices.push_back(v_a);
-                        vertices.push_back(v_b);
-                        vertices.push_back(v_c);
-
-                        indices.push_back(i_a);
-                        indices.push_back(i_b);
-                        indices.push_back(i_c);
-
-                        cell_vertices_visited[a] = true;
-                        cell_vertices_visited[b] = true;
-                        cell_vertices_visited[c] = true;
-                    };
-                    for (uint j = 0; j < cell_count_y - 1; j++) {
-                        for (uint i = 0; i < cell_count_x - 1; i++) {
-                            const uint curr_offset_x = cell_count_x * j;
-                            const uint next_offset_x = cell_count_x * (j + 1);
-                            std::array<uint, 6> face_indices;
-                            if (j % 2 == 0) {
-                                face_indices[0] = curr_offset_x + i;
-                                face_indices[1] = next_offset_x + i;
-                                face_indices[2] = curr_offset_x + i + 1;
-                                face_indices[3] = curr_offset_x + i + 1;
-                                face_indices[4] = next_offset_x + i;
-                                face_indices[5] = next_offset_x + i + 1;
-                            } else {
-                                face_indices[0] = curr_offset_x + i;
-                                face_indices[1] = next_offset_x + i;
-                                face_indices[2] = next_offset_x + i + 1;
-                                face_indices[3] = curr_offset_x + i;
-                                face_indices[4] = next_offset_x + i + 1;
-                                face_indices[5] = curr_offset_x + i + 1;
-                            }
-                            push_face(face_indices[0], face_indices[1], face_indices[2]);
-                            push_face(face_indices[3], face_indices[4], face_indices[5]);
-                        }
+                );
+                vertices.push_back(
+                    AssetVertex {
+                        .position = float3(half_extents, 0.0f, half_extents),
+                        .normal = normal,
+                        .texcoord = float2(1.0f, 1.0f),
+                        .tangent = tangent,
                     }
-
-                    // Verify all vertices were visited.
-                    uint visited_count = 0;
-                    for (uint i = 0; i < cell_vertices.size(); i++) {
-                        if (cell_vertices_visited[i]) {
-                            visited_count++;
-                        } else {
-                            FB_LOG_INFO(
-                                "Was not visited: {}: {}",
-                                i,
-                                (bool)cell_vertices_visited[i]
-                            );
+                );
+                vertices.push_back(
+                    AssetVertex {
+                        .position = float3(half_extents, 0.0f, -half_extents),
+                        .normal = normal,
+                        .texcoord = float2(1.0f, 0.0f),
+                        .tangent = tangent,
+                    }
+                );
+                indices.push_back(0);
+                indices.push_back(1);
+                indices.push_back(2);
+                indices.push_back(0);
+                indices.push_back(2);
+                indices.push_back(3);
+
+                // Submesh.
+                const auto submeshes = std::vector<AssetSubmesh> {
+                    AssetSubmesh {
+                        .index_count = (uint)indices.size(),
+                        .start_index = 0,
+                        .base_vertex = 0,
+                    },
+                };
+
+                // Mesh.
+                auto mesh_assets = write_mesh_assets(
+                    assets_writer,
+                    names,
+                    task.name,
+                    vertices,
+                    indices,
+                    submeshes
+                );
+                std::ranges::move(mesh_assets, std::back_inserter(assets));
+
+                // Texture.
+                const auto color_a = RgbaByte(
+                    (uint8_t)(srgb_from_linear(task.color_a.x) * 255.0f),
+                    (uint8_t)(srgb_from_linear(task.color_a.y) * 255.0f),
+                    (uint8_t)(srgb_from_linear(task.color_a.z) * 255.0f),
+                    (uint8_t)(task.color_a.w * 255.0f)
+                );
+                const auto color_b = RgbaByte(
+                    (uint8_t)(srgb_from_linear(task.color_b.x) * 255.0f),
+                    (uint8_t)(srgb_from_linear(task.color_b.y) * 255.0f),
+                    (uint8_t)(srgb_from_linear(task.color_b.z) * 255.0f),
+                    (uint8_t)(task.color_b.w * 255.0f)
+                );
+                auto image = LdrImage::from_constant(
+                    task.texture_resolution,
+                    task.texture_resolution,
+                    std::array<std::byte, 4> {
+                        (std::byte)(0),
+                        (std::byte)(0),
+                        (std::byte)(0),
+                        (std::byte)(255),
+                    }
+                );
+                image = image.map([&](uint x,
+                                      uint y,
+                                      std::byte& r,
+                                      std::byte& g,
+                                      std::byte& b,
+                                      std::byte& a) {
+                    if (((x + y) & 1) == 0) {
+                        r = (std::byte)color_a.x;
+                        g = (std::byte)color_a.y;
+                        b = (std::byte)color_a.z;
+                        a = (std::byte)255;
+                    } else {
+                        r = (std::byte)color_b.x;
+                        g = (std::byte)color_b.y;
+                        b = (std::byte)color_b.z;
+                        a = (std::byte)255;
+                    }
+                });
+                assets.push_back(mipmapped_texture_asset(
+                    assets_writer,
+                    names.unique(std::format("{}_texture", task.name)),
+                    image,
+                    image.format(),
+                    AssetColorSpace::Srgb
+                ));
+            },
+            [&](const AssetTaskStockcubeOutput& task) {
+                const auto bin_path = std::format("{}/{}", assets_dir, task.bin_path);
+                const auto bin_bytes = FileBuffer::from_path(bin_path);
+                const auto bin_span = bin_bytes.as_span();
+
+                const auto json_path = std::format("{}/{}", assets_dir, task.json_path);
+                const auto json_bytes = FileBuffer::from_path(json_path);
+                const auto json = json::parse(json_bytes.as_span());
+                const auto format = (DXGI_FORMAT)json["format"].template get<uint>();
+                FB_ASSERT(
+                    format == DXGI_FORMAT_R16G16_FLOAT
+                    || format == DXGI_FORMAT_R16G16B16A16_FLOAT
+                );
+                const auto unit_byte_count = json["unit_byte_count"].template get<uint>();
+                const auto width = json["width"].template get<uint>();
+                const auto height = json["height"].template get<uint>();
+                const auto depth = json["depth"].template get<uint>();
+                auto channel_count = 0u;
+                if (format == DXGI_FORMAT_R16G16_FLOAT) {
+                    channel_count = 2u;
+                } else if (format == DXGI_FORMAT_R16G16B16A16_FLOAT) {
+                    channel_count = 4u;
+                } else {
+                    FB_FATAL();
+                }
+                const auto mip_count = json["mip_count"].template get<uint>();
+                FB_ASSERT(mip_count <= MAX_MIP_COUNT);
+
+                if (depth == 6) {
+                    std::array<std::array<AssetTextureData, MAX_MIP_COUNT>, 6> texture_datas = {};
+                    uint64_t offset = 0;
+                    for (uint slice = 0; slice < depth; slice++) {
+                        auto& slice_datas = texture_datas[slice];
+                        for (uint mip = 0; mip < mip_count; mip++) {
+                            const auto mip_width = std::max(1u, width >> mip);
+                            const auto mip_height = std::max(1u, height >> mip);
+                            const auto row_pitch = mip_width * unit_byte_count;
+                            const auto slice_pitch = row_pitch * mip_height;
+                            slice_datas[mip] = AssetTextureData {
+                                .row_pitch = row_pitch,
+                                .slice_pitch = slice_pitch,
+                                .data = assets_writer.write_texture_data(
+                                    bin_span.subspan(offset, slice_pitch)
+                                ),
+                            };
+                            offset += slice_pitch;
                         }
                     }
-                    FB_ASSERT(visited_count == cell_vertices.size());
 
-                    // Submesh.
-                    const auto submeshes = std::vector<AssetSubmesh> {
-                        AssetSubmesh {
-                            .index_count = (uint)indices.size(),
-                            .start_index = 0,
-                            .base_vertex = 0,
-                        },
-                    };
-
-                    // Mesh.
                     assets.emplace_back(
-                        AssetMesh {
-                            .name = names.unique(std::format("{}_mesh", task.name)),
-                            .vertices =
-                                assets_writer.write("Vertex", Span<const AssetVertex>(vertices)),
-                            .indices =
-                                assets_writer.write("Index", Span<const AssetIndex>(indices)),
-                            .submeshes =
-                                assets_writer.write("Submesh", Span<const AssetSubmesh>(submeshes)),
-                        }
-                    );
-                },
-                [&](const AssetTaskProceduralTexturedPlane& task) {
-                    // Generate.
-                    const auto half_extents = task.side_length / 2.0f;
-                    const auto normal = float3(0.0f, 1.0f, 0.0f);
-                    const auto tangent = float4(1.0f, 0.0f, 0.0f, 1.0f);
-                    auto vertices = std::vector<AssetVertex>();
-                    auto indices = std::vector<uint>();
-                    vertices.push_back(
-                        AssetVertex {
-                            .position = float3(-half_extents, 0.0f, -half_extents),
-                            .normal = normal,
-                            .texcoord = float2(0.0f, 0.0f),
-                            .tangent = tangent,
-                        }
-                    );
-                    vertices.push_back(
-                        AssetVertex {
-                            .position = float3(-half_extents, 0.0f, half_extents),
-                            .normal = normal,
-                            .texcoord = float2(0.0f, 1.0f),
-                            .tangent = tangent,
-                        }
-                    );
-                    vertices.push_back(
-                        AssetVertex {
-                            .position = float3(half_extents, 0.0f, half_extents),
-                            .normal = normal,
-                            .texcoord = float2(1.0f, 1.0f),
-                            .tangent = tangent,
-                        }
-                    );
-                    vertices.push_back(
-                        AssetVertex {
-                            .position = float3(half_extents, 0.0f, -half_extents),
-                            .normal = normal,
-                            .texcoord = float2(1.0f, 0.0f),
-                            .tangent = tangent,
+                        AssetCubeTexture {
+                            .name = names.unique(std::string(task.name)),
+                            .format = format,
+                            .width = width,
+                            .height = height,
+                            .channel_count = channel_count,
+                            .mip_count = mip_count,
+                            .datas = texture_datas,
                         }
                     );
-                    indices.push_back(0);
-                    indices.push_back(1);
-                    indices.push_back(2);
-                    indices.push_back(0);
-                    indices.push_back(2);
-                    indices.push_back(3);
-
-                    // Submesh.
-                    const auto submeshes = std::vector<AssetSubmesh> {
-                        AssetSubmesh {
-                            .index_count = (uint)indices.size(),
-                            .start_index = 0,
-                            .base_vertex = 0,
-                        },
-                    };
-
-                    // Mesh.
+                } else {
+                    const auto row_pitch = width * unit_byte_count;
+                    const auto slice_pitch = row_pitch * height;
                     assets.emplace_back(
-                        AssetMesh {
-                            .name = names.unique(std::format("{}_mesh", task.name)),
-                            .vertices =
-                                assets_writer.write("Vertex", Span<const AssetVertex>(vertices)),
-                            .indices =
-                                assets_writer.write("Index", Span<const AssetIndex>(indices)),
-                            .submeshes =
-                                assets_writer.write("Submesh", Span<const AssetSubmesh>(submeshes)),
-                        }
-                    );
-
-                    // Texture.
-                    const auto color_a = RgbaByte(
-                        (uint8_t)(srgb_from_linear(task.color_a.x) * 255.0f),
-                        (uint8_t)(srgb_from_linear(task.color_a.y) * 255.0f),
-                        (uint8_t)(srgb_from_linear(task.color_a.z) * 255.0f),
-                        (uint8_t)(task.color_a.w * 255.0f)
-                    );
-                    const auto color_b = RgbaByte(
-                        (uint8_t)(srgb_from_linear(task.color_b.x) * 255.0f),
-                        (uint8_t)(srgb_from_linear(task.color_b.y) * 255.0f),
-                        (uint8_t)(srgb_from_linear(task.color_b.z) * 255.0f),
-                        (uint8_t)(task.color_b.w * 255.0f)
-                    );
-                    auto image = LdrImage::from_constant(
-                        task.texture_resolution,
-                        task.texture_resolution,
-                        std::array<std::byte, 4> {
-                            (std::byte)(0),
-                            (std::byte)(0),
-                            (std::byte)(0),
-                            (std::byte)(255),
+                        AssetTexture {
+                            .name = std::string(task.name),
+                            .format = format,
+                            .width = width,
+                            .height = height,
+                            .channel_count = channel_count,
+                            .mip_count = mip_count,
+                            .datas = {AssetTextureData {
+                                .row_pitch = row_pitch,
+                                .slice_pitch = slice_pitch,
+                                .data = assets_writer.write_texture_data(bin_span),
+                            }},
                         }
                     );
-                    image = image.map([&](uint x,
-                                          uint y,
-                                          std::byte& r,
-                                          std::byte& g,
-                                          std::byte& b,
-                                          std::byte& a) {
-                        if (((x + y) & 1) == 0) {
-                            r = (std::byte)color_a.x;
-                            g = (std::byte)color_a.y;
-                            b = (std::byte)color_a.z;
-                            a = (std::byte)255;
-                        } else {
-                            r = (std::byte)color_b.x;
-                            g = (std::byte)color_b.y;
-                            b = (std::byte)color_b.z;
-                            a = (std::byte)255;
+                }
+            },
+            [&](const AssetTaskTtf& task) {
+                const auto path = std::format("{}/{}", assets_dir, task.path);
+                const auto file = FileBuffer::from_path(path);
+
+                int ttf_result;
+                ttf_t* ttf = nullptr;
+                ttf_result = ttf_load_from_mem(
+                    (const uint8_t*)file.bytes(),
+                    (int)file.byte_count(),
+                    &ttf,
+                    false
+                );
+                FB_ASSERT_MSG(
+                    ttf_result == TTF_DONE,
+                    "Failed to load TTF file with error {}",
+                    ttf_result
+                );
+
+                std::vector<AssetGlyph> glyphs;
+                std::vector<AssetSubmesh> submeshes;
+                std::vector<AssetVertex> vertices;
+                std::vector<AssetIndex> indices;
+                size_t vertices_offset = 0;
+                size_t indices_offset = 0;
+
+                for (char c = '!'; c <= '~'; c++) {
+                    // Find glyph.
+                    const auto glyph_id = ttf_find_glyph(ttf, c);
+                    FB_ASSERT(glyph_id != -1);
+                    const auto glyph = &ttf->glyphs[glyph_id];
+
+                    // Push glyph info.
+                    glyphs.push_back(
+                        AssetGlyph {
+                            .character = (uint)c,
+                            .xbounds = float2(glyph->xbounds[0], glyph->xbounds[1]),
+                            .ybounds = float2(glyph->ybounds[0], glyph->ybounds[1]),
+                            .advance = glyph->advance,
+                            .lbearing = glyph->lbearing,
+                            .rbearing = glyph->rbearing,
                         }
-                    });
-                    assets.push_back(mipmapped_texture_asset(
-                        assets_writer,
-                        names.unique(std::format("{}_texture", task.name)),
-                        image,
-                        image.format(),
-                        AssetColorSpace::Srgb
-                    ));
-                },
-                [&](const AssetTaskStockcubeOutput& task) {
-                    const auto bin_path = std::format("{}/{}", assets_dir, task.bin_path);
-                    const auto bin_bytes = FileBuffer::from_path(bin_path);
-                    const auto bin_span = bin_bytes.as_span();
-
-                    const auto json_path = std::format("{}/{}", assets_dir, task.json_path);
-                    const auto json_bytes = FileBuffer::from_path(json_path);
-                    const auto json = json::parse(json_bytes.as_span());
-                    const auto format = (DXGI_FORMAT)json["format"].template get<uint>();
-                    FB_ASSERT(
-                        format == DXGI_FORMAT_R16G16_FLOAT
-                        || format == DXGI_FORMAT_R16G16B16A16_FLOAT
                     );
-                    const auto unit_byte_count = json["unit_byte_count"].template get<uint>();
-                    const auto width = json["width"].template get<uint>();
-                    const auto height = json["height"].template get<uint>();
-                    const auto depth = json["depth"].template get<uint>();
-                    auto channel_count = 0u;
-                    if (format == DXGI_FORMAT_R16G16_FLOAT) {
-                        channel_count = 2u;
-                    } else if (format == DXGI_FORMAT_R16G16B16A16_FLOAT) {
-                        channel_count = 4u;
-                    } else {
-                        FB_FATAL();
-                    }
-                    const auto mip_count = json["mip_count"].template get<uint>();
-                    FB_ASSERT(mip_count <= MAX_MIP_COUNT);
-
-                    if (depth == 6) {
-                        std::array<std::array<AssetTextureData, MAX_MIP_COUNT>, 6> texture_datas =
-                            {};
-                        uint64_t offset = 0;
-                        for (uint slice = 0; slice < depth; slice++) {
-                            auto& slice_datas = texture_datas[slice];
-                            for (uint mip = 0; mip < mip_count; mip++) {
-                                const auto mip_width = std::max(1u, width >> mip);
-                                const auto mip_height = std::max(1u, height >> mip);
-                                const auto row_pitch = mip_width * unit_byte_count;
-                                const auto slice_pitch = row_pitch * mip_height;
-                                slice_datas[mip] = AssetTextureData {
-                                    .row_pitch = row_pitch,
-                                    .slice_pitch = slice_pitch,
-                                    .data = assets_writer.write(
-                                        "std::byte",
-                                        bin_span.subspan(offset, slice_pitch)
-                                    ),
-                                };
-                                offset += slice_pitch;
-                            }
-                        }
 
-                        assets.emplace_back(
-                            AssetCubeTexture {
-                                .name = names.unique(std::string(task.name)),
-                                .format = format,
-                                .width = width,
-                                .height = height,
-                                .channel_count = channel_count,
-                                .mip_count = mip_count,
-                                .datas = texture_datas,
-                            }
-                        );
-                    } else {
-                        const auto row_pitch = width * unit_byte_count;
-                        const auto slice_pitch = row_pitch * height;
-                        assets.emplace_back(
-                            AssetTexture {
-                                .name = std::string(task.name),
-                                .format = format,
-                                .width = width,
-                                .height = height,
-                                .channel_count = channel_count,
-                                .mip_count = mip_count,
-                                .datas = {AssetTextureData {
-                                    .row_pitch = row_pitch,
-                                    .slice_pitch = slice_pitch,
-                                    .data = assets_writer.write("std::byte", bin_span),
-                                }},
-                            }
-                        );
-                    }
-                },
-                [&](const AssetTaskTtf& task) {
-                    const auto path = std::format("{}/{}", assets_dir, task.path);
-                    const auto file = FileBuffer::from_path(path);
-
-                    int ttf_result;
-                    ttf_t* ttf = nullptr;
-                    ttf_result = ttf_load_from_mem(
-                        (const uint8_t*)file.bytes(),
-                        (int)file.byte_count(),
-                        &ttf,
-                        false
-                    );
+                    // Generate mesh.
+                    const auto quality = TTF_QUALITY_HIGH;
+                    const auto features = TTF_FEATURES_DFLT;
+                    const auto depth = task.depth;
+                    ttf_mesh3d_t* glyph_mesh = nullptr;
+                    ttf_result = ttf_glyph2mesh3d(glyph, &glyph_mesh, quality, features, depth);
                     FB_ASSERT_MSG(
                         ttf_result == TTF_DONE,
-                        "Failed to load TTF file with error {}",
+                        "Failed to create glyph mesh with error {}",
                         ttf_result
                     );
 
-                    std::vector<AssetGlyph> glyphs;
-                    std::vector<AssetSubmesh> submeshes;
-                    std::vector<AssetVertex> vertices;
-                    std::vector<AssetIndex> indices;
-                    size_t vertices_offset = 0;
-                    size_t indices_offset = 0;
-
-                    for (char c = '!'; c <= '~'; c++) {
-                        // Find glyph.
-                        const auto glyph_id = ttf_find_glyph(ttf, c);
-                        FB_ASSERT(glyph_id != -1);
-                        const auto glyph = &ttf->glyphs[glyph_id];
-
-                        // Push glyph info.
-                        glyphs.push_back(
-                            AssetGlyph {
-                                .character = (uint)c,
-                                .xbounds = float2(glyph->xbounds[0], glyph->xbounds[1]),
-                                .ybounds = float2(glyph->ybounds[0], glyph->ybounds[1]),
-                                .advance = glyph->advance,
-                                .lbearing = glyph->lbearing,
-                                .rbearing = glyph->rbearing,
-                            }
-                        );
+                    // Copy vertices.
+                    const auto base_vertex = (uint)vertices.size();
+                    vertices.resize(vertices.size() + glyph_mesh->nvert);
+                    for (int i = 0; i < glyph_mesh->nvert; i++) {
+                        const auto& v = glyph_mesh->vert[i];
+                        const auto& n = glyph_mesh->normals[i];
+                        vertices[vertices_offset++] = AssetVertex {
+                            .position = float3(v.x, v.y, v.z),
+                            .normal = float3(n.x, n.y, n.z),
+                            .texcoord = float2(0.0f, 0.0f),
+                            .tangent = float4(0.0f, 0.0f, 0.0f, 0.0f),
+                        };
+                    }
 
-                        // Generate mesh.
-                        const auto quality = TTF_QUALITY_HIGH;
-                        const auto features = TTF_FEATURES_DFLT;
-                        const auto depth = task.depth;
-                        ttf_mesh3d_t* glyph_mesh = nullptr;
-                        ttf_result = ttf_glyph2mesh3d(glyph, &glyph_mesh, quality, features, depth);
-                        FB_ASSERT_MSG(
-                            ttf_result == TTF_DONE,
-                            "Failed to create glyph mesh with error {}",
-                            ttf_result
-                        );
+                    // Copy indices.
+                    const auto start_index = (uint)indices.size();
+                    indices.resize(indices.size() + glyph_mesh->nfaces * 3);
+                    for (int i = 0; i < glyph_mesh->nfaces; i++) {
+                        const auto& face = glyph_mesh->faces[i];
+                        indices[indices_offset++] = (AssetIndex)face.v1;
+                        indices[indices_offset++] = (AssetIndex)face.v2;
+                        indices[indices_offset++] = (AssetIndex)face.v3;
+                    }
 
-                        // Copy vertices.
-                        const auto base_vertex = (uint)vertices.size();
-                        vertices.resize(vertices.size() + glyph_mesh->nvert);
-                        for (int i = 0; i < glyph_mesh->nvert; i++) {
-                            const auto& v = glyph_mesh->vert[i];
-                            const auto& n = glyph_mesh->normals[i];
-                            vertices[vertices_offset++] = AssetVertex {
-                                .position = float3(v.x, v.y, v.z),
-                                .normal = float3(n.x, n.y, n.z),
-                                .texcoord = float2(0.0f, 0.0f),
-                                .tangent = float4(0.0f, 0.0f, 0.0f, 0.0f),
-                            };
+                    // Submesh.
+                    submeshes.push_back(
+                        AssetSubmesh {
+                            .index_count = (uint)glyph_mesh->nfaces * 3,
+                            .start_index = start_index,
+                            .base_vertex = base_vertex,
                         }
+                    );
 
-                        // Copy indices.
-                        const auto start_index = (uint)indices.size();
-                        indices.resize(indices.size() + glyph_mesh->nfaces * 3);
-                        for (int i = 0; i < glyph_mesh->nfaces; i++) {
-                            const auto& face = glyph_mesh->faces[i];
-                            indices[indices_offset++] = (AssetIndex)face.v1;
-                            indices[indices_offset++] = (AssetIndex)face.v2;
-                            indices[indices_offset++] = (AssetIndex)face.v3;
-                        }
+                    // Free mesh.
+                    ttf_free_mesh3d(glyph_mesh);
+                }
+
+                // Find space glyph.
+                const auto space_glyph_id = ttf_find_glyph(ttf, ' ');
+                FB_ASSERT(space_glyph_id != -1);
+                const auto space_glyph = &ttf->glyphs[space_glyph_id];
+
+                // Push assets.
+                assets.emplace_back(
+                    AssetFont {
+                        .name = names.unique(std::format("{}_font", task.name)),
+                        .ascender = ttf->hhea.ascender,
+                        .descender = ttf->hhea.descender,
+                        .space_advance = space_glyph->advance,
+                        .glyphs = assets_writer.write("Glyph", Span<const AssetGlyph>(glyphs)),
+                    }
+                );
+                auto mesh_assets = write_mesh_assets(
+                    assets_writer,
+                    names,
+                    task.name,
+                    vertices,
+                    indices,
+                    submeshes
+                );
+                std::ranges::move(mesh_assets, std::back_inserter(assets));
+
+                // Cleanup.
+                ttf_free(ttf);
+            },
+            [&](const AssetTaskNull&) {}
+        },
+        asset_task
+    );
+
+    bin_writer.close();
+    return {
+        std::move(assets),
+        std::make_shared<const AssetTaskBin>(
+            task_bin_path,
+            0,
+            bin_writer.byte_count(),
+            bin_writer.hash(),
+            true
+        ),
+    };
+}
 
-                        // Submesh.
-                        submeshes.push_back(
-                            AssetSubmesh {
-                                .index_count = (uint)glyph_mesh->nfaces * 3,
-                                .start_index = start_index,
-                                .base_vertex = base_vertex,
-                            }
-                        );
+struct StoredSpan {
+    size_t offset;
+    size_t byte_count;
+};
 
-                        // Free mesh.
-                        ttf_free_mesh3d(glyph_mesh);
+auto bake_assets(
+    ThreadPool& pool,
+    BakeProfiler& profiler,
+    AssetCache& cache,
+    AssetTaskMemo& memo,
+    std::string_view assets_dir,
+    Span<const AssetTask> asset_tasks,
+    FileWriter& writer,
+    BakeFarm* farm
+) -> std::tuple<std::vector<Asset>, AssetsBin> {
+    // Task bins are copied to the writer in declaration order, as soon as
+    // every bin before them is written, which keeps the output byte-for-byte
+    // identical regardless of the execution order. Task bins are files, and
+    // are copied span by span in bounded chunks, so the memory taken by the
+    // data is the working set of the tasks in flight, one per thread, plus one
+    // copy chunk. Pending outputs only hold their assets and a reference to
+    // their bin. One worker at a time writes, and the others hand their output
+    // over and move on: workers never wait, as they are shared with the other
+    // apps and nested parallel loops, so finished tasks behind a slow one keep
+    // their temporary bins on disk until it is written. Spans
+    // are deduplicated by hash, so repeated payloads are stored once per bin,
+    // and padded with zeros to their alignment. Tasks left to a farm are only
+    // submitted by the workers, and the caller waits for their jobs, in order,
+    // once the local tasks are done.
+    FB_ASSERT(writer.byte_count() == 0);
+    const auto task_count = asset_tasks.size();
+    auto task_outputs = std::vector<AssetTaskOutput>(task_count);
+    auto task_baked = std::vector<bool>(task_count, false);
+    auto task_submitted = std::vector<uint8_t>(task_count, 0);
+    auto written_count = size_t(0);
+    auto stored_spans = std::unordered_map<Hash128, StoredSpan>();
+    auto deduplicated_byte_count = size_t(0);
+    auto padding_byte_count = size_t(0);
+    static constexpr auto PADDING = std::array<std::byte, ASSET_MAX_ALIGNMENT> {};
+    auto write_mutex = std::mutex();
+    auto writing = false;
+
+    // Keys of every task up front, so that the shared cache can fetch entries
+    // while tasks bake.
+    auto keys = std::vector<Hash128>(task_count);
+    if (cache.enabled()) {
+        pool.parallel_for(task_count, [&](size_t task_index) {
+            keys[task_index] = asset_task_key(assets_dir, asset_tasks[task_index]);
+        });
+        cache.prefetch(keys);
+    }
+
+    // Unless another worker is already writing, write every bin that is next
+    // in line, and release it. Spans whose bytes were already written point at
+    // the stored copy instead.
+    const auto write_next_bins = [&](std::unique_lock<std::mutex>& lock) {
+        if (writing) {
+            return;
+        }
+        writing = true;
+        while (written_count < task_count && task_baked[written_count]) {
+            auto& output = task_outputs[written_count];
+            lock.unlock();
+            const auto& bin = *output.bin;
+            for (auto& asset : output.assets) {
+                for_each_asset_span(asset, [&](AssetSpan& span) {
+                    FB_ASSERT(ASSET_MAX_ALIGNMENT % span.alignment == 0);
+                    const auto stored = stored_spans.find(span.hash);
+                    if (stored != stored_spans.end()
+                        && stored->second.byte_count == span.byte_count
+                        && stored->second.offset % span.alignment == 0) {
+                        span.offset = stored->second.offset;
+                        deduplicated_byte_count += span.byte_count;
+                        return;
                     }
+                    const auto offset = align_up(writer.byte_count(), span.alignment);
+                    const auto padding = offset - writer.byte_count();
+                    writer.write(Span<const std::byte>(PADDING).first(padding));
+                    padding_byte_count += padding;
+                    FB_ASSERT(span.offset + span.byte_count <= bin.byte_count());
+                    writer.write_file(bin.path(), bin.offset() + span.offset, span.byte_count);
+                    stored_spans.insert_or_assign(span.hash, StoredSpan {offset, span.byte_count});
+                    span.offset = offset;
+                });
+            }
+            output.bin = nullptr;
+            lock.lock();
+            written_count++;
+        }
+        writing = false;
+    };
+    const auto zone_name = [](const AssetTask& asset_task) {
+        return std::format(
+            "{} {}",
+            asset_task_name(asset_task.index()),
+            asset_task_label(asset_task)
+        );
+    };
 
-                    // Find space glyph.
-                    const auto space_glyph_id = ttf_find_glyph(ttf, ' ');
-                    FB_ASSERT(space_glyph_id != -1);
-                    const auto space_glyph = &ttf->glyphs[space_glyph_id];
+    // Bake.
+    FB_LOG_INFO("Baking {} asset tasks ({} threads)", task_count, pool.thread_count());
+    auto completed_count = std::atomic<size_t>(0);
+    pool.parallel_for(task_count, [&](size_t task_index) {
+        const auto& asset_task = asset_tasks[task_index];
+        const auto task_timer = Instant();
+        auto status = "shared"sv;
+        auto task_output = AssetTaskOutput();
+        {
+            auto zone = BakeZoneScope(profiler, "asset"sv, zone_name(asset_task));
+            task_output = memo.take(asset_task_params_key(asset_task), [&]() {
+                const auto key = keys[task_index];
+                if (cache.enabled()) {
+                    if (auto cached = cache.load(key); cached.has_value()) {
+                        status = "hit"sv;
+                        return std::move(cached.value());
+                    }
+                }
+                status = cache.enabled() ? "miss"sv : "uncached"sv;
+                if (farm != nullptr) {
+                    task_submitted[task_index] = 1;
+                    return farm->submit_asset_task(assets_dir, asset_task);
+                }
+                auto output = bake_asset_task(assets_dir, asset_task, &pool);
+                cache.store(key, output);
+                return output;
+            });
+            if (task_output.bin != nullptr) {
+                zone.set_byte_count(task_output.bin->byte_count());
+            }
+        }
 
-                    // Push assets.
-                    assets.emplace_back(
-                        AssetFont {
-                            .name = names.unique(std::format("{}_font", task.name)),
-                            .ascender = ttf->hhea.ascender,
-                            .descender = ttf->hhea.descender,
-                            .space_advance = space_glyph->advance,
-                            .glyphs = assets_writer.write("Glyph", Span<const AssetGlyph>(glyphs)),
-                        }
-                    );
-                    assets.emplace_back(
-                        AssetMesh {
-                            .name = names.unique(std::format("{}_mesh", task.name)),
-                            .vertices =
-                                assets_writer.write("Vertex", Span<const AssetVertex>(vertices)),
-                            .indices =
-                                assets_writer.write("Index", Span<const AssetIndex>(indices)),
-                            .submeshes =
-                                assets_writer.write("Submesh", Span<const AssetSubmesh>(submeshes)),
-                        }
-                    );
+        // Jobs of the farm are waited for below.
+        if (task_output.remote != nullptr) {
+            const auto lock = std::scoped_lock(write_mutex);
+            task_outputs[task_index] = std::move(task_output);
+            return;
+        }
+        FB_LOG_INFO(
+            "{}/{} - {} - {} - {:.3f} s",
+            ++completed_count,
+            task_count,
+            asset_task_name(asset_task.index()),
+            status,
+            task_timer.elapsed_time()
+        );
 
-                    // Cleanup.
-                    ttf_free(ttf);
-                },
-                [&](const AssetTaskNull&) {}
-            },
-            asset_task
+        // Hand the output over.
+        auto lock = std::unique_lock(write_mutex);
+        task_outputs[task_index] = std::move(task_output);
+        task_baked[task_index] = true;
+        write_next_bins(lock);
+    });
+
+    // Wait for the jobs of the farm, in order, on this thread rather than a
+    // pool thread per job. Tasks shared with another bake may be waited for
+    // by both, and are stored in the cache by the one that submitted them.
+    for (size_t task_index = 0; task_index < task_count; task_index++) {
+        if (task_outputs[task_index].remote == nullptr) {
+            continue;
+        }
+        FB_ASSERT(farm != nullptr);
+        const auto& asset_task = asset_tasks[task_index];
+        const auto task_timer = Instant();
+        auto task_output = AssetTaskOutput();
+        {
+            auto zone = BakeZoneScope(profiler, "farm"sv, zone_name(asset_task));
+            task_output = farm->asset_task_output(task_outputs[task_index].remote, &pool);
+            zone.set_byte_count(task_output.bin->byte_count());
+        }
+        if (task_submitted[task_index] != 0) {
+            cache.store(keys[task_index], task_output);
+        }
+        FB_LOG_INFO(
+            "{}/{} - {} - {} - {:.3f} s",
+            ++completed_count,
+            task_count,
+            asset_task_name(asset_task.index()),
+            task_submitted[task_index] != 0 ? "farm"sv : "shared"sv,
+            task_timer.elapsed_time()
         );
+
+        auto lock = std::unique_lock(write_mutex);
+        task_outputs[task_index] = std::move(task_output);
+        task_baked[task_index] = true;
+        write_next_bins(lock);
     }
+    FB_ASSERT(written_count == task_count);
 
-    return {assets, assets_bin};
+    // Gather assets.
+    auto assets = std::vector<Asset>();
+    auto task_asset_counts = std::vector<uint>();
+    auto names = UniqueNames();
+    for (auto& task_output : task_outputs) {
+        task_asset_counts.push_back((uint)task_output.assets.size());
+        for (auto& asset : task_output.assets) {
+            names.unique(asset_name(asset));
+            assets.push_back(std::move(asset));
+        }
+    }
+
+    return {
+        std::move(assets),
+        AssetsBin {
+            .byte_count = writer.byte_count(),
+            .hash = writer.hash(),
+            .deduplicated_byte_count = deduplicated_byte_count,
+            .padding_byte_count = padding_byte_count,
+            .task_asset_counts = std::move(task_asset_counts),
+        },
+    };
 }
 
 } // namespace fb
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "types.hpp"
+#include "mesh_lod.hpp"
+#include "mesh_weld.hpp"
+#include "../utils/profiler.hpp"
+#include "../utils/thread_pool.hpp"
 
 namespace fb {
 
@@ -29,6 +33,10 @@ struct AssetTaskHdrTexture {
 struct AssetTaskGltf {
     std::string_view name;
     std::string_view path;
+    WeldEpsilons weld_epsilons = {};
+    AssetLodChain lods = {};
+    bool compact_vertices = false;
+    bool short_index_chunks = false;
 };
 
 struct AssetTaskProceduralCube {
@@ -105,7 +113,56 @@ FB_INLINE constexpr auto asset_task_name(size_t variant) -> std::string_view {
     }
 }
 
-auto bake_assets(std::string_view assets_dir, Span<const AssetTask> asset_tasks)
-    -> std::tuple<std::vector<Asset>, std::vector<std::byte>>;
+// Name given to the task in its declaration, empty for the null task.
+inline auto asset_task_label(const AssetTask& asset_task) -> std::string_view {
+    return std::visit(
+        overloaded {
+            [](const AssetTaskNull&) { return std::string_view(); },
+            [](const auto& task) { return task.name; },
+        },
+        asset_task
+    );
+}
+
+class AssetCache;
+class AssetTaskMemo;
+class BakeFarm;
+
+// Bakes one task into its own bin, a temporary file. Span offsets are relative
+// to the bin. Steps that split into independent work run it on `pool` when
+// there is one.
+auto bake_asset_task(
+    std::string_view assets_dir,
+    const AssetTask& asset_task,
+    ThreadPool* pool = nullptr
+) -> AssetTaskOutput;
+
+// Asset data written by `bake_assets`. Spans with identical bytes share one
+// copy, `deduplicated_byte_count` is what the other copies would have taken.
+// Every span starts at a multiple of its alignment, `padding_byte_count` is
+// what that took. Assets are in task order, `task_asset_counts` per task.
+struct AssetsBin {
+    size_t byte_count;
+    Hash128 hash;
+    size_t deduplicated_byte_count;
+    size_t padding_byte_count;
+    std::vector<uint> task_asset_counts;
+};
+
+// Bakes all tasks on the pool, reusing cached outputs where the task's key hits,
+// and outputs of identical tasks baked by other apps through `memo`. With a
+// `farm`, the remaining tasks are baked by its workers. The data is streamed to
+// `writer`, which must be empty, with span offsets from its start, and is
+// identical to a serial, uncached bake.
+auto bake_assets(
+    ThreadPool& pool,
+    BakeProfiler& profiler,
+    AssetCache& cache,
+    AssetTaskMemo& memo,
+    std::string_view assets_dir,
+    Span<const AssetTask> asset_tasks,
+    FileWriter& writer,
+    BakeFarm* farm = nullptr
+) -> std::tuple<std::vector<Asset>, AssetsBin>;
 
 } // namespace fb
@@ -4,11 +4,20 @@
 
 namespace fb {
 
+// Spans start at a multiple of their alignment in the assets bin, which lets
+// loaders hand them out without copies. Texture data is aligned like D3D12
+// placed subresources (`D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT`).
+inline constexpr size_t ASSET_SPAN_ALIGNMENT = 16;
+inline constexpr size_t ASSET_TEXTURE_DATA_ALIGNMENT = 512;
+inline constexpr size_t ASSET_MAX_ALIGNMENT = 512;
+
 struct AssetSpan {
     std::string type;
     size_t offset;
     size_t element_count;
     size_t byte_count;
+    size_t alignment;
+    Hash128 hash;
 };
 
 struct AssetCopy {
@@ -32,7 +41,29 @@ struct AssetSkinningVertex {
     float4 weight;
 };
 
+// Optional copies of the vertices above, a third of their size. The layout
+// is `baked::CompactVertex`, filled by `compact_vertices`.
+struct AssetCompactVertex {
+    uint position_xy;
+    uint position_z_tangent;
+    uint normal;
+    uint texcoord;
+};
+
+struct AssetCompactSkinningVertex {
+    AssetCompactVertex vertex;
+    uint joints;
+    uint weights;
+};
+
+// Compact positions decode to `position_min + position * position_scale`.
+struct AssetVertexQuantization {
+    float3 position_min;
+    float3 position_scale;
+};
+
 using AssetIndex = uint;
+using AssetShortIndex = uint16_t;
 
 struct AssetSubmesh {
     uint index_count;
@@ -40,13 +71,55 @@ struct AssetSubmesh {
     uint base_vertex;
 };
 
+// Box and sphere around the vertices of a mesh or submesh, in mesh space.
+// Skinned meshes are bounded in their bind pose.
+struct AssetBounds {
+    float3 min;
+    float3 max;
+    float3 center;
+    float radius;
+};
+
+// Level of detail of a mesh, as submeshes from `start_submesh` in its LOD
+// submeshes. `error` is how far its surface strays from the mesh's, in mesh
+// units.
+struct AssetMeshLod {
+    uint start_submesh;
+    float error;
+};
+
+// Vertex count of a mesh in its source, and as baked once welded. Post-transform
+// vertex cache misses, with its triangles in source order and as baked,
+// simulated by `vertex_cache_miss_count`. Only reported, not written to the bin.
+struct AssetMeshStats {
+    uint source_vertex_count;
+    uint vertex_count;
+    uint triangle_count;
+    uint source_miss_count;
+    uint miss_count;
+};
+
+// Indices of meshes and animation meshes are 16 bits, in `short_indices` and
+// `short_lod_indices`, if `index_format` is `DXGI_FORMAT_R16_UINT`, and 32 bits
+// in `indices` and `lod_indices` otherwise. The other spans are empty.
 struct AssetMesh {
     std::string name;
 
     float4x4 transform;
     AssetSpan vertices;
+    DXGI_FORMAT index_format;
     AssetSpan indices;
+    AssetSpan short_indices;
     AssetSpan submeshes;
+    AssetBounds bounds;
+    AssetSpan submesh_bounds;
+    AssetSpan lod_indices;
+    AssetSpan short_lod_indices;
+    AssetSpan lod_submeshes;
+    AssetSpan lods;
+    AssetVertexQuantization quantization;
+    AssetSpan compact_vertices;
+    AssetMeshStats stats;
 };
 
 struct AssetTextureData {
@@ -100,8 +173,18 @@ struct AssetAnimationMesh {
     float duration;
 
     AssetSpan skinning_vertices;
+    DXGI_FORMAT index_format;
     AssetSpan indices;
+    AssetSpan short_indices;
     AssetSpan submeshes;
+    AssetBounds bounds;
+    AssetSpan submesh_bounds;
+    AssetSpan lod_indices;
+    AssetSpan short_lod_indices;
+    AssetSpan lod_submeshes;
+    AssetSpan lods;
+    AssetVertexQuantization quantization;
+    AssetSpan compact_skinning_vertices;
     AssetSpan joint_nodes;
     AssetSpan joint_inverse_binds;
     AssetSpan node_parents;
@@ -112,6 +195,7 @@ struct AssetAnimationMesh {
     AssetSpan node_channels_values_t;
     AssetSpan node_channels_values_r;
     AssetSpan node_channels_values_s;
+    AssetMeshStats stats;
 };
 
 struct AssetGlyph {
@@ -132,6 +216,37 @@ struct AssetFont {
     AssetSpan glyphs;
 };
 
+// Meshlets hold at most this many vertices and triangles, the limits NVIDIA
+// recommends for mesh shaders, under the 256 vertices and primitives of D3D12.
+inline constexpr uint MESHLET_MAX_VERTEX_COUNT = 64;
+inline constexpr uint MESHLET_MAX_TRIANGLE_COUNT = 124;
+
+struct AssetMeshlet {
+    uint vertex_offset;
+    uint vertex_count;
+    uint triangle_offset;
+    uint triangle_count;
+    float3 center;
+    float radius;
+    float3 cone_apex;
+    float3 cone_axis;
+    float cone_cutoff;
+};
+
+struct AssetMeshletSubmesh {
+    uint meshlet_count;
+    uint start_meshlet;
+};
+
+struct AssetMeshlets {
+    std::string name;
+
+    AssetSpan meshlets;
+    AssetSpan vertices;
+    AssetSpan triangles;
+    AssetSpan submeshes;
+};
+
 using Asset = std::variant<
     AssetCopy,
     AssetMesh,
@@ -139,6 +254,129 @@ using Asset = std::variant<
     AssetCubeTexture,
     AssetMaterial,
     AssetAnimationMesh,
-    AssetFont>;
+    AssetFont,
+    AssetMeshlets>;
+
+// Bytes that the spans of one asset task point into: a range of a file, so
+// that they never have to be held in memory. Temporary files of the task are
+// deleted with the last output referring to them. Cache entries, which are
+// referred to in place, are left alone.
+class AssetTaskBin {
+    FB_NO_COPY_MOVE(AssetTaskBin);
+
+public:
+    AssetTaskBin(std::string path, uint64_t offset, uint64_t byte_count, Hash128 hash, bool temp)
+        : _path(std::move(path))
+        , _offset(offset)
+        , _byte_count(byte_count)
+        , _hash(hash)
+        , _temp(temp) {}
+
+    ~AssetTaskBin() {
+        if (_temp) {
+            delete_file(_path);
+        }
+    }
+
+    auto path() const -> std::string_view { return _path; }
+    auto offset() const -> uint64_t { return _offset; }
+    auto byte_count() const -> uint64_t { return _byte_count; }
+    auto hash() const -> Hash128 { return _hash; }
+
+    // Bytes of the whole bin, or of one of its spans.
+    auto read() const -> std::vector<std::byte> {
+        return read_file_range(_path, _offset, _byte_count);
+    }
+    auto read(size_t span_offset, size_t span_byte_count) const -> std::vector<std::byte> {
+        return read_file_range(_path, _offset + span_offset, span_byte_count);
+    }
+
+private:
+    std::string _path;
+    uint64_t _offset;
+    uint64_t _byte_count;
+    Hash128 _hash;
+    bool _temp;
+};
+
+struct BakeFarmJob;
+
+// Assets produced by one asset task, with span offsets relative to `bin`.
+// Copies share the bin. While a farm bakes the task, only `remote` is set.
+struct AssetTaskOutput {
+    std::vector<Asset> assets;
+    std::shared_ptr<const AssetTaskBin> bin;
+    std::shared_ptr<BakeFarmJob> remote;
+};
+
+inline auto asset_name(const Asset& asset) -> const std::string& {
+    return std::visit([](const auto& a) -> const std::string& { return a.name; }, asset);
+}
+
+// Calls `f(AssetSpan&)` for every span the asset points to, in the same order
+// they were written by the asset task.
+template<typename F>
+auto for_each_asset_span(Asset& asset, F&& f) -> void {
+    std::visit(
+        overloaded {
+            [&](AssetCopy& a) { f(a.data); },
+            [&](AssetMesh& a) {
+                f(a.vertices);
+                f(a.indices);
+                f(a.short_indices);
+                f(a.submeshes);
+                f(a.submesh_bounds);
+                f(a.lod_indices);
+                f(a.short_lod_indices);
+                f(a.lod_submeshes);
+                f(a.lods);
+                f(a.compact_vertices);
+            },
+            [&](AssetTexture& a) {
+                for (uint mip = 0; mip < a.mip_count; mip++) {
+                    f(a.datas[mip].data);
+                }
+            },
+            [&](AssetCubeTexture& a) {
+                for (uint slice = 0; slice < 6; slice++) {
+                    for (uint mip = 0; mip < a.mip_count; mip++) {
+                        f(a.datas[slice][mip].data);
+                    }
+                }
+            },
+            [&](AssetMaterial&) {},
+            [&](AssetAnimationMesh& a) {
+                f(a.skinning_vertices);
+                f(a.indices);
+                f(a.short_indices);
+                f(a.submeshes);
+                f(a.submesh_bounds);
+                f(a.lod_indices);
+                f(a.short_lod_indices);
+                f(a.lod_submeshes);
+                f(a.lods);
+                f(a.compact_skinning_vertices);
+                f(a.joint_nodes);
+                f(a.joint_inverse_binds);
+                f(a.node_parents);
+                f(a.node_channels);
+                f(a.node_channels_times_t);
+                f(a.node_channels_times_r);
+                f(a.node_channels_times_s);
+                f(a.node_channels_values_t);
+                f(a.node_channels_values_r);
+                f(a.node_channels_values_s);
+            },
+            [&](AssetFont& a) { f(a.glyphs); },
+            [&](AssetMeshlets& a) {
+                f(a.meshlets);
+                f(a.vertices);
+                f(a.triangles);
+                f(a.submeshes);
+            },
+        },
+        asset
+    );
+}
 
 } // namespace fb
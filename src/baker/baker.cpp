@@ -2,10 +2,16 @@
 #include "shaders/shaders.hpp"
 #include "formats/gltf.hpp"
 #include "utils/names.hpp"
+#include "utils/thread_pool.hpp"
 
+#include "assets/cache.hpp"
 #include "assets/tasks.hpp"
 #include "assets/types.hpp"
+#include "farm/farm.hpp"
 #include "outputs/outputs.hpp"
+#include "outputs/watch.hpp"
+
+#include <charconv>
 
 namespace fb {
 
@@ -19,6 +25,12 @@ static auto KITCHEN_SHADER_TASKS = std::to_array<ShaderTask>({
     {"kitchen/kcn/spd.hlsl", "spd", {"downsample_cs"}},
 });
 
+// Levels of detail for the denser models, down to an eighth of the triangles.
+static constexpr auto MODEL_LODS = AssetLodChain {
+    .level_count = 3,
+    .levels = {{{0.5f, 0.01f}, {0.25f, 0.02f}, {0.125f, 0.05f}}},
+};
+
 static auto BUFFET_ASSET_TASKS = std::to_array<AssetTask>({
     AssetTaskTexture {
         "heatmap_magma",
@@ -32,9 +44,17 @@ static auto BUFFET_ASSET_TASKS = std::to_array<AssetTask>({
         GLTF_BASE_COLOR_TEXTURE_FORMAT,
         AssetColorSpace::Srgb,
     },
-    AssetTaskGltf {"sci_fi_case", "models/sci_fi_case.glb"},
+    AssetTaskGltf {
+        .name = "sci_fi_case",
+        .path = "models/sci_fi_case.glb",
+        .lods = MODEL_LODS,
+    },
     AssetTaskGltf {"metal_plane", "models/metal_plane.glb"},
-    AssetTaskGltf {"coconut_tree", "models/coconut_tree.glb"},
+    AssetTaskGltf {
+        .name = "coconut_tree",
+        .path = "models/coconut_tree.glb",
+        .lods = MODEL_LODS,
+    },
     AssetTaskTexture {
         .name = "sand",
         .path = "models/sand.png",
@@ -49,8 +69,16 @@ static auto BUFFET_ASSET_TASKS = std::to_array<AssetTask>({
         .height_variation = 0.5f,
     },
     AssetTaskGltf {"raccoon", "models/low-poly_racoon_run_animation.glb"},
-    AssetTaskGltf {"mixamo_run_female", "models/mixamo_run_female_60fps.glb"},
-    AssetTaskGltf {"mixamo_run_male", "models/mixamo_run_male_60fps.glb"},
+    AssetTaskGltf {
+        .name = "mixamo_run_female",
+        .path = "models/mixamo_run_female_60fps.glb",
+        .lods = MODEL_LODS,
+    },
+    AssetTaskGltf {
+        .name = "mixamo_run_male",
+        .path = "models/mixamo_run_male_60fps.glb",
+        .lods = MODEL_LODS,
+    },
     AssetTaskProceduralCube {"light_bounds", 2.0f, false},
     AssetTaskProceduralCube {"skybox", 2.0f, true},
     AssetTaskProceduralSphere {"sphere", 1.0f, 32, false},
@@ -239,12 +267,52 @@ static auto RAYDIANCE_SHADER_TASKS = std::array<ShaderTask, 0>();
 
 } // namespace fb
 
-auto main() -> int {
+auto main(int argc, char** argv) -> int {
     using namespace fb;
 
+    // Worker processes of a bake farm only serve their coordinator.
+    if (const auto exit_code = bake_worker_main(argc, argv)) {
+        return exit_code.value();
+    }
+
     // Console.
     attach_console();
 
+    // Arguments: `--bake-workers <count>` bakes with a farm of worker processes,
+    // and `--watch` keeps rebaking on changes after the first bake. Filters
+    // select part of the bake: `--apps <name,...>` bakes these apps only, and
+    // `--tasks <glob>`, `--shaders-only` and `--assets-only` bake the matching
+    // tasks only, and splice them into the existing bins.
+    auto farm_worker_count = 0u;
+    auto watch = false;
+    auto filter = BakeFilter();
+    for (int i = 1; i < argc; i++) {
+        const auto arg = std::string_view(argv[i]);
+        if (arg == "--watch") {
+            watch = true;
+        } else if (arg == "--apps" && i + 1 < argc) {
+            for (auto names = std::string_view(argv[++i]); !names.empty();) {
+                const auto comma = std::min(names.find(','), names.size());
+                filter.app_names.push_back(names.substr(0, comma));
+                names.remove_prefix(std::min(comma + 1, names.size()));
+            }
+        } else if (arg == "--tasks" && i + 1 < argc) {
+            filter.task_glob = std::string_view(argv[++i]);
+        } else if (arg == "--shaders-only") {
+            filter.assets = false;
+        } else if (arg == "--assets-only") {
+            filter.shaders = false;
+        } else if (arg == "--bake-workers" && i + 1 < argc) {
+            const auto count = std::string_view(argv[++i]);
+            const auto [end, error] =
+                std::from_chars(count.data(), count.data() + count.size(), farm_worker_count);
+            FB_ASSERT_MSG(error == std::errc(), "Invalid worker count: {}", count);
+        } else {
+            FB_ASSERT_MSG(false, "Unknown argument: {}", arg);
+        }
+    }
+    FB_ASSERT_MSG(filter.shaders || filter.assets, "Nothing to bake");
+
     // Timing.
     const auto timer = Instant();
 
@@ -265,14 +333,90 @@ auto main() -> int {
     const auto stockcube_outputs = std::to_array({sv(FB_BAKER_STOCKCUBE_OUTPUT_DIR)});
     const auto griddle_outputs = std::to_array({sv(FB_BAKER_GRIDDLE_OUTPUT_DIR)});
     const auto raydiance_outputs = std::to_array({sv(FB_BAKER_RAYDIANCE_OUTPUT_DIR)});
-    bake_app_datas(kitchen_outputs, "kitchen", KITCHEN_ASSET_TASKS, KITCHEN_SHADER_TASKS);
-    bake_app_datas(buffet_outputs, "buffet", BUFFET_ASSET_TASKS, BUFFET_SHADER_TASKS);
-    bake_app_datas(stockcube_outputs, "stockcube", STOCKCUBE_ASSET_TASKS, STOCKCUBE_SHADER_TASKS);
-    bake_app_datas(griddle_outputs, "griddle", {}, GRIDDLE_SHADER_TASKS);
-    bake_app_datas(raydiance_outputs, "raydiance", RAYDIANCE_ASSET_TASKS, RAYDIANCE_SHADER_TASKS);
+    auto pool = ThreadPool();
+    auto profiler = BakeProfiler();
+    auto shared_cache = shared_cache_client_from_env();
+    auto shader_sources = ShaderSourceCache();
+    auto shader_cache =
+        ShaderCache(std::format("{}/shaders", FB_BAKER_CACHE_DIR), shared_cache.get());
+    auto asset_cache = AssetCache(std::format("{}/assets", FB_BAKER_CACHE_DIR), shared_cache.get());
+    auto asset_memo = AssetTaskMemo();
+    auto output_hashes = OutputHashes(std::format("{}/outputs.bin", FB_BAKER_CACHE_DIR));
+    auto farm = std::unique_ptr<BakeFarm>();
+    if (farm_worker_count > 0) {
+        farm = std::make_unique<BakeFarm>(farm_worker_count, [](uint16_t port) {
+            return launch_bake_worker_process(port);
+        });
+    }
+    auto context = BakeContext {
+        .pool = pool,
+        .profiler = profiler,
+        .shader_sources = shader_sources,
+        .shader_cache = shader_cache,
+        .asset_cache = asset_cache,
+        .asset_memo = asset_memo,
+        .output_hashes = output_hashes,
+        .farm = farm.get(),
+    };
+    const auto apps = std::to_array<AppTasks>({
+        {"kitchen", kitchen_outputs, KITCHEN_ASSET_TASKS, KITCHEN_SHADER_TASKS},
+        {"buffet", buffet_outputs, BUFFET_ASSET_TASKS, BUFFET_SHADER_TASKS},
+        {"stockcube", stockcube_outputs, STOCKCUBE_ASSET_TASKS, STOCKCUBE_SHADER_TASKS},
+        {"griddle", griddle_outputs, {}, GRIDDLE_SHADER_TASKS},
+        {"raydiance", raydiance_outputs, RAYDIANCE_ASSET_TASKS, RAYDIANCE_SHADER_TASKS},
+    });
+    auto selected_apps = std::vector<AppTasks>();
+    for (const auto& app : apps) {
+        if (filter.selects_app(app.app_name)) {
+            selected_apps.push_back(app);
+        }
+    }
+    for (const auto app_name : filter.app_names) {
+        const auto known = std::find_if(apps.begin(), apps.end(), [&](const AppTasks& app) {
+            return app.app_name == app_name;
+        });
+        FB_ASSERT_MSG(known != apps.end(), "Unknown app: {}", app_name);
+    }
+    if (filter.selects_all_tasks()) {
+        bake_app_datas(context, selected_apps);
+    } else {
+        splice_app_datas(context, selected_apps, filter);
+    }
 
     // Timing.
-    FB_LOG_INFO("Bake time: {} s", timer.elapsed_time());
+    FB_LOG_INFO(
+        "Bake time: {} s (shader cache: {} hits, {} misses, asset cache: {} hits, {} misses)",
+        timer.elapsed_time(),
+        shader_cache.hit_count(),
+        shader_cache.miss_count(),
+        asset_cache.hit_count(),
+        asset_cache.miss_count()
+    );
+    if (farm) {
+        FB_LOG_INFO(
+            "Bake farm: {} workers, {} crashed, {} timed out, {} jobs reassigned, {} jobs baked "
+            "locally",
+            farm->worker_count(),
+            farm->crashed_worker_count(),
+            farm->timed_out_worker_count(),
+            farm->reassigned_job_count(),
+            farm->local_job_count()
+        );
+    }
+    if (shared_cache) {
+        shared_cache->flush();
+        FB_LOG_INFO(
+            "Shared cache: {} hits, {} misses, {} puts",
+            shared_cache->hit_count(),
+            shared_cache->miss_count(),
+            shared_cache->put_count()
+        );
+    }
+
+    // Watch, until the process is killed.
+    if (watch) {
+        watch_app_datas(context, selected_apps, BAKE_WATCH_POLL_INTERVAL, []() { return false; });
+    }
 
     return 0;
 }
@@ -0,0 +1,572 @@
+#include "farm.hpp"
+#include "../assets/cache.hpp"
+#include "../utils/sockets.hpp"
+
+#include <charconv>
+
+namespace fb {
+
+//
+// Messages.
+//
+
+struct BakeFarmMessage {
+    BakeFarmOp op;
+    std::vector<std::byte> payload;
+};
+
+static auto send_message(uintptr_t socket, BakeFarmOp op, Span<const std::byte> payload) -> bool {
+    const auto frame = BakeFarmFrame {
+        .magic = BAKE_FARM_MAGIC,
+        .version = BAKE_FARM_VERSION,
+        .op = op,
+        .reserved = 0,
+        .byte_count = payload.size(),
+        .hash = hash128(payload),
+    };
+    return socket_send_all(socket, std::as_bytes(Span<const BakeFarmFrame>(&frame, 1)))
+        && socket_send_all(socket, payload);
+}
+
+static auto recv_message(uintptr_t socket) -> Option<BakeFarmMessage> {
+    auto frame = BakeFarmFrame {};
+    if (!socket_recv_all(socket, std::as_writable_bytes(Span<BakeFarmFrame>(&frame, 1)))
+        || frame.magic != BAKE_FARM_MAGIC || frame.version != BAKE_FARM_VERSION) {
+        return std::nullopt;
+    }
+    auto payload = std::vector<std::byte>(frame.byte_count);
+    if (!socket_recv_all(socket, payload)) {
+        return std::nullopt;
+    }
+    if (frame.hash != hash128(payload)) {
+        FB_LOG_WARN("Bake farm: corrupted message");
+        return std::nullopt;
+    }
+    return BakeFarmMessage {frame.op, std::move(payload)};
+}
+
+template<size_t I = 0>
+static auto asset_task_from_index(size_t index) -> AssetTask {
+    if constexpr (I < std::variant_size_v<AssetTask>) {
+        if (index == I) {
+            return AssetTask(std::in_place_index<I>);
+        }
+        return asset_task_from_index<I + 1>(index);
+    } else {
+        FB_FATAL();
+    }
+}
+
+// Tasks refer to their strings, which are owned by `strings` once deserialized.
+template<Archive A>
+static auto archive(AssetTask& asset_task, A& arc, std::deque<std::string>& strings) -> void {
+    auto index = (uint)asset_task.index();
+    arc & index;
+    if constexpr (std::is_same_v<A, DeserializingArchive>) {
+        asset_task = asset_task_from_index(index);
+    }
+
+    const auto string = [&](std::string_view& view) {
+        auto value = std::string(view);
+        arc & value;
+        if constexpr (std::is_same_v<A, DeserializingArchive>) {
+            view = strings.emplace_back(std::move(value));
+        }
+    };
+    std::visit(
+        overloaded {
+            [&](AssetTaskCopy& task) {
+                string(task.name);
+                string(task.path);
+            },
+            [&](AssetTaskTexture& task) {
+                string(task.name);
+                string(task.path);
+                arc & task.format & task.color_space;
+            },
+            [&](AssetTaskHdrTexture& task) {
+                string(task.name);
+                string(task.path);
+            },
+            [&](AssetTaskGltf& task) {
+                string(task.name);
+                string(task.path);
+                arc & task.weld_epsilons;
+                arc & task.lods;
+                arc & task.compact_vertices;
+                arc & task.short_index_chunks;
+            },
+            [&](AssetTaskProceduralCube& task) {
+                string(task.name);
+                arc & task.extents & task.inverted;
+            },
+            [&](AssetTaskProceduralSphere& task) {
+                string(task.name);
+                arc & task.radius & task.tesselation & task.inverted;
+            },
+            [&](AssetTaskProceduralLowPolyGround& task) {
+                string(task.name);
+                arc & task.vertex_count_x & task.vertex_count_y & task.side_length
+                    & task.height_variation;
+            },
+            [&](AssetTaskProceduralTexturedPlane& task) {
+                string(task.name);
+                arc & task.texture_resolution & task.side_length & task.color_a & task.color_b;
+            },
+            [&](AssetTaskStockcubeOutput& task) {
+                string(task.name);
+                string(task.bin_path);
+                string(task.json_path);
+            },
+            [&](AssetTaskTtf& task) {
+                string(task.name);
+                string(task.path);
+                arc & task.depth;
+            },
+            [&](AssetTaskNull&) {},
+        },
+        asset_task
+    );
+}
+
+//
+// Coordinator.
+//
+
+BakeFarm::BakeFarm(uint worker_count, const BakeWorkerLauncher& launch, double job_timeout)
+    : _job_timeout(job_timeout) {
+    socket_startup();
+    auto port = uint16_t(0);
+    std::tie(_listener, port) = socket_listen_loopback();
+
+    // Launch.
+    for (uint i = 0; i < worker_count; i++) {
+        if (const auto process = launch(port)) {
+            _processes.push_back(process.value());
+        } else {
+            FB_LOG_WARN("Bake farm: failed to launch worker {}", i);
+        }
+    }
+
+    // Connect. Workers say hello with their process id, which tells which
+    // process serves a connection, for the workers that have one.
+    const auto timer = Instant();
+    auto workers = std::vector<std::tuple<uintptr_t, BakeWorkerProcess>>();
+    while (workers.size() < _processes.size()) {
+        const auto timeout = BAKE_FARM_CONNECT_TIMEOUT - timer.elapsed_time();
+        const auto worker = socket_accept(_listener, std::max(timeout, 0.0));
+        if (!worker.has_value()) {
+            FB_LOG_WARN(
+                "Bake farm: {} of {} workers connected",
+                workers.size(),
+                _processes.size()
+            );
+            break;
+        }
+        auto hello = Option<BakeFarmMessage>();
+        if (socket_wait_readable(worker.value(), timeout)) {
+            hello = recv_message(worker.value());
+        }
+        auto process_id = uint(0);
+        if (!hello.has_value() || hello->op != BakeFarmOp::Hello
+            || hello->payload.size() != sizeof(process_id)) {
+            FB_LOG_WARN("Bake farm: a worker connected without saying hello");
+            socket_close(worker.value());
+            continue;
+        }
+        std::memcpy(&process_id, hello->payload.data(), sizeof(process_id));
+        auto process = BakeWorkerProcess {};
+        const auto it = std::ranges::find(_processes, process_id, &BakeWorkerProcess::id);
+        if (it != _processes.end()) {
+            process = *it;
+        }
+        workers.emplace_back(worker.value(), process);
+    }
+    _worker_count = (uint)workers.size();
+    _live_worker_count = _worker_count;
+    for (const auto& [worker, process] : workers) {
+        _worker_threads.emplace_back([this, worker, process]() { serve(worker, process); });
+    }
+    FB_LOG_INFO("Bake farm: {} workers on port {}", _worker_count, port);
+}
+
+BakeFarm::~BakeFarm() {
+    {
+        std::scoped_lock lock(_mutex);
+        _stopping = true;
+    }
+    _job_cv.notify_all();
+    for (auto& thread : _worker_threads) {
+        thread.join();
+    }
+    socket_close(_listener);
+
+    // Processes exit once told to, or once their connection is lost.
+    for (const auto& process : _processes) {
+        if (process.handle == nullptr) {
+            continue;
+        }
+        const auto timeout = (DWORD)(BAKE_FARM_EXIT_TIMEOUT * 1000.0);
+        if (WaitForSingleObject(process.handle, timeout) != WAIT_OBJECT_0) {
+            FB_LOG_WARN("Bake farm: terminating worker process {}", process.id);
+            TerminateProcess(process.handle, 1);
+        }
+        CloseHandle(process.handle);
+    }
+    socket_cleanup();
+}
+
+auto BakeFarm::submit(BakeFarmOp op, std::vector<std::byte> payload)
+    -> std::shared_ptr<BakeFarmJob> {
+    auto job = std::make_shared<BakeFarmJob>();
+    job->op = op;
+    job->payload = std::move(payload);
+    {
+        // Once every worker is gone, jobs are left to their callers.
+        std::scoped_lock lock(_mutex);
+        if (_live_worker_count > 0) {
+            _jobs.push_back(job);
+        } else {
+            job->done = true;
+        }
+    }
+    _job_cv.notify_one();
+    return job;
+}
+
+auto BakeFarm::wait(BakeFarmJob& job) -> Option<std::vector<std::byte>> {
+    {
+        std::unique_lock lock(_mutex);
+        _done_cv.wait(lock, [&]() { return job.done || _live_worker_count == 0; });
+        if (!job.done) {
+            std::erase_if(_jobs, [&](const auto& queued) { return queued.get() == &job; });
+            job.done = true;
+        }
+    }
+    if (!job.result.has_value()) {
+        _local_job_count++;
+    }
+    return std::move(job.result);
+}
+
+auto BakeFarm::serve(uintptr_t worker, BakeWorkerProcess process) -> void {
+    while (true) {
+        // Next job, until stopped.
+        auto job = std::shared_ptr<BakeFarmJob>();
+        {
+            std::unique_lock lock(_mutex);
+            _job_cv.wait(lock, [&]() { return _stopping || !_jobs.empty(); });
+            if (_jobs.empty()) {
+                break;
+            }
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+            job->attempt_count++;
+        }
+
+        // Round trip. The reply is polled for, so that a worker whose process
+        // died, or that stopped replying, doesn't hold its job forever.
+        const auto result_op =
+            job->op == BakeFarmOp::AssetTask ? BakeFarmOp::AssetResult : BakeFarmOp::ShaderResult;
+        auto result = Option<BakeFarmMessage>();
+        auto timed_out = false;
+        if (send_message(worker, job->op, job->payload)) {
+            const auto timer = Instant();
+            while (true) {
+                const auto timeout = _job_timeout - timer.elapsed_time();
+                if (socket_wait_readable(worker, std::min(timeout, BAKE_FARM_POLL_INTERVAL))) {
+                    result = recv_message(worker);
+                    break;
+                }
+                if (process.handle != nullptr
+                    && WaitForSingleObject(process.handle, 0) == WAIT_OBJECT_0) {
+                    break;
+                }
+                if (timeout <= 0.0) {
+                    timed_out = true;
+                    break;
+                }
+            }
+        }
+
+        // Crashed or stuck, reassign the job.
+        if (!result.has_value() || result->op != result_op) {
+            if (timed_out) {
+                FB_LOG_WARN(
+                    "Bake farm: a worker timed out after {:.1f}s, on attempt {} of its job",
+                    _job_timeout,
+                    job->attempt_count
+                );
+                if (process.handle != nullptr) {
+                    TerminateProcess(process.handle, 1);
+                }
+                _timed_out_worker_count++;
+            } else {
+                FB_LOG_WARN(
+                    "Bake farm: a worker crashed, on attempt {} of its job",
+                    job->attempt_count
+                );
+                _crashed_worker_count++;
+            }
+            {
+                std::scoped_lock lock(_mutex);
+                _live_worker_count--;
+                if (job->attempt_count < BAKE_FARM_MAX_ATTEMPT_COUNT) {
+                    _jobs.push_front(std::move(job));
+                    _reassigned_job_count++;
+                } else {
+                    job->done = true;
+                }
+            }
+            _job_cv.notify_all();
+            _done_cv.notify_all();
+            socket_close(worker);
+            return;
+        }
+
+        // Done.
+        {
+            std::scoped_lock lock(_mutex);
+            job->result = std::move(result->payload);
+            job->done = true;
+        }
+        _done_cv.notify_all();
+    }
+
+    send_message(worker, BakeFarmOp::Exit, {});
+    socket_close(worker);
+}
+
+auto BakeFarm::submit_asset_task(std::string_view assets_dir, const AssetTask& asset_task)
+    -> AssetTaskOutput {
+    auto payload = std::vector<std::byte>();
+    auto arc = SerializingArchive(payload);
+    auto dir = std::string(assets_dir);
+    arc & dir;
+    auto task = asset_task;
+    auto strings = std::deque<std::string>();
+    archive(task, arc, strings);
+
+    auto job = submit(BakeFarmOp::AssetTask, std::move(payload));
+    job->assets_dir = std::move(dir);
+    job->asset_task = asset_task;
+    return {.remote = std::move(job)};
+}
+
+auto BakeFarm::asset_task_output(const std::shared_ptr<BakeFarmJob>& job, ThreadPool* pool)
+    -> AssetTaskOutput {
+    std::call_once(job->output_once, [&]() {
+        // Results carry the bin in the message, which is written to a
+        // temporary file like the bin of a local bake.
+        if (const auto result = wait(*job)) {
+            auto result_arc = DeserializingArchive(result.value());
+            auto assets = deserialize_assets(result_arc);
+            auto bin = std::vector<std::byte>();
+            result_arc & bin;
+            FB_ASSERT(result_arc.fully_consumed());
+            const auto bin_path = create_temp_path();
+            write_whole_file(bin_path, bin);
+            job->output = {
+                .assets = std::move(assets),
+                .bin = std::make_shared<const AssetTaskBin>(
+                    bin_path,
+                    0,
+                    bin.size(),
+                    hash128(bin),
+                    true
+                ),
+            };
+        } else {
+            job->output = fb::bake_asset_task(job->assets_dir, job->asset_task, pool);
+        }
+    });
+    return job->output;
+}
+
+auto BakeFarm::compile_shader(
+    std::string_view name,
+    ShaderType type,
+    std::string_view entry_point,
+    Span<const std::byte> source,
+    ShaderDependencies& dependencies
+) -> Option<Shader> {
+    auto payload = std::vector<std::byte>();
+    auto arc = SerializingArchive(payload);
+    auto source_dir = std::string(dependencies.source_dir());
+    auto name_string = std::string(name);
+    auto entry_point_string = std::string(entry_point);
+    auto source_bytes = std::vector<std::byte>(source.begin(), source.end());
+    arc & source_dir & name_string & type & entry_point_string & source_bytes;
+
+    const auto result = wait(*submit(BakeFarmOp::ShaderTask, std::move(payload)));
+    if (!result.has_value()) {
+        return std::nullopt;
+    }
+
+    // Workers send the include closure resolved against the same source
+    // directory, load it again to record it.
+    auto result_arc = DeserializingArchive(result.value());
+    auto shader = Shader();
+    archive(shader, result_arc);
+    auto path_count = uint64_t(0);
+    result_arc & path_count;
+    const auto prefix = std::format("{}/", source_dir);
+    for (uint64_t i = 0; i < path_count; i++) {
+        auto path = std::string();
+        result_arc & path;
+        if (path.starts_with(prefix)) {
+            path.erase(0, prefix.size());
+        }
+        const auto loaded = dependencies.load(path);
+        FB_ASSERT_MSG(loaded.has_value(), "Shader source not found: {}", path);
+    }
+    FB_ASSERT(result_arc.fully_consumed());
+    return shader;
+}
+
+//
+// Worker.
+//
+
+auto serve_bake_farm(
+    uint16_t port,
+    const BakeWorkerCompile& compile,
+    uint job_limit,
+    BakeWorkerFault fault
+) -> bool {
+    socket_startup();
+    const auto coordinator = socket_connect_loopback(port);
+    if (!coordinator.has_value()) {
+        FB_LOG_WARN("Bake worker: failed to connect to port {}", port);
+        socket_cleanup();
+        return false;
+    }
+    const auto process_id = (uint)GetCurrentProcessId();
+    const auto hello = std::as_bytes(Span<const uint>(&process_id, 1));
+    if (!send_message(coordinator.value(), BakeFarmOp::Hello, hello)) {
+        socket_close(coordinator.value());
+        socket_cleanup();
+        return false;
+    }
+
+    auto sources = ShaderSourceCache();
+    auto job_count = 0u;
+    auto exited = false;
+    while (true) {
+        auto message = recv_message(coordinator.value());
+        if (!message.has_value()) {
+            break;
+        }
+        if (message->op == BakeFarmOp::Exit) {
+            exited = true;
+            break;
+        }
+        if (job_count++ == job_limit) {
+            // Hung workers wait until the coordinator drops them.
+            if (fault == BakeWorkerFault::Hang) {
+                while (recv_message(coordinator.value()).has_value()) {}
+            }
+            break;
+        }
+
+        auto arc = DeserializingArchive(message->payload);
+        auto result = std::vector<std::byte>();
+        auto result_arc = SerializingArchive(result);
+        auto result_op = BakeFarmOp::AssetResult;
+        switch (message->op) {
+            case BakeFarmOp::AssetTask: {
+                auto assets_dir = std::string();
+                arc & assets_dir;
+                auto strings = std::deque<std::string>();
+                auto asset_task = AssetTask();
+                archive(asset_task, arc, strings);
+                const auto output = bake_asset_task(assets_dir, asset_task);
+                serialize_assets(result_arc, output.assets);
+                auto bin = output.bin->read();
+                result_arc & bin;
+                break;
+            }
+            case BakeFarmOp::ShaderTask: {
+                auto source_dir = std::string();
+                auto name = std::string();
+                auto type = ShaderType::Unknown;
+                auto entry_point = std::string();
+                auto source = std::vector<std::byte>();
+                arc & source_dir & name & type & entry_point & source;
+                auto dependencies = ShaderDependencies(sources, source_dir);
+                auto shader = compile(name, type, entry_point, source, dependencies);
+                archive(shader, result_arc);
+                auto path_count = (uint64_t)dependencies.paths().size();
+                result_arc & path_count;
+                for (auto path : dependencies.paths()) {
+                    result_arc & path;
+                }
+                result_op = BakeFarmOp::ShaderResult;
+                break;
+            }
+            default: FB_FATAL();
+        }
+        FB_ASSERT(arc.fully_consumed());
+        if (!send_message(coordinator.value(), result_op, result)) {
+            break;
+        }
+    }
+
+    socket_close(coordinator.value());
+    socket_cleanup();
+    return exited;
+}
+
+template<typename T>
+static auto parse_worker_argument(std::string_view argument) -> T {
+    auto value = T(0);
+    const auto [end, error] =
+        std::from_chars(argument.data(), argument.data() + argument.size(), value);
+    FB_ASSERT_MSG(error == std::errc(), "Invalid bake worker argument: {}", argument);
+    return value;
+}
+
+auto launch_bake_worker_process(uint16_t port, uint job_limit) -> Option<BakeWorkerProcess> {
+    auto exe_path = std::array<wchar_t, MAX_PATH> {};
+    FB_ASSERT(GetModuleFileNameW(nullptr, exe_path.data(), (DWORD)exe_path.size()) != 0);
+    auto command_line = std::format(
+        L"\"{}\" {} {} {}",
+        exe_path.data(),
+        to_wstr(BAKE_WORKER_ARG),
+        port,
+        job_limit
+    );
+    auto startup_info = STARTUPINFOW {.cb = sizeof(STARTUPINFOW)};
+    auto process_info = PROCESS_INFORMATION {};
+    if (!CreateProcessW(
+            nullptr,
+            command_line.data(),
+            nullptr,
+            nullptr,
+            FALSE,
+            0,
+            nullptr,
+            nullptr,
+            &startup_info,
+            &process_info
+        )) {
+        FB_LOG_WARN("Bake farm: failed to start a worker process");
+        return std::nullopt;
+    }
+    CloseHandle(process_info.hThread);
+    return BakeWorkerProcess {
+        .handle = process_info.hProcess,
+        .id = (uint)process_info.dwProcessId,
+    };
+}
+
+auto bake_worker_main(int argc, char** argv) -> Option<int> {
+    if (argc < 3 || argv[1] != BAKE_WORKER_ARG) {
+        return std::nullopt;
+    }
+    const auto port = parse_worker_argument<uint16_t>(argv[2]);
+    const auto job_limit = argc > 3 ? parse_worker_argument<uint>(argv[3]) : UINT_MAX;
+    return run_bake_worker(port, []() { return ShaderCompiler(); }, job_limit) ? 0 : 1;
+}
+
+} // namespace fb
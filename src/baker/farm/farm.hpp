@@ -0,0 +1,245 @@
+#pragma once
+
+#include <common/common.hpp>
+#include "../assets/tasks.hpp"
+#include "../shaders/shaders.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace fb {
+
+// Bakes split across worker processes, which stand in for remote nodes. The
+// coordinator hands out one job at a time to every worker over a loopback
+// connection, and jobs and results are archived, framed and hashed like
+// shared cache values. Asset tasks are submitted without waiting, and their
+// outputs resolved later, so `bake_assets` doesn't hold a pool thread per
+// job, and keeps merging results in declaration order. Shader compiles wait
+// for their job, behind the compiler interface. The output is identical to a
+// local bake.
+//
+// When a worker crashes, or doesn't reply within the job timeout, its job goes
+// back to the front of the queue for the others. Workers report their process
+// id when they connect, so that the coordinator can tell a dead process from a
+// slow one, and terminate stuck ones. Jobs that failed on
+// `BAKE_FARM_MAX_ATTEMPT_COUNT` workers, and jobs left when no worker is
+// alive, are done locally by their caller.
+inline constexpr uint BAKE_FARM_MAGIC = 0x46424246; // "FBBF"
+inline constexpr uint BAKE_FARM_VERSION = 2;
+inline constexpr uint BAKE_FARM_MAX_ATTEMPT_COUNT = 2;
+inline constexpr double BAKE_FARM_CONNECT_TIMEOUT = 30.0;
+inline constexpr double BAKE_FARM_JOB_TIMEOUT = 600.0;
+inline constexpr double BAKE_FARM_POLL_INTERVAL = 0.5;
+inline constexpr double BAKE_FARM_EXIT_TIMEOUT = 5.0;
+
+// Command line of worker processes: `<exe> --bake-worker <port> [job_limit]`.
+inline constexpr std::string_view BAKE_WORKER_ARG = "--bake-worker"sv;
+
+enum class BakeFarmOp : uint {
+    AssetTask,
+    ShaderTask,
+    AssetResult,
+    ShaderResult,
+    Exit,
+    Hello,
+};
+
+struct BakeFarmFrame {
+    uint magic;
+    uint version;
+    BakeFarmOp op;
+    uint reserved;
+    uint64_t byte_count;
+    Hash128 hash;
+};
+
+// Process of a launched worker. Workers without one, like threads in tests,
+// have no handle.
+struct BakeWorkerProcess {
+    HANDLE handle = nullptr;
+    uint id = 0;
+};
+
+// Starts one worker connecting to `port`. None if it didn't start.
+using BakeWorkerLauncher = std::function<Option<BakeWorkerProcess>(uint16_t port)>;
+
+// Job queued on a farm. Asset tasks keep what it takes to bake them locally,
+// and their output once resolved.
+struct BakeFarmJob {
+    BakeFarmOp op;
+    std::vector<std::byte> payload;
+    uint attempt_count = 0;
+    bool done = false;
+    Option<std::vector<std::byte>> result;
+    std::string assets_dir;
+    AssetTask asset_task;
+    std::once_flag output_once;
+    AssetTaskOutput output;
+};
+
+class BakeFarm {
+    FB_NO_COPY_MOVE(BakeFarm);
+
+public:
+    // Launches `worker_count` workers, and waits until they connect, for at
+    // most `BAKE_FARM_CONNECT_TIMEOUT` seconds. Workers that take more than
+    // `job_timeout` seconds to reply to a job are dropped.
+    BakeFarm(
+        uint worker_count,
+        const BakeWorkerLauncher& launch,
+        double job_timeout = BAKE_FARM_JOB_TIMEOUT
+    );
+
+    // Tells every worker to exit, and terminates the processes that don't.
+    ~BakeFarm();
+
+    // Queues a task for the workers, without waiting for it. The output only
+    // refers to the job until `asset_task_output` resolves it.
+    auto submit_asset_task(std::string_view assets_dir, const AssetTask& asset_task)
+        -> AssetTaskOutput;
+
+    // Waits for the output of a submitted task, or bakes it locally, with
+    // `pool`, if the workers couldn't. Every call returns the same output.
+    auto asset_task_output(const std::shared_ptr<BakeFarmJob>& job, ThreadPool* pool = nullptr)
+        -> AssetTaskOutput;
+
+    // None if the job has to be done locally. Otherwise, the include closure
+    // of the compile is recorded in `dependencies`, as for a local compile.
+    auto compile_shader(
+        std::string_view name,
+        ShaderType type,
+        std::string_view entry_point,
+        Span<const std::byte> source,
+        ShaderDependencies& dependencies
+    ) -> Option<Shader>;
+
+    auto worker_count() const -> uint { return _worker_count; }
+    auto crashed_worker_count() const -> uint { return _crashed_worker_count.load(); }
+    auto timed_out_worker_count() const -> uint { return _timed_out_worker_count.load(); }
+    auto reassigned_job_count() const -> uint { return _reassigned_job_count.load(); }
+    auto local_job_count() const -> uint { return _local_job_count.load(); }
+
+private:
+    auto submit(BakeFarmOp op, std::vector<std::byte> payload) -> std::shared_ptr<BakeFarmJob>;
+    auto wait(BakeFarmJob& job) -> Option<std::vector<std::byte>>;
+    auto serve(uintptr_t worker, BakeWorkerProcess process) -> void;
+
+    uintptr_t _listener;
+    uint _worker_count = 0;
+    double _job_timeout = 0.0;
+    std::vector<BakeWorkerProcess> _processes;
+    std::mutex _mutex;
+    std::condition_variable _job_cv;
+    std::condition_variable _done_cv;
+    std::deque<std::shared_ptr<BakeFarmJob>> _jobs;
+    uint _live_worker_count = 0;
+    bool _stopping = false;
+    std::atomic<uint> _crashed_worker_count = 0;
+    std::atomic<uint> _timed_out_worker_count = 0;
+    std::atomic<uint> _reassigned_job_count = 0;
+    std::atomic<uint> _local_job_count = 0;
+    std::vector<std::thread> _worker_threads;
+};
+
+// Compiles on the workers of a farm. Arguments, which are part of cache keys,
+// come from `Compiler`, which must be what workers compile with. It also
+// compiles the jobs left to the coordinator.
+template<ShaderCompilerBackend Compiler>
+class BakeFarmShaderCompiler {
+public:
+    BakeFarmShaderCompiler(BakeFarm& farm, Compiler compiler)
+        : _farm(&farm)
+        , _compiler(std::move(compiler)) {}
+
+    auto arguments(std::string_view name, ShaderType type, std::string_view entry_point) const
+        -> std::vector<std::wstring> {
+        return _compiler.arguments(name, type, entry_point);
+    }
+
+    auto compile(
+        std::string_view name,
+        ShaderType type,
+        std::string_view entry_point,
+        Span<const std::byte> source,
+        ShaderDependencies& dependencies,
+        bool debug
+    ) const -> Shader {
+        if (auto shader = _farm->compile_shader(name, type, entry_point, source, dependencies)) {
+            return std::move(shader.value());
+        }
+        return _compiler.compile(name, type, entry_point, source, dependencies, debug);
+    }
+
+private:
+    BakeFarm* _farm;
+    Compiler _compiler;
+};
+
+// Compiles one shader job of a worker. Includes resolve through `dependencies`.
+using BakeWorkerCompile = std::function<Shader(
+    std::string_view name,
+    ShaderType type,
+    std::string_view entry_point,
+    Span<const std::byte> source,
+    ShaderDependencies& dependencies
+)>;
+
+// How a worker fails past its job limit: it drops the connection without
+// replying, like a crash, or stops replying until the coordinator drops it,
+// like a hang.
+enum class BakeWorkerFault {
+    Crash,
+    Hang,
+};
+
+// Connects to the coordinator at `port`, and does its jobs until it is told
+// to exit, which returns true, or the connection is lost. Past `job_limit`
+// jobs, the worker fails with `fault`.
+auto serve_bake_farm(
+    uint16_t port,
+    const BakeWorkerCompile& compile,
+    uint job_limit,
+    BakeWorkerFault fault = BakeWorkerFault::Crash
+) -> bool;
+
+// Worker with compilers made by `make_compiler`, once it gets a shader job.
+template<typename MakeCompiler>
+    requires ShaderCompilerBackend<std::invoke_result_t<MakeCompiler>>
+auto run_bake_worker(
+    uint16_t port,
+    MakeCompiler make_compiler,
+    uint job_limit = UINT_MAX,
+    BakeWorkerFault fault = BakeWorkerFault::Crash
+) -> bool {
+    using Compiler = std::invoke_result_t<MakeCompiler>;
+    auto compiler = Option<Compiler>();
+    return serve_bake_farm(
+        port,
+        [&](std::string_view name,
+            ShaderType type,
+            std::string_view entry_point,
+            Span<const std::byte> source,
+            ShaderDependencies& dependencies) {
+            if (!compiler.has_value()) {
+                compiler.emplace(make_compiler());
+            }
+            return compiler->compile(name, type, entry_point, source, dependencies, false);
+        },
+        job_limit,
+        fault
+    );
+}
+
+// Starts a worker process running the current executable, which must call
+// `bake_worker_main` before anything else.
+auto launch_bake_worker_process(uint16_t port, uint job_limit = UINT_MAX)
+    -> Option<BakeWorkerProcess>;
+
+// If the command line is a worker's, runs the worker with DXC, and returns
+// the exit code of the process.
+auto bake_worker_main(int argc, char** argv) -> Option<int>;
+
+} // namespace fb
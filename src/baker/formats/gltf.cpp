@@ -1,10 +1,13 @@
 #include "gltf.hpp"
+#include "../utils/profiler.hpp"
 
 #include <cgltf.h>
 
 namespace fb {
 
 GltfModel::GltfModel(std::string_view gltf_path) {
+    FB_BAKE_ZONE("gltf_load");
+
     // Load GLTF.
     cgltf_options options = {};
     cgltf_data* data = nullptr;
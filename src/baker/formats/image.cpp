@@ -1,4 +1,5 @@
 #include "image.hpp"
+#include "../utils/profiler.hpp"
 
 #include <stb_image.h>
 #include <tinyexr.h>
@@ -9,6 +10,8 @@ static constexpr uint CHANNEL_COUNT = 4;
 
 template<>
 auto Image<std::byte>::from_image(Span<const std::byte> src_image) -> Image<std::byte> {
+    FB_BAKE_ZONE("image_decode");
+
     // Load.
     uint width = 0;
     uint height = 0;
@@ -42,6 +45,8 @@ auto Image<std::byte>::from_image(Span<const std::byte> src_image) -> Image<std:
 
 template<>
 auto Image<float>::from_image(Span<const std::byte> src_image) -> Image<float> {
+    FB_BAKE_ZONE("image_decode");
+
     // Load.
     uint width = 0;
     uint height = 0;
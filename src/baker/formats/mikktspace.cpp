@@ -1,12 +1,24 @@
 #include "mikktspace.hpp"
+#include "../assets/mesh_weld.hpp"
+#include "../utils/profiler.hpp"
 
 #include <mikktspace.h>
 
 namespace fb {
 
+// Faces of a batch, and the attributes of their corners, three per face in
+// face order, gathered so that callbacks read them without indirection.
+struct TangentBatch {
+    Span<const uint> faces;
+    std::vector<float3> positions;
+    std::vector<float3> normals;
+    std::vector<float2> texcoords;
+    Span<float4> tangents;
+};
+
 static auto get_num_faces(const SMikkTSpaceContext* ctx) -> int {
-    const auto& desc = *(const GenerateTangentsDesc*)ctx->m_pUserData;
-    return (int)desc.indices.size() / 3;
+    const auto& batch = *(const TangentBatch*)ctx->m_pUserData;
+    return (int)batch.faces.size();
 }
 
 static auto get_num_vertices_of_face(const SMikkTSpaceContext*, int) -> int {
@@ -15,9 +27,8 @@ static auto get_num_vertices_of_face(const SMikkTSpaceContext*, int) -> int {
 
 static auto get_position(const SMikkTSpaceContext* ctx, float* dst, int face_id, int vertex_id)
     -> void {
-    const auto& desc = *(const GenerateTangentsDesc*)ctx->m_pUserData;
-    const auto index = desc.indices[face_id * 3 + vertex_id];
-    const auto& position = desc.positions[index];
+    const auto& batch = *(const TangentBatch*)ctx->m_pUserData;
+    const auto& position = batch.positions[face_id * 3 + vertex_id];
     dst[0] = position.x;
     dst[1] = position.y;
     dst[2] = position.z;
@@ -25,9 +36,8 @@ static auto get_position(const SMikkTSpaceContext* ctx, float* dst, int face_id,
 
 static auto get_normal(const SMikkTSpaceContext* ctx, float* dst, int face_id, int vertex_id)
     -> void {
-    const auto& desc = *(const GenerateTangentsDesc*)ctx->m_pUserData;
-    const auto index = desc.indices[face_id * 3 + vertex_id];
-    const auto& normal = desc.normals[index];
+    const auto& batch = *(const TangentBatch*)ctx->m_pUserData;
+    const auto& normal = batch.normals[face_id * 3 + vertex_id];
     dst[0] = normal.x;
     dst[1] = normal.y;
     dst[2] = normal.z;
@@ -35,9 +45,8 @@ static auto get_normal(const SMikkTSpaceContext* ctx, float* dst, int face_id, i
 
 static auto get_texcoord(const SMikkTSpaceContext* ctx, float* dst, int face_id, int vertex_id)
     -> void {
-    const auto& desc = *(const GenerateTangentsDesc*)ctx->m_pUserData;
-    const auto index = desc.indices[face_id * 3 + vertex_id];
-    const auto& texcoord = desc.texcoords[index];
+    const auto& batch = *(const TangentBatch*)ctx->m_pUserData;
+    const auto& texcoord = batch.texcoords[face_id * 3 + vertex_id];
     dst[0] = texcoord.x;
     dst[1] = texcoord.y;
 }
@@ -49,25 +58,132 @@ static auto set_tspace_basic(
     int face_id,
     int vertex_id
 ) -> void {
-    auto& desc = *(GenerateTangentsDesc*)ctx->m_pUserData;
-    const auto index = desc.indices[face_id * 3 + vertex_id];
-    desc.tangents[index] = float4(tangent[0], tangent[1], tangent[2], sign);
+    auto& batch = *(TangentBatch*)ctx->m_pUserData;
+    const auto face = batch.faces[face_id];
+    batch.tangents[face * 3 + vertex_id] = float4(tangent[0], tangent[1], tangent[2], sign);
 }
 
-auto generate_tangents(const GenerateTangentsDesc& desc) -> void {
-    SMikkTSpaceInterface callbacks = {
-        .m_getNumFaces = get_num_faces,
-        .m_getNumVerticesOfFace = get_num_vertices_of_face,
-        .m_getPosition = get_position,
-        .m_getNormal = get_normal,
-        .m_getTexCoord = get_texcoord,
-        .m_setTSpaceBasic = set_tspace_basic,
+// Faces of every batch, in order. Batches are unions of connected components,
+// taken in order of their first face.
+static auto tangent_batches(const GenerateTangentsDesc& desc) -> std::vector<std::vector<uint>> {
+    // Vertices as mikktspace welds them. It compares floats, so -0 and +0 are
+    // keyed alike, and NaNs, which it never welds, are too, which only merges
+    // components.
+    struct VertexKey {
+        float3 position;
+        float3 normal;
+        float2 texcoord;
+    };
+    static_assert(sizeof(VertexKey) == 8 * sizeof(float), "Keys must not have padding");
+    const auto canonical = [](float value) {
+        return std::isnan(value) ? std::numeric_limits<float>::quiet_NaN() : value + 0.0f;
     };
-    SMikkTSpaceContext context = {
-        .m_pInterface = &callbacks,
-        .m_pUserData = (void*)&desc,
+    auto keys = std::vector<VertexKey>(desc.positions.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        for (uint axis = 0; axis < 3; axis++) {
+            keys[i].position[axis] = canonical(desc.positions[i][axis]);
+            keys[i].normal[axis] = canonical(desc.normals[i][axis]);
+        }
+        for (uint axis = 0; axis < 2; axis++) {
+            keys[i].texcoord[axis] = canonical(desc.texcoords[i][axis]);
+        }
+    }
+    const auto vertex_ids =
+        weld_keys(std::as_bytes(Span<const VertexKey>(keys)), sizeof(VertexKey));
+
+    // Connected components, by union-find over welded vertices.
+    auto parents = std::vector<uint>(keys.size());
+    for (uint i = 0; i < parents.size(); i++) {
+        parents[i] = i;
+    }
+    const auto find = [&](uint id) {
+        while (parents[id] != id) {
+            parents[id] = parents[parents[id]];
+            id = parents[id];
+        }
+        return id;
+    };
+    const auto face_count = (uint)desc.indices.size() / 3;
+    for (uint face = 0; face < face_count; face++) {
+        auto a = find(vertex_ids[desc.indices[face * 3 + 0]]);
+        for (uint corner = 1; corner < 3; corner++) {
+            const auto b = find(vertex_ids[desc.indices[face * 3 + corner]]);
+            parents[std::max(a, b)] = std::min(a, b);
+            a = std::min(a, b);
+        }
+    }
+    auto component_face_counts = std::vector<uint>(keys.size(), 0);
+    auto face_components = std::vector<uint>(face_count);
+    for (uint face = 0; face < face_count; face++) {
+        face_components[face] = find(vertex_ids[desc.indices[face * 3]]);
+        component_face_counts[face_components[face]]++;
+    }
+
+    // Batches.
+    static constexpr uint NO_BATCH = ~0u;
+    auto component_batches = std::vector<uint>(keys.size(), NO_BATCH);
+    auto batches = std::vector<std::vector<uint>>();
+    auto open_batch_face_count = 0u;
+    for (uint face = 0; face < face_count; face++) {
+        const auto component = face_components[face];
+        if (component_batches[component] == NO_BATCH) {
+            if (batches.empty() || open_batch_face_count >= desc.batch_face_count) {
+                batches.emplace_back();
+                open_batch_face_count = 0;
+            }
+            component_batches[component] = (uint)batches.size() - 1;
+            open_batch_face_count += component_face_counts[component];
+        }
+        batches[component_batches[component]].push_back(face);
+    }
+    return batches;
+}
+
+auto generate_tangents(const GenerateTangentsDesc& desc) -> void {
+    FB_BAKE_ZONE("tangents");
+    FB_ASSERT(desc.indices.size() % 3 == 0);
+    FB_ASSERT(desc.tangents.size() == desc.indices.size());
+
+    const auto batches = tangent_batches(desc);
+    const auto generate_batch = [&](size_t batch_index) {
+        const auto& faces = batches[batch_index];
+        auto batch = TangentBatch {
+            .faces = faces,
+            .positions = std::vector<float3>(faces.size() * 3),
+            .normals = std::vector<float3>(faces.size() * 3),
+            .texcoords = std::vector<float2>(faces.size() * 3),
+            .tangents = desc.tangents,
+        };
+        for (size_t i = 0; i < faces.size(); i++) {
+            for (uint corner = 0; corner < 3; corner++) {
+                const auto index = desc.indices[faces[i] * 3 + corner];
+                batch.positions[i * 3 + corner] = desc.positions[index];
+                batch.normals[i * 3 + corner] = desc.normals[index];
+                batch.texcoords[i * 3 + corner] = desc.texcoords[index];
+            }
+        }
+
+        SMikkTSpaceInterface callbacks = {
+            .m_getNumFaces = get_num_faces,
+            .m_getNumVerticesOfFace = get_num_vertices_of_face,
+            .m_getPosition = get_position,
+            .m_getNormal = get_normal,
+            .m_getTexCoord = get_texcoord,
+            .m_setTSpaceBasic = set_tspace_basic,
+        };
+        SMikkTSpaceContext context = {
+            .m_pInterface = &callbacks,
+            .m_pUserData = (void*)&batch,
+        };
+        genTangSpaceDefault(&context);
     };
-    genTangSpaceDefault(&context);
+    if (desc.pool != nullptr && batches.size() > 1) {
+        desc.pool->parallel_for(batches.size(), generate_batch);
+    } else {
+        for (size_t i = 0; i < batches.size(); i++) {
+            generate_batch(i);
+        }
+    }
 }
 
 } // namespace fb
@@ -1,15 +1,29 @@
 #pragma once
 
 #include "gltf.hpp"
+#include "../utils/thread_pool.hpp"
 
 namespace fb {
 
+// Faces are generated in batches of at least this many faces.
+inline constexpr uint TANGENT_BATCH_FACE_COUNT = 16384;
+
+// Tangents are per corner, one per index, as vertices sharing an index may
+// still need different tangents, like across mirrored texcoords.
+//
+// Mikktspace only looks across faces that share a vertex, which it welds by
+// position, normal and texcoord. Faces are therefore split into connected
+// components of welded vertices, batched, and generated on `pool` when there
+// is one. Within a batch, faces keep their order, so that tangents are the
+// same bits as those of a single batch.
 struct GenerateTangentsDesc {
     Span<const GltfVertexPosition> positions;
     Span<const GltfVertexNormal> normals;
     Span<const GltfVertexTexcoord> texcoords;
     Span<const GltfIndex> indices;
     Span<float4> tangents;
+    ThreadPool* pool = nullptr;
+    uint batch_face_count = TANGENT_BATCH_FACE_COUNT;
 };
 
 auto generate_tangents(const GenerateTangentsDesc& desc) -> void;
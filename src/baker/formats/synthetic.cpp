@@ -0,0 +1,362 @@
+#include "synthetic.hpp"
+
+#include <nlohmann/json.hpp>
+#include <stb_image_write.h>
+#include <tinyexr.h>
+
+namespace fb {
+
+using json = nlohmann::json;
+
+inline constexpr uint GLB_MAGIC = 0x46546c67; // "glTF"
+inline constexpr uint GLB_VERSION = 2;
+inline constexpr uint GLB_CHUNK_JSON = 0x4e4f534a; // "JSON"
+inline constexpr uint GLB_CHUNK_BIN = 0x004e4942; // "BIN\0"
+inline constexpr uint GLTF_FLOAT = 5126;
+inline constexpr uint GLTF_UNSIGNED_SHORT = 5123;
+inline constexpr uint GLTF_UNSIGNED_INT = 5125;
+
+//
+// glTF.
+//
+
+// Binary chunk of a glTF, with one buffer view per span of data.
+class GlbBuffer {
+public:
+    template<typename T>
+    auto view(Span<const T> values) -> uint {
+        const auto offset = _bytes.size();
+        const auto bytes = std::as_bytes(values);
+        _bytes.insert(_bytes.end(), bytes.begin(), bytes.end());
+        _bytes.resize((_bytes.size() + 3) & ~size_t(3));
+        _views.push_back({
+            {"buffer", 0},
+            {"byteOffset", offset},
+            {"byteLength", bytes.size()},
+        });
+        return (uint)_views.size() - 1;
+    }
+
+    template<typename T>
+    auto accessor(Span<const T> values, uint component_type, std::string_view type) -> uint {
+        _accessors.push_back({
+            {"bufferView", view(values)},
+            {"componentType", component_type},
+            {"count", values.size()},
+            {"type", type},
+        });
+        return (uint)_accessors.size() - 1;
+    }
+
+    auto last_accessor() -> json& { return _accessors.back(); }
+    auto bytes() const -> Span<const std::byte> { return _bytes; }
+    auto views() const -> const json& { return _views; }
+    auto accessors() const -> const json& { return _accessors; }
+
+private:
+    std::vector<std::byte> _bytes;
+    json _views = json::array();
+    json _accessors = json::array();
+};
+
+static auto write_u32(std::vector<std::byte>& bytes, uint value) -> void {
+    const auto value_bytes = std::as_bytes(Span<const uint>(&value, 1));
+    bytes.insert(bytes.end(), value_bytes.begin(), value_bytes.end());
+}
+
+// Binary glTF of `gltf`, with the views and accessors of `buffer`.
+static auto glb_file(json gltf, const GlbBuffer& buffer) -> std::vector<std::byte> {
+    const auto bin = buffer.bytes();
+    gltf["buffers"] = {{{"byteLength", bin.size()}}};
+    gltf["bufferViews"] = buffer.views();
+    gltf["accessors"] = buffer.accessors();
+    auto json_text = gltf.dump();
+    json_text.resize((json_text.size() + 3) & ~size_t(3), ' ');
+    const auto json_bytes = std::as_bytes(Span<const char>(json_text));
+    const auto bin_byte_count = (bin.size() + 3) & ~size_t(3);
+    const auto byte_count = 12 + 8 + json_bytes.size() + 8 + bin_byte_count;
+    FB_ASSERT(byte_count <= UINT_MAX);
+
+    auto bytes = std::vector<std::byte>();
+    bytes.reserve(byte_count);
+    write_u32(bytes, GLB_MAGIC);
+    write_u32(bytes, GLB_VERSION);
+    write_u32(bytes, (uint)byte_count);
+    write_u32(bytes, (uint)json_bytes.size());
+    write_u32(bytes, GLB_CHUNK_JSON);
+    bytes.insert(bytes.end(), json_bytes.begin(), json_bytes.end());
+    write_u32(bytes, (uint)bin_byte_count);
+    write_u32(bytes, GLB_CHUNK_BIN);
+    bytes.insert(bytes.end(), bin.begin(), bin.end());
+    bytes.resize(byte_count);
+    return bytes;
+}
+
+auto synthetic_gltf(const SyntheticGltfDesc& desc) -> std::vector<std::byte> {
+    FB_ASSERT(desc.grid_size > 0);
+    FB_ASSERT(desc.joint_count <= UINT16_MAX);
+    FB_ASSERT(desc.joint_count == 0 || desc.keyframe_count >= 2);
+    FB_ASSERT(desc.joint_count == 0 || desc.duration > 0.0f);
+
+    auto buffer = GlbBuffer();
+    auto gltf = json {
+        {"asset", {{"version", "2.0"}}},
+        {"scene", 0},
+    };
+
+    // Grid, displaced by waves.
+    const auto grid_size = desc.grid_size;
+    const auto side = grid_size + 1;
+    const auto wave = [](float x, float z) {
+        return 0.1f * std::sin(6.0f * x) * std::cos(6.0f * z);
+    };
+    auto positions = std::vector<float3>(desc.vertex_count());
+    auto normals = std::vector<float3>(desc.vertex_count());
+    auto texcoords = std::vector<float2>(desc.vertex_count());
+    for (uint z = 0; z < side; z++) {
+        for (uint x = 0; x < side; x++) {
+            const auto u = (float)x / (float)grid_size;
+            const auto v = (float)z / (float)grid_size;
+            const auto px = 2.0f * u - 1.0f;
+            const auto pz = 2.0f * v - 1.0f;
+            const auto dx = 0.6f * std::cos(6.0f * px) * std::cos(6.0f * pz);
+            const auto dz = -0.6f * std::sin(6.0f * px) * std::sin(6.0f * pz);
+            const auto i = (size_t)z * side + x;
+            positions[i] = float3(px, wave(px, pz), pz);
+            normals[i] = float3_normalize(float3(-dx, 1.0f, -dz));
+            texcoords[i] = float2(u, v);
+        }
+    }
+    auto indices = std::vector<uint>();
+    indices.reserve(desc.triangle_count() * 3);
+    for (uint z = 0; z < grid_size; z++) {
+        for (uint x = 0; x < grid_size; x++) {
+            const auto i = z * side + x;
+            indices.insert(indices.end(), {i, i + side, i + 1, i + 1, i + side, i + side + 1});
+        }
+    }
+    auto attributes = json::object();
+    attributes["POSITION"] = buffer.accessor(Span<const float3>(positions), GLTF_FLOAT, "VEC3");
+    buffer.last_accessor()["min"] = {-1.0f, -0.1f, -1.0f};
+    buffer.last_accessor()["max"] = {1.0f, 0.1f, 1.0f};
+    attributes["NORMAL"] = buffer.accessor(Span<const float3>(normals), GLTF_FLOAT, "VEC3");
+    attributes["TEXCOORD_0"] =
+        buffer.accessor(Span<const float2>(texcoords), GLTF_FLOAT, "VEC2");
+    const auto indices_accessor =
+        buffer.accessor(Span<const uint>(indices), GLTF_UNSIGNED_INT, "SCALAR");
+
+    // Material.
+    auto pbr = json {{"metallicFactor", 0.0f}, {"roughnessFactor", 1.0f}};
+    if (desc.texture_size > 0) {
+        const auto png = synthetic_ldr_image(desc.texture_size, desc.texture_size);
+        gltf["images"] = {{
+            {"bufferView", buffer.view(Span<const std::byte>(png))},
+            {"mimeType", "image/png"},
+        }};
+        gltf["samplers"] = {json::object()};
+        gltf["textures"] = {{{"source", 0}, {"sampler", 0}}};
+        pbr["baseColorTexture"] = {{"index", 0}};
+    } else {
+        pbr["baseColorFactor"] = {0.8f, 0.8f, 0.8f, 1.0f};
+    }
+    gltf["materials"] = {{{"pbrMetallicRoughness", pbr}}};
+
+    if (desc.joint_count == 0) {
+        gltf["meshes"] = {{
+            {"primitives",
+             {{
+                 {"attributes", attributes},
+                 {"indices", indices_accessor},
+                 {"material", 0},
+             }}},
+        }};
+        gltf["nodes"] = {{{"mesh", 0}}};
+        gltf["scenes"] = {{{"nodes", {0}}}};
+        return glb_file(std::move(gltf), buffer);
+    }
+
+    // Joints, in a binary tree, with joint `i` the parent of `2i + 1` and
+    // `2i + 2`. Node 0 holds the mesh node 1 and the root joint, node 2.
+    const auto joint_count = desc.joint_count;
+    const auto joint_offset = float3(0.0f, 0.05f, 0.0f);
+    auto joint_positions = std::vector<float3>(joint_count);
+    for (uint i = 1; i < joint_count; i++) {
+        joint_positions[i] = joint_positions[(i - 1) / 2] + joint_offset;
+    }
+    using Matrix = std::array<float, 16>;
+    auto inverse_binds = std::vector<Matrix>();
+    for (const auto& position : joint_positions) {
+        // Column-major translation.
+        auto& matrix = inverse_binds.emplace_back(Matrix {});
+        matrix[0] = matrix[5] = matrix[10] = matrix[15] = 1.0f;
+        matrix[12] = -position.x;
+        matrix[13] = -position.y;
+        matrix[14] = -position.z;
+    }
+
+    // Every vertex is weighted to four consecutive joints, along x.
+    using Joints = std::array<uint16_t, 4>;
+    auto vertex_joints = std::vector<Joints>();
+    auto vertex_weights = std::vector<float4>();
+    vertex_joints.reserve(desc.vertex_count());
+    vertex_weights.reserve(desc.vertex_count());
+    for (uint z = 0; z < side; z++) {
+        for (uint x = 0; x < side; x++) {
+            const auto joint = (uint)((uint64_t)x * joint_count / side);
+            auto& joints = vertex_joints.emplace_back();
+            for (uint k = 0; k < 4; k++) {
+                joints[k] = (uint16_t)((joint + k) % joint_count);
+            }
+            vertex_weights.push_back(float4(0.4f, 0.3f, 0.2f, 0.1f));
+        }
+    }
+    attributes["JOINTS_0"] =
+        buffer.accessor(Span<const Joints>(vertex_joints), GLTF_UNSIGNED_SHORT, "VEC4");
+    attributes["WEIGHTS_0"] =
+        buffer.accessor(Span<const float4>(vertex_weights), GLTF_FLOAT, "VEC4");
+    const auto inverse_binds_accessor =
+        buffer.accessor(Span<const Matrix>(inverse_binds), GLTF_FLOAT, "MAT4");
+
+    // Keyframes, shared by every channel.
+    auto times = std::vector<float>(desc.keyframe_count);
+    for (uint i = 0; i < desc.keyframe_count; i++) {
+        times[i] = desc.duration * (float)i / (float)(desc.keyframe_count - 1);
+    }
+    const auto times_accessor = buffer.accessor(Span<const float>(times), GLTF_FLOAT, "SCALAR");
+    buffer.last_accessor()["min"] = {times.front()};
+    buffer.last_accessor()["max"] = {times.back()};
+
+    auto nodes = json::array();
+    nodes.push_back({{"children", {1, 2}}});
+    nodes.push_back({{"mesh", 0}, {"skin", 0}});
+    auto joints = json::array();
+    auto samplers = json::array();
+    auto channels = json::array();
+    for (uint i = 0; i < joint_count; i++) {
+        auto node = json {{"translation", {0.0f, i == 0 ? 0.0f : joint_offset.y, 0.0f}}};
+        auto children = json::array();
+        for (const auto child : {2 * i + 1, 2 * i + 2}) {
+            if (child < joint_count) {
+                children.push_back(2 + child);
+            }
+        }
+        if (!children.empty()) {
+            node["children"] = children;
+        }
+        nodes.push_back(node);
+        joints.push_back(2 + i);
+
+        auto translations = std::vector<float3>();
+        auto rotations = std::vector<float4>();
+        auto scales = std::vector<float3>();
+        for (uint k = 0; k < desc.keyframe_count; k++) {
+            const auto phase = times[k] * 2.0f + (float)i * 0.1f;
+            const auto angle = 0.2f * std::sin(phase);
+            const auto y = i == 0 ? 0.0f : joint_offset.y;
+            translations.push_back(float3(0.01f * std::sin(phase), y, 0.0f));
+            const auto half_angle = angle / 2.0f;
+            rotations.push_back(float4(0.0f, 0.0f, std::sin(half_angle), std::cos(half_angle)));
+            scales.push_back(float3(1.0f + 0.05f * std::sin(phase)));
+        }
+        const auto channel = [&](uint accessor, std::string_view path) {
+            samplers.push_back({
+                {"input", times_accessor},
+                {"output", accessor},
+                {"interpolation", "LINEAR"},
+            });
+            channels.push_back({
+                {"sampler", samplers.size() - 1},
+                {"target", {{"node", 2 + i}, {"path", path}}},
+            });
+        };
+        const auto vec3 = [&](const std::vector<float3>& values) {
+            return buffer.accessor(Span<const float3>(values), GLTF_FLOAT, "VEC3");
+        };
+        channel(vec3(translations), "translation");
+        channel(buffer.accessor(Span<const float4>(rotations), GLTF_FLOAT, "VEC4"), "rotation");
+        channel(vec3(scales), "scale");
+    }
+
+    gltf["meshes"] = {{
+        {"primitives",
+         {{
+             {"attributes", attributes},
+             {"indices", indices_accessor},
+             {"material", 0},
+         }}},
+    }};
+    gltf["nodes"] = nodes;
+    gltf["scenes"] = {{{"nodes", {0}}}};
+    gltf["skins"] = {{
+        {"inverseBindMatrices", inverse_binds_accessor},
+        {"joints", joints},
+        {"skeleton", 2},
+    }};
+    gltf["animations"] = {{{"samplers", samplers}, {"channels", channels}}};
+    return glb_file(std::move(gltf), buffer);
+}
+
+//
+// Images.
+//
+
+auto synthetic_ldr_image(uint width, uint height) -> std::vector<std::byte> {
+    // Gradients, with a pattern that doesn't compress away.
+    auto pixels = std::vector<uint8_t>((size_t)width * height * 4);
+    for (uint y = 0; y < height; y++) {
+        for (uint x = 0; x < width; x++) {
+            auto* pixel = &pixels[((size_t)y * width + x) * 4];
+            pixel[0] = (uint8_t)((uint64_t)x * 255 / std::max(width - 1, 1u));
+            pixel[1] = (uint8_t)((uint64_t)y * 255 / std::max(height - 1, 1u));
+            pixel[2] = (uint8_t)((x ^ y) & 0xff);
+            pixel[3] = 255;
+        }
+    }
+
+    auto png = std::vector<std::byte>();
+    const auto write = [](void* context, void* data, int size) {
+        auto& bytes = *(std::vector<std::byte>*)context;
+        const auto* begin = (const std::byte*)data;
+        bytes.insert(bytes.end(), begin, begin + size);
+    };
+    const auto result = stbi_write_png_to_func(
+        write,
+        &png,
+        (int)width,
+        (int)height,
+        4,
+        pixels.data(),
+        (int)width * 4
+    );
+    FB_ASSERT_MSG(result != 0, "Failed to encode synthetic PNG");
+    return png;
+}
+
+auto synthetic_hdr_image(uint width, uint height) -> std::vector<std::byte> {
+    // A bright band over a dim sky, to span some range.
+    auto pixels = std::vector<float>((size_t)width * height * 4);
+    for (uint y = 0; y < height; y++) {
+        for (uint x = 0; x < width; x++) {
+            auto* pixel = &pixels[((size_t)y * width + x) * 4];
+            const auto u = (float)x / (float)width;
+            const auto v = (float)y / (float)height;
+            const auto band = std::exp(-64.0f * (v - 0.3f) * (v - 0.3f));
+            pixel[0] = 0.2f + 16.0f * band * (0.5f + 0.5f * std::sin(12.0f * u));
+            pixel[1] = 0.3f + 12.0f * band;
+            pixel[2] = 0.6f + 4.0f * band * v;
+            pixel[3] = 1.0f;
+        }
+    }
+
+    unsigned char* buffer = nullptr;
+    const char* error_msg = nullptr;
+    const auto byte_count =
+        SaveEXRToMemory(pixels.data(), (int)width, (int)height, 4, 1, &buffer, &error_msg);
+    FB_ASSERT_MSG(byte_count > 0, "Failed to encode synthetic EXR: {}", error_msg);
+    const auto* begin = (const std::byte*)buffer;
+    auto exr = std::vector<std::byte>(begin, begin + byte_count);
+    std::free(buffer);
+    return exr;
+}
+
+} // namespace fb
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <common/common.hpp>
+
+namespace fb {
+
+// Synthetic inputs, for tests and benchmarks at scales the demo assets don't
+// reach. They are valid files of the formats the asset tasks read, with
+// deterministic content, so they go through the same load and bake paths.
+
+// Binary glTF with one mesh, a displaced grid of `grid_size` by `grid_size`
+// quads with normals and texcoords. With a texture size, its material samples
+// a PNG base color texture of that size. With joints, the mesh is skinned to a
+// binary tree of `joint_count` joints, which translate, rotate and scale over
+// `keyframe_count` keyframes.
+struct SyntheticGltfDesc {
+    uint grid_size = 16;
+    uint texture_size = 0;
+    uint joint_count = 0;
+    uint keyframe_count = 2;
+    float duration = 1.0f;
+
+    auto vertex_count() const -> size_t { return (size_t)(grid_size + 1) * (grid_size + 1); }
+    auto triangle_count() const -> size_t { return (size_t)2 * grid_size * grid_size; }
+};
+
+auto synthetic_gltf(const SyntheticGltfDesc& desc) -> std::vector<std::byte>;
+
+// PNG, RGBA8.
+auto synthetic_ldr_image(uint width, uint height) -> std::vector<std::byte>;
+
+// OpenEXR, RGBA16F.
+auto synthetic_hdr_image(uint width, uint height) -> std::vector<std::byte>;
+
+} // namespace fb
@@ -0,0 +1,461 @@
+#include "bins.hpp"
+
+#include <filesystem>
+
+namespace fb {
+
+// Writes the fields of one asset record. Spans are rebased onto the data
+// offset. Alongside the record, `content` gets the same fields with spans
+// reduced to their counts and hashes, which is what the entry hash covers.
+struct AssetRecordWriter {
+    uint64_t data_offset;
+    std::vector<std::byte> record;
+    std::vector<std::byte> content;
+
+    template<Archivable T>
+    auto operator&(T value) -> AssetRecordWriter& {
+        auto record_arc = SerializingArchive(record);
+        auto content_arc = SerializingArchive(content);
+        record_arc & value;
+        content_arc & value;
+        return *this;
+    }
+
+    auto operator&(const AssetSpan& span) -> AssetRecordWriter& {
+        auto span_record = BakedSpanRecord {
+            .offset = data_offset + span.offset,
+            .element_count = span.element_count,
+            .byte_count = span.byte_count,
+            .alignment = span.alignment,
+            .hash = span.hash,
+        };
+        auto record_arc = SerializingArchive(record);
+        record_arc & span_record;
+        span_record.offset = 0;
+        auto content_arc = SerializingArchive(content);
+        content_arc & span_record;
+        return *this;
+    }
+
+    auto operator&(const AssetTextureData& data) -> AssetRecordWriter& {
+        return *this & data.row_pitch & data.slice_pitch & data.data;
+    }
+};
+
+// Field order must match the readers in `baked_types.hpp`.
+static auto write_asset_record(AssetRecordWriter& w, const Asset& asset) -> void {
+    std::visit(
+        overloaded {
+            [&](const AssetCopy& a) { w & a.data; },
+            [&](const AssetMesh& a) {
+                w & a.transform & a.vertices;
+                w & a.index_format & a.indices & a.short_indices & a.submeshes;
+                w & a.bounds & a.submesh_bounds;
+                w & a.lod_indices & a.short_lod_indices & a.lod_submeshes & a.lods;
+                w & a.quantization & a.compact_vertices;
+            },
+            [&](const AssetTexture& a) {
+                w & a.format & a.width & a.height & a.channel_count & a.mip_count;
+                for (uint mip = 0; mip < a.mip_count; mip++) {
+                    w & a.datas[mip];
+                }
+            },
+            [&](const AssetCubeTexture& a) {
+                w & a.format & a.width & a.height & a.channel_count & a.mip_count;
+                for (uint slice = 0; slice < 6; slice++) {
+                    for (uint mip = 0; mip < a.mip_count; mip++) {
+                        w & a.datas[slice][mip];
+                    }
+                }
+            },
+            [&](const AssetMaterial& a) { w & a.alpha_cutoff & a.alpha_mode; },
+            [&](const AssetAnimationMesh& a) {
+                w & a.transform & a.node_count & a.joint_count & a.duration;
+                w & a.skinning_vertices;
+                w & a.index_format & a.indices & a.short_indices & a.submeshes;
+                w & a.bounds & a.submesh_bounds;
+                w & a.lod_indices & a.short_lod_indices & a.lod_submeshes & a.lods;
+                w & a.quantization & a.compact_skinning_vertices;
+                w & a.joint_nodes & a.joint_inverse_binds & a.node_parents & a.node_channels;
+                w & a.node_channels_times_t & a.node_channels_times_r & a.node_channels_times_s;
+                w & a.node_channels_values_t & a.node_channels_values_r & a.node_channels_values_s;
+            },
+            [&](const AssetFont& a) {
+                w & a.ascender & a.descender & a.space_advance & a.glyphs;
+            },
+            [&](const AssetMeshlets& a) {
+                w & a.meshlets & a.vertices & a.triangles & a.submeshes;
+            },
+        },
+        asset
+    );
+}
+
+static auto append_bytes(std::vector<std::byte>& dst, Span<const std::byte> src) -> void {
+    dst.insert(dst.end(), src.begin(), src.end());
+}
+
+template<typename T>
+static auto append_value(std::vector<std::byte>& dst, const T& value) -> void {
+    append_bytes(dst, std::as_bytes(Span<const T>(&value, 1)));
+}
+
+// Entry and record of an asset whose record is at `record_offset`, with spans
+// rebased onto `data_offset`.
+static auto asset_entry_record(const Asset& asset, uint64_t data_offset, uint64_t record_offset)
+    -> std::tuple<BakedAssetEntry, std::vector<std::byte>> {
+    auto writer = AssetRecordWriter {.data_offset = data_offset};
+    write_asset_record(writer, asset);
+    const auto entry = BakedAssetEntry {
+        .type = (uint)asset.index(),
+        .record_byte_count = (uint)writer.record.size(),
+        .record_offset = record_offset,
+        .hash = hash128(writer.content),
+    };
+    return {entry, std::move(writer.record)};
+}
+
+auto baked_task_entries(Span<const Hash128> keys, Span<const uint> entry_counts)
+    -> std::vector<BakedTaskEntry> {
+    FB_ASSERT(keys.size() == entry_counts.size());
+    auto tasks = std::vector<BakedTaskEntry>(keys.size());
+    auto first_entry = 0u;
+    for (size_t i = 0; i < keys.size(); i++) {
+        tasks[i] = {.key = keys[i], .first_entry = first_entry, .entry_count = entry_counts[i]};
+        first_entry += entry_counts[i];
+    }
+    return tasks;
+}
+
+auto baked_bin_header(Span<const std::byte> bytes) -> BakedBinHeader {
+    FB_ASSERT(bytes.size() >= sizeof(BakedBinHeader));
+    auto header = BakedBinHeader {};
+    std::memcpy(&header, bytes.data() + bytes.size() - sizeof(header), sizeof(header));
+    return header;
+}
+
+// Pads `bytes`, which start at `bytes_offset` in the bin, up to the header,
+// then appends the header, with the size of the table of contents.
+static auto append_header(
+    std::vector<std::byte>& bytes,
+    uint64_t bytes_offset,
+    BakedBinHeader header
+) -> void {
+    bytes.resize(align_up(bytes_offset + bytes.size(), BAKED_BIN_TOC_ALIGNMENT) - bytes_offset);
+    header.toc_byte_count = bytes_offset + bytes.size() - header.toc_offset;
+    append_value(bytes, header);
+}
+
+auto baked_assets_toc(
+    Span<const Asset> assets,
+    Span<const BakedTaskEntry> tasks,
+    size_t data_byte_count,
+    uint64_t generation
+) -> std::vector<std::byte> {
+    const auto toc_offset = align_up(data_byte_count, BAKED_BIN_TOC_ALIGNMENT);
+    const auto records_offset = toc_offset + assets.size() * sizeof(BakedAssetEntry)
+        + tasks.size() * sizeof(BakedTaskEntry);
+    auto toc = std::vector<std::byte>(toc_offset - data_byte_count);
+    auto records = std::vector<std::byte>();
+    for (const auto& asset : assets) {
+        auto [entry, record] = asset_entry_record(asset, 0, records_offset + records.size());
+        append_value(toc, entry);
+        append_bytes(records, record);
+    }
+    for (const auto& task : tasks) {
+        append_value(toc, task);
+    }
+    append_bytes(toc, records);
+    append_header(
+        toc,
+        data_byte_count,
+        BakedBinHeader {
+            .magic = ASSETS_BIN_MAGIC,
+            .version = BAKED_BIN_VERSION,
+            .entry_count = (uint)assets.size(),
+            .data_alignment = (uint)BAKED_BIN_DATA_ALIGNMENT,
+            .toc_offset = toc_offset,
+            .generation = generation,
+            .task_count = (uint)tasks.size(),
+        }
+    );
+    return toc;
+}
+
+auto baked_shaders_bin(
+    Span<const Shader> shaders,
+    Span<const BakedTaskEntry> tasks,
+    uint64_t generation
+) -> std::vector<std::byte> {
+    auto bin = std::vector<std::byte>();
+    auto entries = std::vector<std::byte>();
+    for (const auto& shader : shaders) {
+        bin.resize(align_up(bin.size(), BAKED_SHADER_ALIGNMENT));
+        append_value(
+            entries,
+            BakedShaderEntry {
+                .offset = bin.size(),
+                .byte_count = shader.dxil.size(),
+                .hash = hash128(shader.dxil),
+            }
+        );
+        append_bytes(bin, shader.dxil);
+    }
+    const auto toc_offset = align_up(bin.size(), BAKED_BIN_TOC_ALIGNMENT);
+    bin.resize(toc_offset);
+    append_bytes(bin, entries);
+    for (const auto& task : tasks) {
+        append_value(bin, task);
+    }
+    append_header(
+        bin,
+        0,
+        BakedBinHeader {
+            .magic = SHADERS_BIN_MAGIC,
+            .version = BAKED_BIN_VERSION,
+            .entry_count = (uint)shaders.size(),
+            .data_alignment = (uint)BAKED_BIN_DATA_ALIGNMENT,
+            .toc_offset = toc_offset,
+            .generation = generation,
+            .task_count = (uint)tasks.size(),
+        }
+    );
+    return bin;
+}
+
+static auto baked_entry_byte_count(uint magic) -> size_t {
+    return magic == ASSETS_BIN_MAGIC ? sizeof(BakedAssetEntry) : sizeof(BakedShaderEntry);
+}
+
+auto read_baked_bin_toc(std::string_view path, uint magic) -> Option<std::vector<std::byte>> {
+    auto error = std::error_code();
+    const auto file_byte_count = std::filesystem::file_size(path, error);
+    if (error || file_byte_count < sizeof(BakedBinHeader)) {
+        return std::nullopt;
+    }
+    const auto header_bytes =
+        read_file_range(path, file_byte_count - sizeof(BakedBinHeader), sizeof(BakedBinHeader));
+    if (header_bytes.size() < sizeof(BakedBinHeader)) {
+        return std::nullopt;
+    }
+    const auto header = baked_bin_header(header_bytes);
+    if (header.magic != magic || header.version != BAKED_BIN_VERSION
+        || header.toc_offset + header.toc_byte_count + sizeof(BakedBinHeader) != file_byte_count
+        || header.entry_count * baked_entry_byte_count(magic)
+                + header.task_count * sizeof(BakedTaskEntry)
+            > header.toc_byte_count) {
+        return std::nullopt;
+    }
+    auto toc = read_file_range(path, header.toc_offset, file_byte_count - header.toc_offset);
+    if (toc.size() != file_byte_count - header.toc_offset) {
+        return std::nullopt;
+    }
+    return toc;
+}
+
+// Checks that the bin was baked from the same tasks, and that the new bake of
+// the spliced tasks has as many entries as before. Returns the header and the
+// task entries of the bin.
+static auto splice_tasks(
+    Span<const std::byte> toc,
+    uint magic,
+    Span<const Hash128> task_keys,
+    Span<const size_t> task_indices,
+    Span<const uint> entry_counts
+) -> Option<std::tuple<BakedBinHeader, std::vector<BakedTaskEntry>>> {
+    FB_ASSERT(task_indices.size() == entry_counts.size());
+    const auto header = baked_bin_header(toc);
+    FB_ASSERT(header.magic == magic);
+    if (header.task_count != task_keys.size()) {
+        return std::nullopt;
+    }
+    const auto tasks_offset = header.entry_count * baked_entry_byte_count(magic);
+    FB_ASSERT(tasks_offset + header.task_count * sizeof(BakedTaskEntry) <= toc.size());
+    auto tasks = std::vector<BakedTaskEntry>(header.task_count);
+    std::memcpy(tasks.data(), toc.data() + tasks_offset, tasks.size() * sizeof(BakedTaskEntry));
+    for (size_t i = 0; i < tasks.size(); i++) {
+        if (tasks[i].key != task_keys[i]) {
+            return std::nullopt;
+        }
+    }
+    for (size_t i = 0; i < task_indices.size(); i++) {
+        if (tasks[task_indices[i]].entry_count != entry_counts[i]) {
+            return std::nullopt;
+        }
+    }
+    return std::tuple(header, std::move(tasks));
+}
+
+// Where a splice lands in a bin with table of contents `toc`: the end of the
+// bin, the appended data, at the data alignment, and the new table of
+// contents, past `data_byte_count` bytes of data.
+struct SpliceOffsets {
+    uint64_t end_offset;
+    uint64_t data_offset;
+    uint64_t toc_offset;
+};
+
+static auto splice_offsets(const BakedBinHeader& header, size_t data_byte_count)
+    -> SpliceOffsets {
+    const auto end_offset = header.toc_offset + header.toc_byte_count + sizeof(BakedBinHeader);
+    const auto data_offset = align_up(end_offset, BAKED_BIN_DATA_ALIGNMENT);
+    return {
+        .end_offset = end_offset,
+        .data_offset = data_offset,
+        .toc_offset = align_up(data_offset + data_byte_count, BAKED_BIN_TOC_ALIGNMENT),
+    };
+}
+
+// Splice of `data_byte_count` bytes of data, and the new table of contents:
+// `entries`, the task entries of the bin, and `records`, all at `offsets`, and
+// the grown header.
+static auto finish_splice(
+    BakedBinHeader header,
+    Span<const std::byte> toc,
+    const SpliceOffsets& offsets,
+    size_t data_byte_count,
+    Span<const std::byte> entries,
+    Span<const std::byte> records
+) -> BakedBinSplice {
+    const auto tasks = toc.subspan(entries.size(), header.task_count * sizeof(BakedTaskEntry));
+    const auto data_end_offset = offsets.data_offset + data_byte_count;
+    auto new_toc = std::vector<std::byte>(offsets.toc_offset - data_end_offset);
+    append_bytes(new_toc, entries);
+    append_bytes(new_toc, tasks);
+    append_bytes(new_toc, records);
+    header.toc_offset = offsets.toc_offset;
+    header.generation++;
+    append_header(new_toc, data_end_offset, header);
+    return {
+        .end_offset = offsets.end_offset,
+        .data_offset = offsets.data_offset,
+        .data_byte_count = data_byte_count,
+        .toc = std::move(new_toc),
+    };
+}
+
+auto splice_baked_assets(
+    Span<const std::byte> toc,
+    Span<const Hash128> task_keys,
+    Span<const size_t> task_indices,
+    Span<const uint> asset_counts,
+    Span<const Asset> assets,
+    size_t data_byte_count
+) -> Option<BakedBinSplice> {
+    const auto tasks = splice_tasks(toc, ASSETS_BIN_MAGIC, task_keys, task_indices, asset_counts);
+    if (!tasks.has_value()) {
+        return std::nullopt;
+    }
+    const auto& [header, task_entries] = tasks.value();
+    auto entries = std::vector<BakedAssetEntry>(header.entry_count);
+    std::memcpy(entries.data(), toc.data(), entries.size() * sizeof(BakedAssetEntry));
+
+    // Records of the new assets follow the entries, rebased onto the data.
+    const auto offsets = splice_offsets(header, data_byte_count);
+    const auto records_offset = offsets.toc_offset + entries.size() * sizeof(BakedAssetEntry)
+        + task_entries.size() * sizeof(BakedTaskEntry);
+    auto records = std::vector<std::byte>();
+    auto asset_index = size_t(0);
+    for (size_t i = 0; i < task_indices.size(); i++) {
+        const auto& task = task_entries[task_indices[i]];
+        for (uint id = task.first_entry; id < task.first_entry + task.entry_count; id++) {
+            const auto& asset = assets[asset_index++];
+            if (entries[id].type != (uint)asset.index()) {
+                return std::nullopt;
+            }
+            auto [entry, record] =
+                asset_entry_record(asset, offsets.data_offset, records_offset + records.size());
+            entries[id] = entry;
+            append_bytes(records, record);
+        }
+    }
+    FB_ASSERT(asset_index == assets.size());
+    return finish_splice(
+        header,
+        toc,
+        offsets,
+        data_byte_count,
+        std::as_bytes(Span(entries)),
+        records
+    );
+}
+
+auto splice_baked_shaders(
+    Span<const std::byte> toc,
+    Span<const Hash128> task_keys,
+    Span<const size_t> task_indices,
+    Span<const uint> shader_counts,
+    Span<const Shader> shaders
+) -> Option<BakedBinSplice> {
+    const auto tasks =
+        splice_tasks(toc, SHADERS_BIN_MAGIC, task_keys, task_indices, shader_counts);
+    if (!tasks.has_value()) {
+        return std::nullopt;
+    }
+    const auto& [header, task_entries] = tasks.value();
+    auto entries = std::vector<BakedShaderEntry>(header.entry_count);
+    std::memcpy(entries.data(), toc.data(), entries.size() * sizeof(BakedShaderEntry));
+
+    // Shaders are laid out before the offsets are known, then rebased.
+    auto data = std::vector<std::byte>();
+    auto spliced_ids = std::vector<uint>();
+    auto shader_index = size_t(0);
+    for (size_t i = 0; i < task_indices.size(); i++) {
+        const auto& task = task_entries[task_indices[i]];
+        for (uint id = task.first_entry; id < task.first_entry + task.entry_count; id++) {
+            const auto& shader = shaders[shader_index++];
+            data.resize(align_up(data.size(), BAKED_SHADER_ALIGNMENT));
+            entries[id] = {
+                .offset = data.size(),
+                .byte_count = shader.dxil.size(),
+                .hash = hash128(shader.dxil),
+            };
+            spliced_ids.push_back(id);
+            append_bytes(data, shader.dxil);
+        }
+    }
+    FB_ASSERT(shader_index == shaders.size());
+    const auto offsets = splice_offsets(header, data.size());
+    for (const auto id : spliced_ids) {
+        entries[id].offset += offsets.data_offset;
+    }
+    auto splice =
+        finish_splice(header, toc, offsets, data.size(), std::as_bytes(Span(entries)), {});
+    splice.data = std::move(data);
+    return splice;
+}
+
+auto write_baked_bin_splice(
+    FileWriter& writer,
+    std::string_view path,
+    const BakedBinSplice& splice,
+    std::string_view data_path
+) -> void {
+    static constexpr auto PADDING = std::array<std::byte, BAKED_BIN_DATA_ALIGNMENT> {};
+    FB_ASSERT(writer.byte_count() == 0);
+    writer.write_file(path, 0, splice.end_offset);
+    writer.write(Span<const std::byte>(PADDING).first(splice.data_offset - splice.end_offset));
+    if (data_path.empty()) {
+        writer.write(splice.data);
+    } else {
+        writer.write_file(data_path);
+    }
+    FB_ASSERT(writer.byte_count() == splice.data_offset + splice.data_byte_count);
+    writer.write(splice.toc);
+}
+
+auto baked_id_name(std::string_view name) -> std::string {
+    auto id_name = std::string();
+    auto upper = true;
+    for (const auto c : name) {
+        if (c == '_') {
+            upper = true;
+            continue;
+        }
+        id_name.push_back(upper ? (char)std::toupper((unsigned char)c) : c);
+        upper = false;
+    }
+    return id_name;
+}
+
+} // namespace fb
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "../assets/types.hpp"
+#include "../shaders/shaders.hpp"
+
+namespace fb {
+
+// Layout of the baked bins, mirrored by the readers in `baked_types.hpp`.
+//
+// Both bins start with the data that spans point into, then the table of
+// contents at `toc_offset`: one entry per asset or shader, in the order of the
+// generated ids, one entry per task, and for assets the records of the assets'
+// fields, with every span stored as a `BakedSpanRecord`. The header is last,
+// so that a bin is written in one pass, with the data streamed ahead of a
+// table of contents that is only known once it is baked. All offsets are from
+// the start of the file. The data starts the file, and every span's offset is
+// a multiple of its alignment, which divides `data_alignment`, so spans stay
+// aligned wherever the loader maps the file to an address aligned to
+// `data_alignment`. The generation is bumped by every publish of a watching
+// baker, and by every splice, so that loaders can tell versions of a bin apart.
+//
+// Task entries let the baker splice a new bake of some tasks into a bin: a new
+// version of the bin is written with their data appended, followed by a new
+// table of contents, whose entries of the other tasks, and their records, are
+// unchanged.
+inline constexpr uint ASSETS_BIN_MAGIC = 0x53414246; // "FBAS"
+inline constexpr uint SHADERS_BIN_MAGIC = 0x48534246; // "FBSH"
+inline constexpr uint BAKED_BIN_VERSION = 9;
+inline constexpr size_t BAKED_BIN_DATA_ALIGNMENT = ASSET_MAX_ALIGNMENT;
+inline constexpr size_t BAKED_BIN_TOC_ALIGNMENT = 16;
+inline constexpr size_t BAKED_SHADER_ALIGNMENT = 16;
+
+struct BakedBinHeader {
+    uint magic;
+    uint version;
+    uint entry_count;
+    uint data_alignment;
+    uint64_t toc_offset;
+    uint64_t toc_byte_count;
+    uint64_t generation;
+    uint task_count;
+    uint reserved;
+};
+
+struct BakedAssetEntry {
+    uint type;
+    uint record_byte_count;
+    uint64_t record_offset;
+    Hash128 hash;
+};
+
+struct BakedSpanRecord {
+    uint64_t offset;
+    uint64_t element_count;
+    uint64_t byte_count;
+    uint64_t alignment;
+    Hash128 hash;
+};
+
+struct BakedShaderEntry {
+    uint64_t offset;
+    uint64_t byte_count;
+    Hash128 hash;
+};
+
+// Task that baked the entries from `first_entry`, keyed by its parameters.
+struct BakedTaskEntry {
+    Hash128 key;
+    uint first_entry;
+    uint entry_count;
+};
+
+// Entries of tasks with keys `keys`, that baked `entry_counts` entries each.
+auto baked_task_entries(Span<const Hash128> keys, Span<const uint> entry_counts)
+    -> std::vector<BakedTaskEntry>;
+
+// Header of a bin, or of its table of contents, which both end with it.
+auto baked_bin_header(Span<const std::byte> bytes) -> BakedBinHeader;
+
+// End of an assets bin whose data is `data_byte_count` bytes: the padding up
+// to the table of contents, the entries and records, and the header. Entry
+// hashes cover the asset's fields and the hashes of its spans, but not their
+// offsets, so that they only change with the asset itself.
+auto baked_assets_toc(
+    Span<const Asset> assets,
+    Span<const BakedTaskEntry> tasks,
+    size_t data_byte_count,
+    uint64_t generation = 0
+) -> std::vector<std::byte>;
+
+// Whole shaders bin, with the DXIL of every shader in order, each aligned to
+// `BAKED_SHADER_ALIGNMENT`.
+auto baked_shaders_bin(
+    Span<const Shader> shaders,
+    Span<const BakedTaskEntry> tasks,
+    uint64_t generation = 0
+) -> std::vector<std::byte>;
+
+// Table of contents of an existing bin, from `toc_offset` to the end of the
+// file, header included. None if there is no bin of the current version at
+// `path`.
+auto read_baked_bin_toc(std::string_view path, uint magic) -> Option<std::vector<std::byte>>;
+
+// New version of a bin with a new bake of some tasks spliced in: the bin up to
+// `end_offset`, padding, the new data at `data_offset`, then `toc`, the new
+// table of contents, which makes them visible. Bytes of the previous bake of
+// the tasks, and the previous table of contents, stay in the bin, unused,
+// until the next full bake. `data` holds the data of shader splices, assets
+// are streamed from the file they were baked to.
+struct BakedBinSplice {
+    uint64_t end_offset;
+    uint64_t data_offset;
+    uint64_t data_byte_count;
+    std::vector<std::byte> data;
+    std::vector<std::byte> toc;
+};
+
+// Splices the assets baked by the tasks at `task_indices` into the bin with
+// table of contents `toc`. The assets are in task order, `asset_counts` of
+// them per task, with spans pointing into `data_byte_count` bytes of data.
+// None if the bin wasn't baked from tasks with keys `task_keys`, or if a task
+// baked other numbers or types of assets than before, as ids would change,
+// which takes a full bake.
+auto splice_baked_assets(
+    Span<const std::byte> toc,
+    Span<const Hash128> task_keys,
+    Span<const size_t> task_indices,
+    Span<const uint> asset_counts,
+    Span<const Asset> assets,
+    size_t data_byte_count
+) -> Option<BakedBinSplice>;
+
+// Splices shaders into a shaders bin, like `splice_baked_assets`.
+auto splice_baked_shaders(
+    Span<const std::byte> toc,
+    Span<const Hash128> task_keys,
+    Span<const size_t> task_indices,
+    Span<const uint> shader_counts,
+    Span<const Shader> shaders
+) -> Option<BakedBinSplice>;
+
+// Writes the spliced version of the bin at `path`, with the data of the splice,
+// or the file at `data_path` if there is one. The bin itself isn't touched.
+auto write_baked_bin_splice(
+    FileWriter& writer,
+    std::string_view path,
+    const BakedBinSplice& splice,
+    std::string_view data_path = {}
+) -> void;
+
+// Converts snake_case asset and shader names to PascalCase id names.
+auto baked_id_name(std::string_view name) -> std::string;
+
+} // namespace fb
@@ -0,0 +1,224 @@
+#include "emitter.hpp"
+#include "bins.hpp"
+#include "templates/baked_types_hpp.hpp"
+#include "templates/baked_cpp.hpp"
+#include "../assets/types.hpp"
+
+namespace fb {
+
+//
+// Emitter.
+//
+
+auto CodeEmitter::line(std::string_view text) -> void {
+    if (_blank_pending && !_at_block_start) {
+        write("\n");
+    }
+    _blank_pending = false;
+    _at_block_start = false;
+    write_indent();
+    write(text);
+    write("\n");
+}
+
+auto CodeEmitter::blank() -> void {
+    _blank_pending = true;
+}
+
+auto CodeEmitter::open(std::string_view text) -> void {
+    line(std::format("{} {{", text));
+    _indent++;
+    _at_block_start = true;
+}
+
+auto CodeEmitter::close(std::string_view suffix) -> void {
+    FB_ASSERT(_indent > 0);
+    _indent--;
+    _blank_pending = false;
+    _at_block_start = false;
+    line(std::format("}}{}", suffix));
+}
+
+auto CodeEmitter::access(std::string_view name) -> void {
+    FB_ASSERT(_indent > 0);
+    blank();
+    _indent--;
+    line(std::format("{}:", name));
+    _indent++;
+    _at_block_start = true;
+}
+
+auto CodeEmitter::function(std::string_view signature, std::string_view body) -> void {
+    const auto one_line = std::format("{} {{ {} }}", signature, body);
+    if (_indent * CODE_EMITTER_INDENT_WIDTH + one_line.size() <= CODE_EMITTER_COLUMN_LIMIT) {
+        line(one_line);
+        return;
+    }
+    open(signature);
+    line(body);
+    close();
+}
+
+auto CodeEmitter::text(std::string_view text, Span<const CodeTemplateValue> values) -> void {
+    if (_blank_pending && !_at_block_start) {
+        write("\n");
+    }
+    _blank_pending = false;
+    _at_block_start = false;
+
+    // Single pass: copy up to the next placeholder, then its value.
+    auto begin = size_t(0);
+    for (;;) {
+        const auto open = text.find("{{", begin);
+        if (open == std::string_view::npos) {
+            write(text.substr(begin));
+            break;
+        }
+        const auto close = text.find("}}", open);
+        FB_ASSERT_MSG(close != std::string_view::npos, "Unterminated template placeholder");
+        const auto name = text.substr(open + 2, close - open - 2);
+        const auto value = std::find_if(values.begin(), values.end(), [&](const auto& v) {
+            return v.name == name;
+        });
+        FB_ASSERT_MSG(value != values.end(), "Unknown template placeholder: {}", name);
+        write(text.substr(begin, open - begin));
+        write(value->value);
+        begin = close + 2;
+    }
+}
+
+auto CodeEmitter::write(std::string_view text) -> void {
+    _str.append(text);
+    _hasher.update(std::as_bytes(Span<const char>(text.data(), text.size())));
+}
+
+auto CodeEmitter::write_indent() -> void {
+    for (uint i = 0; i < _indent * CODE_EMITTER_INDENT_WIDTH; i++) {
+        write(" ");
+    }
+}
+
+//
+// Generated sources.
+//
+
+auto emit_baked_types_hpp() -> CodeEmitter {
+    const auto max_mip_count = std::to_string(MAX_MIP_COUNT);
+    const auto meshlet_max_vertex_count = std::to_string(MESHLET_MAX_VERTEX_COUNT);
+    const auto meshlet_max_triangle_count = std::to_string(MESHLET_MAX_TRIANGLE_COUNT);
+    const auto values = std::to_array<CodeTemplateValue>({
+        {"max_mip_count", max_mip_count},
+        {"meshlet_max_vertex_count", meshlet_max_vertex_count},
+        {"meshlet_max_triangle_count", meshlet_max_triangle_count},
+    });
+    auto code = CodeEmitter();
+    code.text(BAKED_TYPES_HPP, values);
+    return code;
+}
+
+// `enum class {name} : uint`, with one enumerator per line, or none.
+static auto emit_id_enum(CodeEmitter& code, std::string_view name, Span<const std::string> ids)
+    -> void {
+    if (ids.empty()) {
+        code.line(std::format("enum class {} : uint {{}};", name));
+        return;
+    }
+    code.open(std::format("enum class {} : uint", name));
+    for (const auto& id : ids) {
+        code.line(std::format("{},", id));
+    }
+    code.close(";");
+}
+
+auto emit_baked_hpp(
+    std::string_view app_name,
+    Span<const CodeAsset> assets,
+    Span<const std::string_view> shader_names
+) -> CodeEmitter {
+    auto asset_ids = std::vector<std::string>();
+    for (const auto& asset : assets) {
+        asset_ids.push_back(baked_id_name(asset.name));
+    }
+    auto shader_ids = std::vector<std::string>();
+    for (const auto shader_name : shader_names) {
+        shader_ids.push_back(baked_id_name(shader_name));
+    }
+
+    auto code = CodeEmitter();
+    code.line("#pragma once");
+    code.blank();
+    code.line("#include \"../baked_types.hpp\"");
+    code.blank();
+    code.line(std::format("namespace fb::baked::{} {{", app_name));
+    code.blank();
+
+    // Assets.
+    emit_id_enum(code, "AssetId", asset_ids);
+    code.blank();
+    code.line(std::format("inline constexpr uint ASSET_COUNT = {};", assets.size()));
+    code.blank();
+    code.open("class Assets");
+    code.access("public");
+    code.line("auto load() -> void;");
+    code.blank();
+    code.line("// Swaps in the bin published by a watching baker, and returns the assets");
+    code.line("// whose contents changed. The whole bin is replaced, so every asset got");
+    code.line("// earlier is invalidated, and nothing built from them is rebuilt. None if");
+    code.line("// the assets themselves changed, which takes a rebuild.");
+    code.line("auto reload() -> Option<std::vector<AssetId>>;");
+    code.blank();
+    code.line("template<typename T>");
+    code.function("auto get(AssetId id) const -> T", "return _file.get<T>((uint)id);");
+    code.blank();
+    for (size_t i = 0; i < assets.size(); i++) {
+        code.function(
+            std::format("auto {}() const -> {}", assets[i].name, assets[i].type_name),
+            std::format("return get<{}>(AssetId::{});", assets[i].type_name, asset_ids[i])
+        );
+    }
+    code.access("private");
+    code.line("AssetsFile _file;");
+    code.close(";");
+    code.blank();
+
+    // Shaders.
+    emit_id_enum(code, "ShaderId", shader_ids);
+    code.blank();
+    code.line(std::format("inline constexpr uint SHADER_COUNT = {};", shader_names.size()));
+    code.blank();
+    code.open("class Shaders");
+    code.access("public");
+    code.line("auto load() -> void;");
+    code.blank();
+    code.line("// Swaps in the bin published by a watching baker, like `Assets::reload`.");
+    code.line("auto reload() -> Option<std::vector<ShaderId>>;");
+    code.blank();
+    code.function(
+        "auto get(ShaderId id) const -> Span<const std::byte>",
+        "return _file.get((uint)id);"
+    );
+    code.blank();
+    for (size_t i = 0; i < shader_names.size(); i++) {
+        code.function(
+            std::format("auto {}() const -> Span<const std::byte>", shader_names[i]),
+            std::format("return get(ShaderId::{});", shader_ids[i])
+        );
+    }
+    code.access("private");
+    code.line("ShadersFile _file;");
+    code.close(";");
+    code.blank();
+    code.line(std::format("}} // namespace fb::baked::{}", app_name));
+    return code;
+}
+
+auto emit_baked_cpp(std::string_view app_name) -> CodeEmitter {
+    const auto values = std::to_array<CodeTemplateValue>({
+        {"app_name", app_name},
+    });
+    auto code = CodeEmitter();
+    code.text(BAKED_CPP, values);
+    return code;
+}
+
+} // namespace fb
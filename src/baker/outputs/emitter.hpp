@@ -0,0 +1,73 @@
+#pragma once
+
+#include <common/common.hpp>
+
+namespace fb {
+
+inline constexpr uint CODE_EMITTER_COLUMN_LIMIT = 100;
+inline constexpr uint CODE_EMITTER_INDENT_WIDTH = 4;
+
+struct CodeTemplateValue {
+    std::string_view name;
+    std::string_view value;
+};
+
+// Writes generated code in one pass, already formatted the way clang-format
+// formats it with the repository's style, so no formatter has to run on it.
+// Only the constructs the baker generates are covered: lines at the current
+// indentation, blocks, short functions, which go on one line when they fit
+// in the column limit, and templates written verbatim. Blank lines never
+// repeat, never open or close a block, and never follow an access specifier.
+// Output is hashed as it goes.
+class CodeEmitter {
+public:
+    auto line(std::string_view text) -> void;
+    auto blank() -> void;
+
+    // `{text} {`, and the lines up to the matching `close` are indented.
+    auto open(std::string_view text) -> void;
+    // `}{suffix}`, one level up.
+    auto close(std::string_view suffix = {}) -> void;
+    // `{name}:`, one level up, after a blank line unless it opens the block.
+    auto access(std::string_view name) -> void;
+
+    // `{signature} { {body} }`, or the body on its own line if that's too long.
+    auto function(std::string_view signature, std::string_view body) -> void;
+
+    // Writes `text` as is, with every `{{name}}` replaced by its value. Every
+    // placeholder must have a value.
+    auto text(std::string_view text, Span<const CodeTemplateValue> values = {}) -> void;
+
+    auto str() const -> const std::string& { return _str; }
+    auto bytes() const -> Span<const std::byte> { return std::as_bytes(Span<const char>(_str)); }
+    auto hash() const -> Hash128 { return _hasher.digest(); }
+
+private:
+    auto write(std::string_view text) -> void;
+    auto write_indent() -> void;
+
+    std::string _str;
+    Hasher128 _hasher;
+    uint _indent = 0;
+    bool _blank_pending = false;
+    bool _at_block_start = true;
+};
+
+// What the generated code knows of an asset: its name, and its baked type.
+struct CodeAsset {
+    std::string_view name;
+    std::string_view type_name;
+};
+
+// Generated sources. Only the names and types of assets, and the names of
+// shaders, end up in them. Everything else is in the tables of contents of
+// the bins, so that content changes never touch the sources.
+auto emit_baked_types_hpp() -> CodeEmitter;
+auto emit_baked_hpp(
+    std::string_view app_name,
+    Span<const CodeAsset> assets,
+    Span<const std::string_view> shader_names
+) -> CodeEmitter;
+auto emit_baked_cpp(std::string_view app_name) -> CodeEmitter;
+
+} // namespace fb
@@ -0,0 +1,168 @@
+#include "output_hashes.hpp"
+
+#include <filesystem>
+
+namespace fb {
+
+OutputHashes::OutputHashes(std::string_view path)
+    : _path(path) {
+    if (!file_exists(_path)) {
+        return;
+    }
+
+    // Validate.
+    const auto file = FileBuffer::from_path(_path);
+    const auto file_bytes = file.as_span();
+    auto header = OutputHashesHeader {};
+    if (file_bytes.size() >= sizeof(header)) {
+        std::memcpy(&header, file_bytes.data(), sizeof(header));
+    }
+    const auto bytes = file_bytes.subspan(std::min(file_bytes.size(), sizeof(header)));
+    if (header.magic != OUTPUT_HASHES_MAGIC || header.version != OUTPUT_HASHES_VERSION
+        || header.byte_count != bytes.size() || header.hash != hash128(bytes)) {
+        FB_LOG_WARN("Ignoring invalid output hashes: {}", _path);
+        return;
+    }
+
+    // Entries.
+    auto arc = DeserializingArchive(bytes);
+    auto file_count = uint64_t(0);
+    arc & file_count;
+    for (uint64_t i = 0; i < file_count; i++) {
+        auto file_path = std::string();
+        auto state = FileState {};
+        arc & file_path & state;
+        _files.emplace(std::move(file_path), state);
+    }
+    FB_ASSERT(arc.fully_consumed());
+}
+
+auto OutputHashes::file_state(std::string_view path, Hash128 hash) -> Option<FileState> {
+    namespace fs = std::filesystem;
+
+    auto error = std::error_code();
+    const auto byte_count = fs::file_size(path, error);
+    const auto write_time = fs::last_write_time(path, error);
+    if (error) {
+        return std::nullopt;
+    }
+    return FileState {
+        .byte_count = byte_count,
+        .write_time = (int64_t)write_time.time_since_epoch().count(),
+        .hash = hash,
+    };
+}
+
+auto OutputHashes::unchanged(std::string_view path, uint64_t byte_count, Hash128 hash) -> bool {
+    // Hash of the file, from the record if it wasn't touched since, and from
+    // its contents otherwise. Files of another size differ anyway.
+    const auto state = file_state(path, hash);
+    if (!state.has_value() || state->byte_count != byte_count) {
+        return false;
+    }
+    auto file_hash = Hash128();
+    const auto it = _files.find(std::string(path));
+    if (it != _files.end() && it->second.byte_count == state->byte_count
+        && it->second.write_time == state->write_time) {
+        file_hash = it->second.hash;
+        _hit_count++;
+    } else {
+        file_hash = hash128(FileBuffer::from_path(path).as_span());
+        _read_count++;
+    }
+    if (file_hash != hash) {
+        return false;
+    }
+    _files.insert_or_assign(std::string(path), state.value());
+    _unchanged_byte_count += byte_count;
+    return true;
+}
+
+auto OutputHashes::record(std::string_view path, Hash128 hash) -> void {
+    const auto state = file_state(path, hash);
+    FB_ASSERT_MSG(state.has_value(), "Failed to write output: {}", path);
+    _files.insert_or_assign(std::string(path), state.value());
+}
+
+auto OutputHashes::write(std::string_view path, Span<const std::byte> bytes, Hash128 hash)
+    -> bool {
+    const auto lock = std::scoped_lock(_mutex);
+    if (unchanged(path, bytes.size(), hash)) {
+        return false;
+    }
+    const auto next_path = std::format("{}.next", path);
+    write_whole_file(next_path, bytes);
+    move_file(path, next_path);
+    record(path, hash);
+    _written_byte_count += bytes.size();
+    return true;
+}
+
+auto OutputHashes::publish(
+    std::string_view path,
+    std::string_view next_path,
+    uint64_t byte_count,
+    Hash128 hash
+) -> bool {
+    const auto lock = std::scoped_lock(_mutex);
+    if (unchanged(path, byte_count, hash)) {
+        delete_file(next_path);
+        return false;
+    }
+    move_file(path, next_path);
+    record(path, hash);
+    _written_byte_count += byte_count;
+    return true;
+}
+
+auto OutputHashes::link(
+    std::string_view path,
+    std::string_view src_path,
+    uint64_t byte_count,
+    Hash128 hash
+) -> bool {
+    const auto lock = std::scoped_lock(_mutex);
+    if (unchanged(path, byte_count, hash)) {
+        return false;
+    }
+    const auto next_path = std::format("{}.next", path);
+    delete_file(next_path);
+    if (link_file(next_path, src_path)) {
+        _linked_byte_count += byte_count;
+    } else {
+        copy_file(next_path, src_path);
+        _written_byte_count += byte_count;
+    }
+    move_file(path, next_path);
+    record(path, hash);
+    return true;
+}
+
+auto OutputHashes::save() -> void {
+    if (!enabled()) {
+        return;
+    }
+
+    const auto lock = std::scoped_lock(_mutex);
+    auto bytes = std::vector<std::byte>();
+    auto arc = SerializingArchive(bytes);
+    auto file_count = (uint64_t)_files.size();
+    arc & file_count;
+    for (const auto& [path, state] : _files) {
+        auto file_path = path;
+        auto file_state = state;
+        arc & file_path & file_state;
+    }
+    const auto header = OutputHashesHeader {
+        .magic = OUTPUT_HASHES_MAGIC,
+        .version = OUTPUT_HASHES_VERSION,
+        .byte_count = bytes.size(),
+        .hash = hash128(bytes),
+    };
+    auto file_bytes = std::vector<std::byte>(sizeof(header));
+    std::memcpy(file_bytes.data(), &header, sizeof(header));
+    file_bytes.insert(file_bytes.end(), bytes.begin(), bytes.end());
+    write_whole_file(_path, file_bytes);
+}
+
+} // namespace fb
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <common/common.hpp>
+
+#include <mutex>
+
+namespace fb {
+
+// Hashes of the outputs the baker wrote, with the size and write time their
+// files had then, saved between bakes. Outputs are compared with their files
+// by hash, and only written if they differ. A file still at its recorded size
+// and write time isn't read back to be hashed again.
+//
+// Changed files are written next to their path and renamed over it, so that
+// readers never see a partial file. Outputs shared by several directories are
+// written once, and hard linked into the others where the file system allows.
+inline constexpr uint OUTPUT_HASHES_MAGIC = 0x484f4246; // "FBOH"
+inline constexpr uint OUTPUT_HASHES_VERSION = 1;
+
+struct OutputHashesHeader {
+    uint magic;
+    uint version;
+    uint64_t byte_count;
+    Hash128 hash;
+};
+
+class OutputHashes {
+    FB_NO_COPY_MOVE(OutputHashes);
+
+public:
+    // Nothing is saved, and every file is read back.
+    OutputHashes() = default;
+    // Loads the hashes saved at `path`, if they are valid.
+    explicit OutputHashes(std::string_view path);
+
+    // Writes `bytes`, whose hash is `hash`, to the file at `path`, unless it
+    // already holds them. Returns whether it was written.
+    auto write(std::string_view path, Span<const std::byte> bytes, Hash128 hash) -> bool;
+    auto write(std::string_view path, Span<const std::byte> bytes) -> bool {
+        return write(path, bytes, hash128(bytes));
+    }
+
+    // Same, with the contents of `next_path`, a new version written next to
+    // `path`, which is renamed over it, or deleted if `path` already holds it.
+    auto publish(
+        std::string_view path,
+        std::string_view next_path,
+        uint64_t byte_count,
+        Hash128 hash
+    ) -> bool;
+
+    // Same, with the contents of `src_path`, an output already written, which
+    // is linked rather than copied when possible.
+    auto link(std::string_view path, std::string_view src_path, uint64_t byte_count, Hash128 hash)
+        -> bool;
+
+    auto save() -> void;
+
+    auto enabled() const -> bool { return !_path.empty(); }
+    auto hit_count() const -> uint { return _hit_count.load(); }
+    auto read_count() const -> uint { return _read_count.load(); }
+    auto written_byte_count() const -> uint64_t { return _written_byte_count.load(); }
+    auto linked_byte_count() const -> uint64_t { return _linked_byte_count.load(); }
+    auto unchanged_byte_count() const -> uint64_t { return _unchanged_byte_count.load(); }
+
+private:
+    struct FileState {
+        uint64_t byte_count;
+        int64_t write_time;
+        Hash128 hash;
+    };
+
+    static auto file_state(std::string_view path, Hash128 hash) -> Option<FileState>;
+
+    auto unchanged(std::string_view path, uint64_t byte_count, Hash128 hash) -> bool;
+    auto record(std::string_view path, Hash128 hash) -> void;
+
+    std::string _path;
+    std::mutex _mutex;
+    std::unordered_map<std::string, FileState> _files;
+    std::atomic<uint> _hit_count = 0;
+    std::atomic<uint> _read_count = 0;
+    std::atomic<uint64_t> _written_byte_count = 0;
+    std::atomic<uint64_t> _linked_byte_count = 0;
+    std::atomic<uint64_t> _unchanged_byte_count = 0;
+};
+
+} // namespace fb
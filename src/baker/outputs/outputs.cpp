@@ -1,460 +1,211 @@
 #include "outputs.hpp"
-#include "templates/baked_types_hpp.hpp"
-#include "templates/baked_hpp.hpp"
-#include "templates/baked_cpp.hpp"
-
-#include <sstream>
-
-template<>
-struct std::formatter<DXGI_FORMAT>: std::formatter<char> {
-    template<class FormatContext>
-    auto format(DXGI_FORMAT v, FormatContext& fc) const {
-        switch (v) {
-            case DXGI_FORMAT_R8G8B8A8_UNORM:
-                return std::format_to(fc.out(), "DXGI_FORMAT_R8G8B8A8_UNORM");
-            case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
-                return std::format_to(fc.out(), "DXGI_FORMAT_R8G8B8A8_UNORM_SRGB");
-            case DXGI_FORMAT_R16G16_FLOAT:
-                return std::format_to(fc.out(), "DXGI_FORMAT_R16G16_FLOAT");
-            case DXGI_FORMAT_R16G16B16A16_FLOAT:
-                return std::format_to(fc.out(), "DXGI_FORMAT_R16G16B16A16_FLOAT");
-            case DXGI_FORMAT_R32G32B32A32_FLOAT:
-                return std::format_to(fc.out(), "DXGI_FORMAT_R32G32B32A32_FLOAT");
-            default: FB_FATAL();
-        }
-    }
-};
+#include "bins.hpp"
+#include "emitter.hpp"
+#include "../assets/mesh_order.hpp"
+#include "../utils/names.hpp"
 
 namespace fb {
 
-auto bake_app_datas(
+// Names of the baked types, indexed like `Asset`.
+static constexpr auto ASSET_TYPE_NAMES = std::to_array<std::string_view>({
+    "Copy",
+    "Mesh",
+    "Texture",
+    "CubeTexture",
+    "Material",
+    "AnimationMesh",
+    "Font",
+    "Meshlets",
+});
+static_assert(ASSET_TYPE_NAMES.size() == std::variant_size_v<Asset>);
+
+struct AppData {
+    std::vector<Shader> shaders;
+    std::vector<Asset> assets;
+    AssetsBin assets_bin;
+    std::string assets_bin_path;
+    std::unique_ptr<FileWriter> assets_bin_writer;
+};
+
+static auto asset_task_keys(Span<const AssetTask> asset_tasks) -> std::vector<Hash128> {
+    auto keys = std::vector<Hash128>();
+    for (const auto& asset_task : asset_tasks) {
+        keys.push_back(asset_task_params_key(asset_task));
+    }
+    return keys;
+}
+
+static auto shader_task_keys(Span<const ShaderTask> shader_tasks) -> std::vector<Hash128> {
+    auto keys = std::vector<Hash128>();
+    for (const auto& shader_task : shader_tasks) {
+        keys.push_back(shader_task_params_key(shader_task));
+    }
+    return keys;
+}
+
+static auto shader_task_counts(Span<const ShaderTask> shader_tasks) -> std::vector<uint> {
+    auto counts = std::vector<uint>();
+    for (const auto& shader_task : shader_tasks) {
+        counts.push_back((uint)shader_task.entry_points.size());
+    }
+    return counts;
+}
+
+static auto bake_app_shaders(
+    BakeContext& context,
+    std::string_view source_dir,
+    Span<const ShaderTask> shader_tasks
+) -> std::vector<Shader> {
+    if (context.farm != nullptr) {
+        return compile_shaders(
+            context.pool,
+            context.profiler,
+            context.shader_sources,
+            context.shader_cache,
+            source_dir,
+            shader_tasks,
+            [&]() { return BakeFarmShaderCompiler(*context.farm, ShaderCompiler()); }
+        );
+    }
+    return bake_shaders(
+        context.pool,
+        context.profiler,
+        context.shader_sources,
+        context.shader_cache,
+        source_dir,
+        shader_tasks
+    );
+}
+
+// Writes the PDB and the disassembly of every shader into the first output
+// directory, and links them into the others.
+static auto write_shader_files(
+    OutputHashes& hashes,
     Span<const std::string_view> output_dirs,
-    std::string_view app_name,
-    Span<const AssetTask> app_asset_tasks,
-    Span<const ShaderTask> app_shader_tasks
+    Span<const Shader> shaders
 ) -> void {
+    for (const auto& shader : shaders) {
+        const auto pdb_file_name = std::format("{}.pdb", shader.hash);
+        const auto txt_file_name = std::format("{}.txt", shader.name);
+        const auto txt = std::format(
+            "// shader_hash: {}\n{}\n/* disassembly:\n{}*/\n",
+            shader.hash,
+            shader.counters.to_comment_string(),
+            shader.disassembly.data()
+        );
+        const auto files = std::to_array<std::tuple<std::string_view, Span<const std::byte>>>({
+            {pdb_file_name, shader.pdb},
+            {txt_file_name, std::as_bytes(Span<const char>(txt))},
+        });
+        for (const auto& [file_name, bytes] : files) {
+            const auto hash = hash128(bytes);
+            const auto first_path = std::format("{}/shaders/{}", output_dirs[0], file_name);
+            hashes.write(first_path, bytes, hash);
+            for (size_t i = 1; i < output_dirs.size(); i++) {
+                const auto path = std::format("{}/shaders/{}", output_dirs[i], file_name);
+                hashes.link(path, first_path, bytes.size(), hash);
+            }
+        }
+    }
+}
+
+static auto write_app_data(BakeContext& context, const AppTasks& app, const AppData& data)
+    -> void {
+    auto& profiler = context.profiler;
+    const auto generation = context.generation;
+    const auto app_name = app.app_name;
+    const auto output_dirs = app.output_dirs;
+    const auto& compiled_shaders = data.shaders;
+    const auto& assets = data.assets;
+    const auto& assets_bin = data.assets_bin;
+
     // Log.
-    FB_LOG_INFO("Baking app datas: {}", app_name);
+    FB_LOG_INFO("Writing app datas: {}", app_name);
 
     // Paths.
-    const auto source_dir = std::format("{}/src", FB_BAKER_SOURCE_DIR);
     const auto baked_dir = std::format("{}/src/baked", FB_BAKER_SOURCE_DIR);
     const auto baked_app_dir = std::format("{}/{}", baked_dir, app_name);
-    const auto assets_dir = std::format("{}/src/assets", FB_BAKER_SOURCE_DIR);
     const auto baked_types_hpp_path = std::format("{}/baked_types.hpp", baked_dir);
     const auto baked_hpp_path = std::format("{}/baked.hpp", baked_app_dir);
     const auto baked_cpp_path = std::format("{}/baked.cpp", baked_app_dir);
-    const auto clangformat_exe = std::format("{}/external/clang-format.exe", FB_BAKER_SOURCE_DIR);
-    const auto clangformat_file = std::format("{}/.clang-format", FB_BAKER_SOURCE_DIR);
-
-    // Bake.
-    const auto compiled_shaders = bake_shaders(source_dir, app_shader_tasks);
-    const auto [assets, assets_bin] = bake_assets(assets_dir, app_asset_tasks);
-
-    // Generate.
-    const auto format_transform =
-        [&assets_bin](std::string_view name, float4x4 transform) -> std::string {
-#define SIGN(x) ((x) < 0 ? "-" : "")
-#define VALUE(x) SIGN(x), std::abs(x)
-        return std::format(
-            ".{} = float4x4(\n"
-            "// clang-format off\n"
-            "            // {:.6f}f, {:.6f}f, {:.6f}f, {:.6f}f\n"
-            "            // {:.6f}f, {:.6f}f, {:.6f}f, {:.6f}f\n"
-            "            // {:.6f}f, {:.6f}f, {:.6f}f, {:.6f}f\n"
-            "            // {:.6f}f, {:.6f}f, {:.6f}f, {:.6f}f\n"
-            "            {}0x{:a}f, {}0x{:a}f, {}0x{:a}f, {}0x{:a}f,\n"
-            "            {}0x{:a}f, {}0x{:a}f, {}0x{:a}f, {}0x{:a}f,\n"
-            "            {}0x{:a}f, {}0x{:a}f, {}0x{:a}f, {}0x{:a}f,\n"
-            "            {}0x{:a}f, {}0x{:a}f, {}0x{:a}f, {}0x{:a}f\n"
-            "// clang-format on\n"
-            ")",
-            name,
-            // clang-format off
-            transform[0][0], transform[0][1], transform[0][2], transform[0][3],
-            transform[1][0], transform[1][1], transform[1][2], transform[1][3],
-            transform[2][0], transform[2][1], transform[2][2], transform[2][3],
-            transform[3][0], transform[3][1], transform[3][2], transform[3][3],
-            VALUE(transform[0][0]), VALUE(transform[0][1]), VALUE(transform[0][2]), VALUE(transform[0][3]),
-            VALUE(transform[1][0]), VALUE(transform[1][1]), VALUE(transform[1][2]), VALUE(transform[1][3]),
-            VALUE(transform[2][0]), VALUE(transform[2][1]), VALUE(transform[2][2]), VALUE(transform[2][3]),
-            VALUE(transform[3][0]), VALUE(transform[3][1]), VALUE(transform[3][2]), VALUE(transform[3][3])
-            // clang-format on
-        );
-#undef SIGN
-#undef VALUE
-    };
-    const auto format_named_asset_span =
-        [&assets_bin](std::string_view name, AssetSpan span) -> std::string {
-        const auto bytes = Span(assets_bin.data() + span.offset, span.byte_count);
-        const auto hash = hash128(bytes);
-        return std::format(
-            "// hash: {}\n .{} = transmuted_span<{}>({}, {})",
-            hash,
-            name,
-            span.type,
-            span.offset,
-            span.element_count
-        );
-    };
 
-    std::ostringstream assets_decls;
-    std::ostringstream assets_defns;
+    auto generate_zone = Option<BakeZoneScope>(
+        std::in_place,
+        profiler,
+        "output"sv,
+        std::format("{} generate", app_name)
+    );
+
+    // Generate, already formatted.
+    auto code_assets = std::vector<CodeAsset>();
     for (const auto& asset : assets) {
-        std::visit(
-            overloaded {
-                [&](const AssetCopy& asset) {
-                    assets_decls << std::format("auto {}() const -> Copy;", asset.name);
-                    assets_defns << std::format(
-                        R"(auto Assets::{}() const -> Copy {{
-                            return Copy {{
-                                {},
-                            }};
-                        }})",
-                        asset.name,
-                        format_named_asset_span("data"sv, asset.data)
-                    );
-                },
-                [&](const AssetMesh& asset) {
-                    assets_decls << std::format("auto {}() const -> Mesh;", asset.name);
-                    assets_defns << std::format(
-                        R"(auto Assets::{}() const -> Mesh {{
-                            // vertex_count: {}
-                            // face_count: {}
-                            // submesh_count: {}
-                            return Mesh {{
-                                {},
-                                {},
-                                {},
-                                {},
-                            }};
-                        }})",
-                        asset.name,
-                        asset.vertices.element_count,
-                        asset.indices.element_count / 3,
-                        asset.submeshes.element_count,
-                        format_transform("transform"sv, asset.transform),
-                        format_named_asset_span("vertices"sv, asset.vertices),
-                        format_named_asset_span("indices"sv, asset.indices),
-                        format_named_asset_span("submeshes"sv, asset.submeshes)
-                    );
-                },
-                [&](const AssetTexture& asset) {
-                    FB_ASSERT(asset.format != DXGI_FORMAT_UNKNOWN);
-                    FB_ASSERT(asset.width > 0);
-                    FB_ASSERT(asset.height > 0);
-                    FB_ASSERT(asset.channel_count > 0);
-                    FB_ASSERT(asset.mip_count > 0);
-
-                    assets_decls << std::format("auto {}() const -> Texture;", asset.name);
-
-                    std::ostringstream texture_datas;
-                    for (uint mip = 0; mip < asset.mip_count; ++mip) {
-                        const auto mip_width = std::max(1u, asset.width >> mip);
-                        const auto mip_height = std::max(1u, asset.height >> mip);
-                        const auto span = asset.datas[mip].data;
-                        const auto bytes = Span(assets_bin.data() + span.offset, span.byte_count);
-                        const auto hash = hash128(bytes);
-                        if (mip > 0) {
-                            texture_datas << "\n";
-                        }
-                        texture_datas << std::format(
-                            "    datas[{:2}] = texture_data({:4}, {:7}, {:9}, {:7}); // hash: {}, width: {}, height: {}",
-                            mip,
-                            asset.datas[mip].row_pitch,
-                            asset.datas[mip].slice_pitch,
-                            asset.datas[mip].data.offset,
-                            asset.datas[mip].data.element_count,
-                            hash,
-                            mip_width,
-                            mip_height
-                        );
-                    }
-
-                    assets_defns << std::format(
-                        R"(auto Assets::{}() const -> Texture {{
-                            decltype(Texture::datas) datas = {{}};
-                            // clang-format off
-{}
-                            // clang-format on
-                            return Texture {{
-                                .format = {},
-                                .width = {},
-                                .height = {},
-                                .channel_count = {},
-                                .mip_count = {},
-                                .datas = datas,
-                            }};
-                        }})",
-                        asset.name,
-                        texture_datas.str(),
-                        asset.format,
-                        asset.width,
-                        asset.height,
-                        asset.channel_count,
-                        asset.mip_count
-                    );
-                },
-                [&](const AssetCubeTexture& asset) {
-                    FB_ASSERT(asset.format != DXGI_FORMAT_UNKNOWN);
-                    FB_ASSERT(asset.width > 0);
-                    FB_ASSERT(asset.height > 0);
-                    FB_ASSERT(asset.channel_count > 0);
-                    FB_ASSERT(asset.mip_count > 0);
-
-                    assets_decls << std::format("auto {}() const -> CubeTexture;", asset.name);
-
-                    std::ostringstream texture_datas;
-                    for (uint slice = 0; slice < 6; slice++) {
-                        const auto& slice_datas = asset.datas[slice];
-                        for (uint mip = 0; mip < asset.mip_count; mip++) {
-                            const auto mip_width = std::max(1u, asset.width >> mip);
-                            const auto mip_height = std::max(1u, asset.height >> mip);
-                            const auto span = slice_datas[mip].data;
-                            const auto bytes =
-                                Span(assets_bin.data() + span.offset, span.byte_count);
-                            const auto hash = hash128(bytes);
-                            if (slice > 0 || mip > 0) {
-                                texture_datas << "\n";
-                            }
-                            texture_datas << std::format(
-                                R"(    datas[{}][{:2}] = texture_data({:4}, {:7}, {:9}, {:7}); // hash: {}, width: {}, height: {})",
-                                slice,
-                                mip,
-                                slice_datas[mip].row_pitch,
-                                slice_datas[mip].slice_pitch,
-                                slice_datas[mip].data.offset,
-                                slice_datas[mip].data.element_count,
-                                hash,
-                                mip_width,
-                                mip_height
-                            );
-                        }
-                    }
-
-                    assets_defns << std::format(
-                        R"(auto Assets::{}() const -> CubeTexture {{
-                            decltype(CubeTexture::datas) datas = {{}};
-                            // clang-format off
-{}
-                            // clang-format on
-                            return CubeTexture {{
-                                .format = {},
-                                .width = {},
-                                .height = {},
-                                .channel_count = {},
-                                .mip_count = {},
-                                .datas = datas,
-                            }};
-                        }})",
-                        asset.name,
-                        texture_datas.str(),
-                        asset.format,
-                        asset.width,
-                        asset.height,
-                        asset.channel_count,
-                        asset.mip_count
-                    );
-                },
-                [&](const AssetMaterial& asset) {
-                    assets_decls << std::format("auto {}() const -> Material;", asset.name);
-
-                    std::string_view alpha_mode;
-                    switch (asset.alpha_mode) {
-                        case AssetAlphaMode::Opaque: alpha_mode = "AlphaMode::Opaque"sv; break;
-                        case AssetAlphaMode::Mask: alpha_mode = "AlphaMode::Mask"sv; break;
-                        default: FB_FATAL();
-                    }
-
-                    assets_defns << std::format(
-                        R"(auto Assets::{}() const -> Material {{
-                            return Material {{
-                                .alpha_cutoff = {}f,
-                                .alpha_mode = {},
-                            }};
-                        }})",
-                        asset.name,
-                        asset.alpha_cutoff,
-                        alpha_mode
-                    );
-                },
-                [&](const AssetAnimationMesh& asset) {
-                    assets_decls << std::format("auto {}() const -> AnimationMesh;", asset.name);
-                    assets_defns << std::format(
-                        R"(auto Assets::{}() const -> AnimationMesh {{
-                            // vertex_count: {}
-                            // face_count: {}
-                            // submesh_count: {}
-                            return AnimationMesh {{
-                                {},
-                                .node_count = {},
-                                .joint_count = {},
-                                .duration = {}f,
-                                {},
-                                {},
-                                {},
-                                {},
-                                {},
-                                {},
-                                {},
-                                {},
-                                {},
-                                {},
-                                {},
-                                {},
-                                {},
-                            }};
-                        }})",
-                        asset.name,
-                        asset.skinning_vertices.element_count,
-                        asset.indices.element_count / 3,
-                        asset.submeshes.element_count,
-                        format_transform("transform"sv, asset.transform),
-                        asset.node_count,
-                        asset.joint_count,
-                        asset.duration,
-                        format_named_asset_span("skinning_vertices"sv, asset.skinning_vertices),
-                        format_named_asset_span("indices"sv, asset.indices),
-                        format_named_asset_span("submeshes"sv, asset.submeshes),
-                        format_named_asset_span("joint_nodes"sv, asset.joint_nodes),
-                        format_named_asset_span("joint_inverse_binds"sv, asset.joint_inverse_binds),
-                        format_named_asset_span("node_parents"sv, asset.node_parents),
-                        format_named_asset_span("node_channels"sv, asset.node_channels),
-                        format_named_asset_span(
-                            "node_channels_times_t"sv,
-                            asset.node_channels_times_t
-                        ),
-                        format_named_asset_span(
-                            "node_channels_times_r"sv,
-                            asset.node_channels_times_r
-                        ),
-                        format_named_asset_span(
-                            "node_channels_times_s"sv,
-                            asset.node_channels_times_s
-                        ),
-                        format_named_asset_span(
-                            "node_channels_values_t"sv,
-                            asset.node_channels_values_t
-                        ),
-                        format_named_asset_span(
-                            "node_channels_values_r"sv,
-                            asset.node_channels_values_r
-                        ),
-                        format_named_asset_span(
-                            "node_channels_values_s"sv,
-                            asset.node_channels_values_s
-                        )
-                    );
-                },
-                [&](const AssetFont& asset) {
-                    assets_decls << std::format("auto {}() const -> Font;", asset.name);
-                    assets_defns << std::format(
-                        R"(auto Assets::{}() const -> Font {{
-                            return Font {{
-                                .ascender = {}f,
-                                .descender = {}f,
-                                .space_advance = {}f,
-                                {},
-                            }};
-                        }})",
-                        asset.name,
-                        asset.ascender,
-                        asset.descender,
-                        asset.space_advance,
-                        format_named_asset_span("glyphs"sv, asset.glyphs)
-                    );
-                },
-            },
-            asset
-        );
-        assets_defns << "\n\n";
+        code_assets.push_back({asset_name(asset), ASSET_TYPE_NAMES[asset.index()]});
     }
-
-    std::ostringstream shader_decls;
-    std::ostringstream shader_defns;
-    std::vector<std::byte> shaders_bin;
+    auto shader_names = std::vector<std::string_view>();
     for (const auto& shader : compiled_shaders) {
-        shader_decls << std::format("auto {}() const -> Span<const std::byte>;", shader.name);
-        shader_defns << std::format(
-            R"(
-                // shader_hash: {}
-                {}
-                /* disassembly:{}{}*/
-                auto Shaders::{}() const -> Span<const std::byte> {{
-                    return _file.as_span().subspan({}, {});
-                }}
-            )",
-            shader.hash,
-            shader.counters.to_comment_string(),
-            '\n',
-            shader.disassembly.data(),
-            shader.name,
-            shaders_bin.size(),
-            shader.dxil.size()
-        );
-        shaders_bin.insert(shaders_bin.end(), shader.dxil.begin(), shader.dxil.end());
+        shader_names.push_back(shader.name);
     }
+    const auto baked_types_hpp = emit_baked_types_hpp();
+    const auto baked_hpp = emit_baked_hpp(app_name, code_assets, shader_names);
+    const auto baked_cpp = emit_baked_cpp(app_name);
+    generate_zone->set_byte_count(
+        baked_types_hpp.str().size() + baked_hpp.str().size() + baked_cpp.str().size()
+    );
+    generate_zone.reset();
 
-    // Hash.
-    const auto assets_bin_hash = hash128(assets_bin);
-    const auto shaders_bin_hash = hash128(shaders_bin);
-
-    // clang-format off
-    auto baked_types_hpp = std::string(BAKED_TYPES_HPP);
-    auto baked_hpp = std::string(BAKED_HPP);
-    auto baked_cpp = std::string(BAKED_CPP);
-    baked_types_hpp = str_replace(baked_types_hpp, "{{max_mip_count}}", std::format("{}", MAX_MIP_COUNT));
-    baked_hpp = str_replace(baked_hpp, "{{app_name}}", app_name);
-    baked_hpp = str_replace(baked_hpp, "{{asset_decls}}", assets_decls.str());
-    baked_hpp = str_replace(baked_hpp, "{{shader_decls}}", shader_decls.str());
-    baked_cpp = str_replace(baked_cpp, "{{app_name}}", app_name);
-    baked_cpp = str_replace(baked_cpp, "{{assets_bin_hash}}", std::format("{}", assets_bin_hash));
-    baked_cpp = str_replace(baked_cpp, "{{shaders_bin_hash}}", std::format("{}", shaders_bin_hash));
-    baked_cpp = str_replace(baked_cpp, "{{asset_defns}}", assets_defns.str());
-    baked_cpp = str_replace(baked_cpp, "{{assets_byte_count}}", std::to_string(assets_bin.size()));
-    baked_cpp = str_replace(baked_cpp, "{{shader_defns}}", shader_defns.str());
-    baked_cpp = str_replace(baked_cpp, "{{shaders_byte_count}}", std::to_string(shaders_bin.size()));
-    // clang-format on
-
-    // Write temp source files.
-    auto baked_types_hpp_bytes = std::as_bytes(Span(baked_types_hpp));
-    auto baked_hpp_bytes = std::as_bytes(Span(baked_hpp));
-    auto baked_cpp_bytes = std::as_bytes(Span(baked_cpp));
+    // Write the sources that changed, compared by hash.
+    auto write_zone = Option<BakeZoneScope>(
+        std::in_place,
+        profiler,
+        "output"sv,
+        std::format("{} sources", app_name)
+    );
     create_directories(baked_app_dir);
-    auto baked_types_hpp_temp_path = create_temp_path();
-    auto baked_hpp_temp_path = create_temp_path();
-    auto baked_cpp_temp_path = create_temp_path();
-    write_whole_file(baked_types_hpp_temp_path, baked_types_hpp_bytes);
-    write_whole_file(baked_hpp_temp_path, baked_hpp_bytes);
-    write_whole_file(baked_cpp_temp_path, baked_cpp_bytes);
-
-    // Format source files.
-    const auto clangformat_cmd = std::format(
-        "{} -style=file:{} -i {} -i {} -i {}",
-        clangformat_exe,
-        clangformat_file,
-        baked_types_hpp_temp_path,
-        baked_hpp_temp_path,
-        baked_cpp_temp_path
+    auto& hashes = context.output_hashes;
+    const auto baked_types_hpp_written =
+        hashes.write(baked_types_hpp_path, baked_types_hpp.bytes(), baked_types_hpp.hash());
+    const auto baked_hpp_written =
+        hashes.write(baked_hpp_path, baked_hpp.bytes(), baked_hpp.hash());
+    const auto baked_cpp_written =
+        hashes.write(baked_cpp_path, baked_cpp.bytes(), baked_cpp.hash());
+    FB_LOG_INFO("Written: ");
+    FB_LOG_INFO("  {} - {}", baked_types_hpp_path, baked_types_hpp_written);
+    FB_LOG_INFO("  {} - {}", baked_hpp_path, baked_hpp_written);
+    FB_LOG_INFO("  {} - {}", baked_cpp_path, baked_cpp_written);
+    if (generation > 0 && (baked_types_hpp_written || baked_hpp_written || baked_cpp_written)) {
+        FB_LOG_WARN("Generated code changed, {} needs a rebuild to reload its bins", app_name);
+    }
+    write_zone.reset();
+
+    // Bins. The assets bin was streamed next to its first output, and its
+    // table of contents completes it.
+    auto bins_zone = BakeZoneScope(profiler, "output"sv, std::format("{} bins", app_name));
+    const auto asset_tasks = baked_task_entries(
+        asset_task_keys(app.asset_tasks),
+        assets_bin.task_asset_counts
+    );
+    const auto shader_tasks = baked_task_entries(
+        shader_task_keys(app.shader_tasks),
+        shader_task_counts(app.shader_tasks)
     );
-    const auto clangformat_result = std::system(clangformat_cmd.c_str());
-    FB_ASSERT_MSG(clangformat_result == 0, "Failed to format source files");
-
-    // Move source files and cleanup.
-    const auto baked_types_hpp_moved =
-        move_file_if_different(baked_types_hpp_path, baked_types_hpp_temp_path);
-    const auto baked_hpp_moved = move_file_if_different(baked_hpp_path, baked_hpp_temp_path);
-    const auto baked_cpp_moved = move_file_if_different(baked_cpp_path, baked_cpp_temp_path);
-    FB_LOG_INFO("Moved: ");
-    FB_LOG_INFO("  {} - {}", baked_types_hpp_path, baked_types_hpp_moved);
-    FB_LOG_INFO("  {} - {}", baked_hpp_path, baked_hpp_moved);
-    FB_LOG_INFO("  {} - {}", baked_cpp_path, baked_cpp_moved);
-    delete_file(baked_types_hpp_temp_path);
-    delete_file(baked_hpp_temp_path);
-    delete_file(baked_cpp_temp_path);
-
-    // Write binary files.
-    for (const auto& output_dir : output_dirs) {
+    const auto assets_toc =
+        baked_assets_toc(assets, asset_tasks, assets_bin.byte_count, generation);
+    auto& assets_bin_writer = *data.assets_bin_writer;
+    assets_bin_writer.write(assets_toc);
+    assets_bin_writer.close();
+    const auto assets_bin_byte_count = assets_bin_writer.byte_count();
+    const auto assets_bin_hash = assets_bin_writer.hash();
+    const auto shaders_bin = baked_shaders_bin(compiled_shaders, shader_tasks, generation);
+    const auto shaders_bin_hash = hash128(shaders_bin);
+
+    // Write binary files that changed, into the first output directory, and
+    // link them into the others.
+    const auto written_byte_count = hashes.written_byte_count();
+    auto first_assets_bin_file = std::string();
+    auto first_shaders_bin_file = std::string();
+    FB_LOG_INFO("Baked:");
+    for (size_t i = 0; i < output_dirs.size(); i++) {
+        const auto output_dir = output_dirs[i];
         const auto assets_bin_file = std::format("{}/fb_{}_assets.bin", output_dir, app_name);
         const auto shaders_dir = std::format("{}/shaders", output_dir);
         const auto shaders_bin_file = std::format("{}/fb_{}_shaders.bin", output_dir, app_name);
@@ -462,27 +213,405 @@ auto bake_app_datas(
         create_directories(output_dir);
         create_directory(shaders_dir);
 
-        write_whole_file(assets_bin_file, assets_bin);
-        write_whole_file(shaders_bin_file, shaders_bin);
-        for (const auto& shader : compiled_shaders) {
-            const auto pdb_file_path = std::format("{}/{}.pdb", shaders_dir, shader.hash);
-            write_whole_file(pdb_file_path, shader.pdb);
+        auto assets_bin_written = false;
+        auto shaders_bin_written = false;
+        if (i == 0) {
+            assets_bin_written = hashes.publish(
+                assets_bin_file,
+                data.assets_bin_path,
+                assets_bin_byte_count,
+                assets_bin_hash
+            );
+            shaders_bin_written = hashes.write(shaders_bin_file, shaders_bin, shaders_bin_hash);
+            first_assets_bin_file = assets_bin_file;
+            first_shaders_bin_file = shaders_bin_file;
+        } else {
+            assets_bin_written = hashes.link(
+                assets_bin_file,
+                first_assets_bin_file,
+                assets_bin_byte_count,
+                assets_bin_hash
+            );
+            shaders_bin_written = hashes.link(
+                shaders_bin_file,
+                first_shaders_bin_file,
+                shaders_bin.size(),
+                shaders_bin_hash
+            );
         }
 
-        FB_LOG_INFO("Baked:");
         FB_LOG_INFO(
-            "  {} - {:.2f} MiB ({})",
+            "  {} - {:.2f} MiB ({}, toc: {}) - {}",
             assets_bin_file,
-            (double)assets_bin.size() / 1024.0 / 1024.0,
-            assets_bin.size()
+            (double)assets_bin_byte_count / 1024.0 / 1024.0,
+            assets_bin_byte_count,
+            assets_toc.size(),
+            assets_bin_written
         );
         FB_LOG_INFO(
-            "  {} - {:.2f} MiB ({})",
+            "  {} - {:.2f} MiB ({}) - {}",
             shaders_bin_file,
             (double)shaders_bin.size() / 1024.0 / 1024.0,
-            shaders_bin.size()
+            shaders_bin.size(),
+            shaders_bin_written
         );
     }
+    if (output_dirs.empty()) {
+        delete_file(data.assets_bin_path);
+    } else {
+        write_shader_files(hashes, output_dirs, compiled_shaders);
+    }
+    bins_zone.set_byte_count(hashes.written_byte_count() - written_byte_count);
+}
+
+auto bake_app_datas(BakeContext& context, Span<const AppTasks> apps) -> void {
+    // Paths.
+    const auto source_dir = std::format("{}/src", FB_BAKER_SOURCE_DIR);
+    const auto assets_dir = std::format("{}/src/assets", FB_BAKER_SOURCE_DIR);
+
+    // Register every asset task up front, so that the memo keeps outputs shared
+    // by several apps until the last of them took its copy.
+    for (const auto& app : apps) {
+        for (const auto& asset_task : app.asset_tasks) {
+            context.asset_memo.expect(asset_task_params_key(asset_task));
+        }
+    }
+
+    // Bake all apps concurrently. Their tasks share the pool.
+    auto app_datas = std::vector<AppData>(apps.size());
+    context.pool.parallel_for(apps.size(), [&](size_t app_index) {
+        const auto& app = apps[app_index];
+        auto& data = app_datas[app_index];
+        FB_LOG_INFO("Baking app datas: {}", app.app_name);
+        data.shaders = bake_app_shaders(context, source_dir, app.shader_tasks);
+
+        // The assets bin is streamed next to its first output, so that it is
+        // written once, and published with a rename.
+        if (app.output_dirs.empty()) {
+            data.assets_bin_path = create_temp_path();
+        } else {
+            create_directories(app.output_dirs[0]);
+            data.assets_bin_path =
+                std::format("{}/fb_{}_assets.bin.next", app.output_dirs[0], app.app_name);
+        }
+        data.assets_bin_writer = std::make_unique<FileWriter>(data.assets_bin_path);
+        std::tie(data.assets, data.assets_bin) = bake_assets(
+            context.pool,
+            context.profiler,
+            context.asset_cache,
+            context.asset_memo,
+            assets_dir,
+            app.asset_tasks,
+            *data.assets_bin_writer,
+            context.farm
+        );
+    });
+    FB_LOG_INFO("Shared asset tasks: {}", context.asset_memo.reuse_count());
+
+    // Write in declaration order, as apps share output directories and files.
+    auto& hashes = context.output_hashes;
+    const auto written_byte_count = hashes.written_byte_count();
+    const auto linked_byte_count = hashes.linked_byte_count();
+    const auto unchanged_byte_count = hashes.unchanged_byte_count();
+    auto deduplicated_byte_counts = std::vector<size_t>(apps.size());
+    auto padding_byte_counts = std::vector<size_t>(apps.size());
+    auto mesh_stats = std::vector<AssetMeshStats>(apps.size());
+    auto welded_meshes = std::vector<std::tuple<std::string_view, std::string, AssetMeshStats>>();
+    auto compact_meshes = std::vector<std::tuple<std::string_view, std::string, size_t, size_t>>();
+    for (size_t app_index = 0; app_index < apps.size(); app_index++) {
+        const auto& data = app_datas[app_index];
+        write_app_data(context, apps[app_index], data);
+        deduplicated_byte_counts[app_index] = data.assets_bin.deduplicated_byte_count;
+        padding_byte_counts[app_index] = data.assets_bin.padding_byte_count;
+        mesh_stats[app_index] = total_mesh_stats(data.assets);
+        for (const auto& asset : data.assets) {
+            const auto stats = asset_mesh_stats(asset);
+            if (stats.has_value() && stats->vertex_count != stats->source_vertex_count) {
+                welded_meshes.emplace_back(apps[app_index].app_name, asset_name(asset), *stats);
+            }
+            const auto [vertex_byte_count, compact_byte_count] = std::visit(
+                overloaded {
+                    [](const AssetMesh& a) {
+                        return std::tuple(a.vertices.byte_count, a.compact_vertices.byte_count);
+                    },
+                    [](const AssetAnimationMesh& a) {
+                        return std::tuple(
+                            a.skinning_vertices.byte_count,
+                            a.compact_skinning_vertices.byte_count
+                        );
+                    },
+                    [](const auto&) { return std::tuple(size_t(0), size_t(0)); },
+                },
+                asset
+            );
+            if (compact_byte_count > 0) {
+                compact_meshes.emplace_back(
+                    apps[app_index].app_name,
+                    asset_name(asset),
+                    vertex_byte_count,
+                    compact_byte_count
+                );
+            }
+        }
+        app_datas[app_index] = {};
+    }
+    hashes.save();
+
+    // Report.
+    const auto mib = [](uint64_t byte_count) { return (double)byte_count / 1024.0 / 1024.0; };
+    FB_LOG_INFO(
+        "Output bytes: {:.2f} MiB written, {:.2f} MiB linked, {:.2f} MiB unchanged",
+        mib(hashes.written_byte_count() - written_byte_count),
+        mib(hashes.linked_byte_count() - linked_byte_count),
+        mib(hashes.unchanged_byte_count() - unchanged_byte_count)
+    );
+    FB_LOG_INFO("Deduplicated asset bytes:");
+    for (size_t app_index = 0; app_index < apps.size(); app_index++) {
+        FB_LOG_INFO(
+            "  {} - {:.2f} MiB ({})",
+            apps[app_index].app_name,
+            (double)deduplicated_byte_counts[app_index] / 1024.0 / 1024.0,
+            deduplicated_byte_counts[app_index]
+        );
+    }
+    FB_LOG_INFO("Asset alignment padding:");
+    for (size_t app_index = 0; app_index < apps.size(); app_index++) {
+        FB_LOG_INFO(
+            "  {} - {:.2f} KiB ({})",
+            apps[app_index].app_name,
+            (double)padding_byte_counts[app_index] / 1024.0,
+            padding_byte_counts[app_index]
+        );
+    }
+    FB_LOG_INFO("Mesh vertex cache, source -> baked:");
+    for (size_t app_index = 0; app_index < apps.size(); app_index++) {
+        const auto& stats = mesh_stats[app_index];
+        const auto per = [](uint miss_count, uint count) {
+            return count > 0 ? (double)miss_count / (double)count : 0.0;
+        };
+        FB_LOG_INFO(
+            "  {} - ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}",
+            apps[app_index].app_name,
+            per(stats.source_miss_count, stats.triangle_count),
+            per(stats.miss_count, stats.triangle_count),
+            per(stats.source_miss_count, stats.vertex_count),
+            per(stats.miss_count, stats.vertex_count)
+        );
+    }
+    FB_LOG_INFO("Welded mesh vertices, source -> baked:");
+    for (const auto& [app_name, mesh_name, stats] : welded_meshes) {
+        FB_LOG_INFO(
+            "  {} - {} - {} -> {} ({:+.1f}%)",
+            app_name,
+            mesh_name,
+            stats.source_vertex_count,
+            stats.vertex_count,
+            100.0 * ((double)stats.vertex_count / (double)stats.source_vertex_count - 1.0)
+        );
+    }
+    FB_LOG_INFO("Compact mesh vertices, full -> compact:");
+    for (const auto& [app_name, mesh_name, byte_count, compact_byte_count] : compact_meshes) {
+        FB_LOG_INFO(
+            "  {} - {} - {:.1f} KiB -> {:.1f} KiB ({:.1f}x)",
+            app_name,
+            mesh_name,
+            (double)byte_count / 1024.0,
+            (double)compact_byte_count / 1024.0,
+            (double)byte_count / (double)compact_byte_count
+        );
+    }
+
+    // Profile, once per output directory.
+    auto profile_dirs = std::vector<std::string_view>();
+    for (const auto& app : apps) {
+        for (const auto& output_dir : app.output_dirs) {
+            if (std::find(profile_dirs.begin(), profile_dirs.end(), output_dir)
+                == profile_dirs.end()) {
+                profile_dirs.push_back(output_dir);
+            }
+        }
+    }
+    for (const auto& profile_dir : profile_dirs) {
+        context.profiler.write_reports(profile_dir);
+        FB_LOG_INFO("Profile: {}/fb_bake_profile.txt", profile_dir);
+    }
+}
+
+// Splices the selected tasks of one app into its bins, in every output
+// directory. Returns false, without touching any bin, if one can't take it.
+static auto splice_app_data(
+    BakeContext& context,
+    std::string_view source_dir,
+    std::string_view assets_dir,
+    const AppTasks& app,
+    const BakeFilter& filter
+) -> bool {
+    // Selected tasks.
+    auto asset_task_indices = std::vector<size_t>();
+    auto asset_tasks = std::vector<AssetTask>();
+    for (size_t i = 0; filter.assets && i < app.asset_tasks.size(); i++) {
+        if (glob_match(filter.task_glob, asset_task_label(app.asset_tasks[i]))) {
+            asset_task_indices.push_back(i);
+            asset_tasks.push_back(app.asset_tasks[i]);
+        }
+    }
+    auto shader_task_indices = std::vector<size_t>();
+    auto shader_tasks = std::vector<ShaderTask>();
+    for (size_t i = 0; filter.shaders && i < app.shader_tasks.size(); i++) {
+        if (glob_match(filter.task_glob, app.shader_tasks[i].name)) {
+            shader_task_indices.push_back(i);
+            shader_tasks.push_back(app.shader_tasks[i]);
+        }
+    }
+    FB_LOG_INFO(
+        "Splicing app datas: {} ({} asset tasks, {} shader tasks)",
+        app.app_name,
+        asset_tasks.size(),
+        shader_tasks.size()
+    );
+    if (asset_tasks.empty() && shader_tasks.empty()) {
+        return true;
+    }
+
+    // Tables of contents of the bins to splice into, in the first output
+    // directory, which the others link to.
+    if (app.output_dirs.empty()) {
+        return true;
+    }
+    struct Bin {
+        std::string file_name;
+        std::vector<std::byte> toc;
+        BakedBinSplice splice;
+    };
+    auto bins = std::vector<Bin>();
+    const auto& first_output_dir = app.output_dirs[0];
+    const auto assets_bin_file_name = std::format("fb_{}_assets.bin", app.app_name);
+    const auto shaders_bin_file_name = std::format("fb_{}_shaders.bin", app.app_name);
+    if (!asset_tasks.empty()) {
+        const auto path = std::format("{}/{}", first_output_dir, assets_bin_file_name);
+        auto toc = read_baked_bin_toc(path, ASSETS_BIN_MAGIC);
+        if (!toc.has_value()) {
+            return false;
+        }
+        bins.push_back({.file_name = assets_bin_file_name, .toc = std::move(toc.value())});
+    }
+    if (!shader_tasks.empty()) {
+        const auto path = std::format("{}/{}", first_output_dir, shaders_bin_file_name);
+        auto toc = read_baked_bin_toc(path, SHADERS_BIN_MAGIC);
+        if (!toc.has_value()) {
+            return false;
+        }
+        bins.push_back({.file_name = shaders_bin_file_name, .toc = std::move(toc.value())});
+    }
+
+    // Bake. Assets are streamed to a temporary file, which the spliced bin
+    // copies.
+    const auto shaders = bake_app_shaders(context, source_dir, shader_tasks);
+    auto assets = std::vector<Asset>();
+    auto assets_data_path = std::string();
+    auto assets_data_byte_count = size_t(0);
+    auto task_asset_counts = std::vector<uint>();
+    if (!asset_tasks.empty()) {
+        assets_data_path = create_temp_path();
+        auto assets_data_writer = FileWriter(assets_data_path);
+        auto [baked_assets, assets_bin] = bake_assets(
+            context.pool,
+            context.profiler,
+            context.asset_cache,
+            context.asset_memo,
+            assets_dir,
+            asset_tasks,
+            assets_data_writer,
+            context.farm
+        );
+        assets_data_writer.close();
+        assets = std::move(baked_assets);
+        assets_data_byte_count = assets_bin.byte_count;
+        task_asset_counts = std::move(assets_bin.task_asset_counts);
+    }
+
+    // Splice every bin before writing any.
+    const auto all_asset_task_keys = asset_task_keys(app.asset_tasks);
+    const auto all_shader_task_keys = shader_task_keys(app.shader_tasks);
+    const auto shader_counts = shader_task_counts(shader_tasks);
+    for (auto& bin : bins) {
+        const auto magic = baked_bin_header(bin.toc).magic;
+        auto splice = magic == ASSETS_BIN_MAGIC
+            ? splice_baked_assets(
+                  bin.toc,
+                  all_asset_task_keys,
+                  asset_task_indices,
+                  task_asset_counts,
+                  assets,
+                  assets_data_byte_count
+              )
+            : splice_baked_shaders(
+                  bin.toc,
+                  all_shader_task_keys,
+                  shader_task_indices,
+                  shader_counts,
+                  shaders
+              );
+        if (!splice.has_value()) {
+            delete_file(assets_data_path);
+            return false;
+        }
+        bin.splice = std::move(splice.value());
+    }
+
+    // Write the spliced versions next to the bins, publish them with a rename,
+    // and link them into the other output directories. Published bins are
+    // never written to, as they may be linked, or mapped by a running app.
+    auto& hashes = context.output_hashes;
+    for (const auto& bin : bins) {
+        const auto path = std::format("{}/{}", first_output_dir, bin.file_name);
+        const auto next_path = std::format("{}.next", path);
+        const auto data_path = baked_bin_header(bin.toc).magic == ASSETS_BIN_MAGIC
+            ? std::string_view(assets_data_path)
+            : std::string_view();
+        auto writer = FileWriter(next_path);
+        write_baked_bin_splice(writer, path, bin.splice, data_path);
+        writer.close();
+        hashes.publish(path, next_path, writer.byte_count(), writer.hash());
+        for (size_t i = 1; i < app.output_dirs.size(); i++) {
+            const auto& output_dir = app.output_dirs[i];
+            create_directories(output_dir);
+            hashes.link(
+                std::format("{}/{}", output_dir, bin.file_name),
+                path,
+                writer.byte_count(),
+                writer.hash()
+            );
+        }
+        const auto appended_byte_count = writer.byte_count() - bin.splice.end_offset;
+        FB_LOG_INFO(
+            "  {} - {:.2f} KiB appended ({})",
+            path,
+            (double)appended_byte_count / 1024.0,
+            appended_byte_count
+        );
+    }
+    delete_file(assets_data_path);
+    write_shader_files(hashes, app.output_dirs, shaders);
+    return true;
+}
+
+auto splice_app_datas(BakeContext& context, Span<const AppTasks> apps, const BakeFilter& filter)
+    -> void {
+    // Paths.
+    const auto source_dir = std::format("{}/src", FB_BAKER_SOURCE_DIR);
+    const auto assets_dir = std::format("{}/src/assets", FB_BAKER_SOURCE_DIR);
+
+    auto whole_apps = std::vector<AppTasks>();
+    for (const auto& app : apps) {
+        if (!splice_app_data(context, source_dir, assets_dir, app, filter)) {
+            FB_LOG_WARN("Can't splice into the bins of {}, baking it whole", app.app_name);
+            whole_apps.push_back(app);
+        }
+    }
+    if (!whole_apps.empty()) {
+        bake_app_datas(context, whole_apps);
+    }
 }
 
 } // namespace fb
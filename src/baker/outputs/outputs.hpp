@@ -1,16 +1,64 @@
 #pragma once
 
+#include "../assets/cache.hpp"
 #include "../assets/tasks.hpp"
 #include "../assets/types.hpp"
+#include "../farm/farm.hpp"
 #include "../shaders/shaders.hpp"
+#include "output_hashes.hpp"
 
 namespace fb {
 
-auto bake_app_datas(
-    Span<const std::string_view> output_dirs,
-    std::string_view app_name,
-    Span<const AssetTask> app_asset_tasks,
-    Span<const ShaderTask> app_shader_tasks
-) -> void;
+// State shared by all apps of one bake. Without a farm, everything bakes in
+// this process. Output hashes tell which outputs changed since the last bake.
+// The generation is stamped into the bins.
+struct BakeContext {
+    ThreadPool& pool;
+    BakeProfiler& profiler;
+    ShaderSourceCache& shader_sources;
+    ShaderCache& shader_cache;
+    AssetCache& asset_cache;
+    AssetTaskMemo& asset_memo;
+    OutputHashes& output_hashes;
+    BakeFarm* farm = nullptr;
+    uint64_t generation = 0;
+};
+
+struct AppTasks {
+    std::string_view app_name;
+    Span<const std::string_view> output_dirs;
+    Span<const AssetTask> asset_tasks;
+    Span<const ShaderTask> shader_tasks;
+};
+
+// Part of a bake: apps by name, and their tasks by a glob of task names, with
+// `*` and `?`, among shaders, assets or both. Empty names and glob select all.
+struct BakeFilter {
+    std::vector<std::string_view> app_names;
+    std::string_view task_glob;
+    bool shaders = true;
+    bool assets = true;
+
+    auto selects_app(std::string_view app_name) const -> bool {
+        return app_names.empty()
+            || std::find(app_names.begin(), app_names.end(), app_name) != app_names.end();
+    }
+
+    auto selects_all_tasks() const -> bool { return task_glob.empty() && shaders && assets; }
+};
+
+// Bakes all apps concurrently, with asset tasks shared by several apps baked
+// once, then generates and writes the outputs of each app. Only outputs that
+// changed are written, once, and linked into further output directories. The
+// profile of the bake is written next to the outputs.
+auto bake_app_datas(BakeContext& context, Span<const AppTasks> apps) -> void;
+
+// Bakes only the tasks selected by `filter`, and splices them into the bins
+// of the last bake, which keeps everything else in place. The generated code
+// isn't touched, so this takes tasks that bake the same assets as before,
+// and the same tasks as the bins were baked from. Apps where that doesn't
+// hold are baked whole.
+auto splice_app_datas(BakeContext& context, Span<const AppTasks> apps, const BakeFilter& filter)
+    -> void;
 
 } // namespace fb
@@ -1,28 +1,42 @@
 inline constexpr std::string_view BAKED_CPP = R"(#include "baked.hpp"
 
-    namespace fb::baked::{{app_name}} {
-
-    #define texture_data(rp, sp, off, sz) TextureData { .row_pitch = rp, .slice_pitch = sp, .data = transmuted_span<std::byte>(off, sz) }
-
-    auto Assets::load() -> void {
-        // hash: {{assets_bin_hash}}
-        FB_PERF_FUNC();
-        _file = FileBuffer::from_path("fb_{{app_name}}_assets.bin");
-        FB_ASSERT(_file.byte_count() == {{assets_byte_count}});
+namespace fb::baked::{{app_name}} {
+
+auto Assets::load() -> void {
+    FB_PERF_FUNC();
+    _file.load("fb_{{app_name}}_assets.bin", ASSET_COUNT);
+}
+
+auto Assets::reload() -> Option<std::vector<AssetId>> {
+    FB_PERF_FUNC();
+    const auto changed_ids = _file.reload("fb_{{app_name}}_assets.bin");
+    if (!changed_ids.has_value()) {
+        return std::nullopt;
     }
-
-    {{asset_defns}}
-
-    auto Shaders::load() -> void {
-        // hash: {{shaders_bin_hash}}
-        FB_PERF_FUNC();
-        _file = FileBuffer::from_path("fb_{{app_name}}_shaders.bin");
-        FB_ASSERT(_file.byte_count() == {{shaders_byte_count}});
+    auto ids = std::vector<AssetId>();
+    for (const auto id : changed_ids.value()) {
+        ids.push_back((AssetId)id);
     }
+    return ids;
+}
+
+auto Shaders::load() -> void {
+    FB_PERF_FUNC();
+    _file.load("fb_{{app_name}}_shaders.bin", SHADER_COUNT);
+}
+
+auto Shaders::reload() -> Option<std::vector<ShaderId>> {
+    FB_PERF_FUNC();
+    const auto changed_ids = _file.reload("fb_{{app_name}}_shaders.bin");
+    if (!changed_ids.has_value()) {
+        return std::nullopt;
+    }
+    auto ids = std::vector<ShaderId>();
+    for (const auto id : changed_ids.value()) {
+        ids.push_back((ShaderId)id);
+    }
+    return ids;
+}
 
-    {{shader_defns}}
-
-    #undef texture_data
-
-    } // namespace fb::baked::{{app_name}}
+} // namespace fb::baked::{{app_name}}
 )"sv;
@@ -0,0 +1,186 @@
+#include "watch.hpp"
+#include "../assets/cache.hpp"
+
+#include <filesystem>
+#include <thread>
+
+namespace fb {
+
+inline constexpr auto HLSL_EXTENSIONS = std::to_array<std::string_view>({".hlsl", ".hlsli"});
+
+//
+// File snapshots.
+//
+
+auto FileSnapshot::capture(std::string_view dir, Span<const std::string_view> extensions)
+    -> FileSnapshot {
+    namespace fs = std::filesystem;
+
+    // Files can be deleted while iterating, which only drops them from the
+    // snapshot, so errors are skipped rather than asserted.
+    auto snapshot = FileSnapshot();
+    const auto root = fs::path(dir);
+    auto error = std::error_code();
+    auto it = fs::recursive_directory_iterator(root, error);
+    for (; !error && it != fs::recursive_directory_iterator(); it.increment(error)) {
+        const auto& entry = *it;
+        if (!entry.is_regular_file(error)) {
+            continue;
+        }
+        if (!extensions.empty()) {
+            const auto extension = entry.path().extension().string();
+            if (std::find(extensions.begin(), extensions.end(), extension) == extensions.end()) {
+                continue;
+            }
+        }
+        const auto byte_count = entry.file_size(error);
+        const auto write_time = entry.last_write_time(error);
+        if (error) {
+            error.clear();
+            continue;
+        }
+        snapshot._files.emplace(
+            entry.path().lexically_relative(root).generic_string(),
+            FileState {
+                .byte_count = byte_count,
+                .write_time = (int64_t)write_time.time_since_epoch().count(),
+            }
+        );
+    }
+    return snapshot;
+}
+
+auto FileSnapshot::changed_paths(const FileSnapshot& older) const -> std::vector<std::string> {
+    auto paths = std::vector<std::string>();
+    for (const auto& [path, state] : _files) {
+        const auto it = older._files.find(path);
+        if (it == older._files.end() || it->second != state) {
+            paths.push_back(path);
+        }
+    }
+    for (const auto& [path, state] : older._files) {
+        if (!_files.contains(path)) {
+            paths.push_back(path);
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+//
+// Watcher.
+//
+
+BakeWatcher::BakeWatcher(
+    std::string_view source_dir,
+    std::string_view assets_dir,
+    Span<const AppTasks> apps
+)
+    : _source_dir(source_dir)
+    , _assets_dir(assets_dir)
+    , _apps(apps)
+    , _shaders(FileSnapshot::capture(source_dir, HLSL_EXTENSIONS))
+    , _assets(FileSnapshot::capture(assets_dir)) {}
+
+auto BakeWatcher::poll() -> std::vector<size_t> {
+    auto shaders = FileSnapshot::capture(_source_dir, HLSL_EXTENSIONS);
+    auto assets = FileSnapshot::capture(_assets_dir);
+    const auto changed_shader_paths = shaders.changed_paths(_shaders);
+    const auto changed_asset_paths = assets.changed_paths(_assets);
+    _shaders = std::move(shaders);
+    _assets = std::move(assets);
+
+    auto app_indices = std::vector<size_t>();
+    for (size_t app_index = 0; app_index < _apps.size(); app_index++) {
+        const auto& app = _apps[app_index];
+        auto affected = !changed_shader_paths.empty() && !app.shader_tasks.empty();
+        for (const auto& asset_task : app.asset_tasks) {
+            if (affected) {
+                break;
+            }
+            for (const auto input_path : asset_task_input_paths(asset_task)) {
+                if (std::binary_search(
+                        changed_asset_paths.begin(),
+                        changed_asset_paths.end(),
+                        input_path
+                    )) {
+                    affected = true;
+                    break;
+                }
+            }
+        }
+        if (affected) {
+            app_indices.push_back(app_index);
+        }
+    }
+    return app_indices;
+}
+
+//
+// Watch.
+//
+
+auto watch_app_datas(
+    BakeContext& context,
+    Span<const AppTasks> apps,
+    double poll_interval,
+    const std::function<bool()>& stop
+) -> void {
+    // Paths.
+    const auto source_dir = std::format("{}/src", FB_BAKER_SOURCE_DIR);
+    const auto assets_dir = std::format("{}/src/assets", FB_BAKER_SOURCE_DIR);
+
+    auto watcher = BakeWatcher(source_dir, assets_dir, apps);
+    const auto sleep = [&]() {
+        std::this_thread::sleep_for(std::chrono::duration<double>(poll_interval));
+    };
+    FB_LOG_INFO("Watching: {}", source_dir);
+    while (!stop()) {
+        sleep();
+        auto app_indices = watcher.poll();
+        if (app_indices.empty()) {
+            continue;
+        }
+
+        // Editors save in several writes, so wait for a quiet poll.
+        for (;;) {
+            sleep();
+            const auto more = watcher.poll();
+            if (more.empty()) {
+                break;
+            }
+            app_indices.insert(app_indices.end(), more.begin(), more.end());
+        }
+        std::sort(app_indices.begin(), app_indices.end());
+        app_indices.erase(std::unique(app_indices.begin(), app_indices.end()), app_indices.end());
+
+        // Rebake. Sources are read again, and the profile covers this bake only.
+        const auto timer = Instant();
+        auto affected_apps = std::vector<AppTasks>();
+        for (const auto app_index : app_indices) {
+            affected_apps.push_back(apps[app_index]);
+        }
+        auto profiler = BakeProfiler();
+        auto shader_sources = ShaderSourceCache();
+        auto rebake_context = BakeContext {
+            .pool = context.pool,
+            .profiler = profiler,
+            .shader_sources = shader_sources,
+            .shader_cache = context.shader_cache,
+            .asset_cache = context.asset_cache,
+            .asset_memo = context.asset_memo,
+            .output_hashes = context.output_hashes,
+            .farm = context.farm,
+            .generation = ++context.generation,
+        };
+        bake_app_datas(rebake_context, affected_apps);
+        FB_LOG_INFO(
+            "Published generation {} of {} apps in {:.3f} s",
+            rebake_context.generation,
+            affected_apps.size(),
+            timer.elapsed_time()
+        );
+    }
+}
+
+} // namespace fb
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "outputs.hpp"
+
+#include <functional>
+
+namespace fb {
+
+// Sizes and write times of the files under a directory, keyed by their path
+// relative to it, with forward slashes. With extensions, only files with one
+// of them are captured.
+class FileSnapshot {
+public:
+    static auto capture(std::string_view dir, Span<const std::string_view> extensions = {})
+        -> FileSnapshot;
+
+    // Paths added, removed or modified since `older`, sorted.
+    auto changed_paths(const FileSnapshot& older) const -> std::vector<std::string>;
+
+private:
+    struct FileState {
+        uint64_t byte_count;
+        int64_t write_time;
+
+        auto operator==(const FileState&) const -> bool = default;
+    };
+
+    std::unordered_map<std::string, FileState> _files;
+};
+
+// Tells which apps a change to their inputs affects. Asset tasks are affected
+// by the files they read. The include closures of shaders are only known to
+// the shader cache, so any HLSL change affects every app with shaders, and
+// the cache recompiles the shaders that depend on it.
+class BakeWatcher {
+public:
+    BakeWatcher(
+        std::string_view source_dir,
+        std::string_view assets_dir,
+        Span<const AppTasks> apps
+    );
+
+    // Indices of the apps affected by changes since the last poll, sorted.
+    auto poll() -> std::vector<size_t>;
+
+private:
+    std::string _source_dir;
+    std::string _assets_dir;
+    Span<const AppTasks> _apps;
+    FileSnapshot _shaders;
+    FileSnapshot _assets;
+};
+
+inline constexpr double BAKE_WATCH_POLL_INTERVAL = 0.5;
+
+// Rebakes the affected apps on every change to the inputs, polling every
+// `poll_interval` seconds until `stop` returns true. Once files stopped
+// changing, affected apps bake with the caches and memo of `context`, so only
+// the affected tasks miss, and their bins are published with the next
+// generation, for apps to reload.
+auto watch_app_datas(
+    BakeContext& context,
+    Span<const AppTasks> apps,
+    double poll_interval,
+    const std::function<bool()>& stop
+) -> void;
+
+} // namespace fb
@@ -52,10 +52,54 @@ static auto shader_type_name(ShaderType type) -> std::string_view {
     }
 }
 
+// Routes DXC's include requests through ShaderDependencies, so that includes
+// are read through the source cache and recorded in the include closure. Lives
+// on the stack for the duration of one compile, hence the no-op ref counting.
+class ShaderIncludeHandler final: public IDxcIncludeHandler {
+public:
+    ShaderIncludeHandler(IDxcUtils* utils, ShaderDependencies& dependencies)
+        : _utils(utils)
+        , _dependencies(dependencies) {}
+
+    HRESULT STDMETHODCALLTYPE LoadSource(LPCWSTR file_name, IDxcBlob** include_source) override {
+        *include_source = nullptr;
+        const auto source = _dependencies.load(from_wstr(file_name));
+        if (!source.has_value()) {
+            return E_FAIL;
+        }
+        ComPtr<IDxcBlobEncoding> blob;
+        const auto hr = _utils->CreateBlobFromPinned(
+            source->data(),
+            (UINT32)source->size(),
+            DXC_CP_ACP,
+            &blob
+        );
+        if (FAILED(hr)) {
+            return hr;
+        }
+        *include_source = blob.detach();
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** object) override {
+        if (riid == __uuidof(IDxcIncludeHandler) || riid == __uuidof(IUnknown)) {
+            *object = this;
+            return S_OK;
+        }
+        *object = nullptr;
+        return E_NOINTERFACE;
+    }
+    ULONG STDMETHODCALLTYPE AddRef() override { return 1; }
+    ULONG STDMETHODCALLTYPE Release() override { return 1; }
+
+private:
+    IDxcUtils* _utils;
+    ShaderDependencies& _dependencies;
+};
+
 ShaderCompiler::ShaderCompiler() {
     DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&_compiler));
     DxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&_utils));
-    _utils->CreateDefaultIncludeHandler(&_include_handler);
 }
 
 static auto
@@ -117,17 +161,13 @@ analyze(std::string_view name, ShaderType shader_type, ComPtr<ID3D12ShaderReflec
     FB_LOG_INFO("");
 }
 
-auto ShaderCompiler::compile(
+auto ShaderCompiler::arguments(
     std::string_view name,
     ShaderType type,
-    std::string_view entry_point,
-    Span<const std::byte> source,
-    bool debug
-) const -> Shader {
-    // Note: remember to set PIX PDB search path correctly for shader debugging to work.
-
+    std::string_view entry_point
+) const -> std::vector<std::wstring> {
     // Shader profile.
-    LPCWSTR shader_profile = nullptr;
+    std::wstring shader_profile;
     // clang-format off
     switch (type) {
         case ShaderType::Compute: shader_profile = L"cs_6_8"; break;
@@ -141,14 +181,14 @@ auto ShaderCompiler::compile(
     std::wstring shader_name = fb::to_wstr(name);
     std::wstring shader_bin = std::format(L"{}.bin", shader_name);
     std::wstring shader_entry = fb::to_wstr(entry_point);
-    auto shader_args = std::to_array<LPCWSTR>({
+    return {
         // clang-format off
-        shader_name.c_str(),
-        L"-E", shader_entry.c_str(),      // Entry point name.
+        shader_name,
+        L"-E", shader_entry,              // Entry point name.
         L"-T", shader_profile,            // Target profile.
         L"-HV", L"202x",                  // HLSL version.
         L"-Zi",                           // Debug information.
-        L"-Fo", shader_bin.c_str(),       // Output object file.
+        L"-Fo", shader_bin,               // Output object file.
         L"-Fd", L".\\shaders\\",          // Write debug information to the given file.
         L"-Wall",                         // Enable all warnings.
         L"-Wextra",                       // Enable extra warnings.
@@ -159,9 +199,32 @@ auto ShaderCompiler::compile(
         L"-enable-16bit-types",           // Enable 16-bit types and disable min precision types.
         L"-I", FB_BAKER_SOURCE_DIR_WIDE "/src",
         // clang-format on
-    });
+    };
+}
+
+auto ShaderCompiler::compile(
+    std::string_view name,
+    ShaderType type,
+    std::string_view entry_point,
+    Span<const std::byte> source,
+    ShaderDependencies& dependencies,
+    bool debug
+) const -> Shader {
+    // Note: remember to set PIX PDB search path correctly for shader debugging to work.
+
+    // Shader arguments.
+    const auto arguments = this->arguments(name, type, entry_point);
+    auto shader_args = std::vector<LPCWSTR>();
+    shader_args.reserve(arguments.size());
+    for (const auto& argument : arguments) {
+        shader_args.push_back(argument.c_str());
+    }
+
+    // Include handler.
+    auto include_handler = ShaderIncludeHandler(_utils.get(), dependencies);
 
     // Compile.
+    FB_BAKE_ZONE("dxc");
     DxcBuffer source_buffer = {
         .Ptr = source.data(),
         .Size = source.size(),
@@ -173,7 +236,7 @@ auto ShaderCompiler::compile(
         &source_buffer,
         shader_args.data(),
         (uint)shader_args.size(),
-        _include_handler.get(),
+        &include_handler,
         IID_PPV_ARGS(&compile_result)
     ));
     FB_ASSERT_HR(compile_result->GetOutput(DXC_OUT_ERRORS, IID_PPV_ARGS(&compile_errors), nullptr));
@@ -308,54 +371,282 @@ static auto make_unique_shader_name(std::string_view name, std::string_view entr
     return std::format("{}_{}", name, entry_point);
 }
 
-auto bake_shaders(std::string_view buffet_dir, Span<const ShaderTask> shader_tasks)
-    -> std::vector<Shader> {
-    const auto compiler = ShaderCompiler();
-    auto compiled_shaders = std::vector<Shader>();
-    auto unique_names = std::unordered_set<std::string>();
+auto shader_entry_points(Span<const ShaderTask> shader_tasks) -> std::vector<ShaderEntryPoint> {
+    auto entry_points = std::vector<ShaderEntryPoint>();
     auto names = UniqueNames();
-
-    size_t shader_entry_point_count = 0;
     for (const auto& shader_task : shader_tasks) {
-        shader_entry_point_count += shader_task.entry_points.size();
-    }
-    size_t shader_entry_point_index = 0;
-
-    FB_LOG_INFO(
-        "Baking {} shader tasks ({} entry points)",
-        shader_tasks.size(),
-        shader_entry_point_count
-    );
-    for (const auto& shader_task : shader_tasks) {
-        const auto hlsl_path = std::format("{}/{}", buffet_dir, shader_task.path);
-        const auto hlsl_file = FileBuffer::from_path(hlsl_path);
-
         for (const auto& entry_point : shader_task.entry_points) {
             // Ensure unique shader names.
-            const auto name = names.unique(make_unique_shader_name(shader_task.name, entry_point));
+            auto name = names.unique(make_unique_shader_name(shader_task.name, entry_point));
 
             // Determine shader type.
             const auto type = shader_type_from_entry_point(entry_point);
             FB_ASSERT(type != ShaderType::Unknown);
 
-            // Compile shader.
-            auto shader = compiler.compile(name, type, entry_point, hlsl_file.as_span(), false);
-
-            // Log.
-            FB_LOG_INFO(
-                "{}/{} - {} - {} instructions",
-                ++shader_entry_point_index,
-                shader_entry_point_count,
-                name,
-                shader.counters.instruction_count
+            entry_points.push_back(
+                ShaderEntryPoint {
+                    .name = std::move(name),
+                    .type = type,
+                    .path = shader_task.path,
+                    .entry_point = entry_point,
+                }
             );
+        }
+    }
+    return entry_points;
+}
+
+auto ShaderSourceCache::insert(std::string path, std::vector<std::byte> source) -> void {
+    std::scoped_lock lock(_mutex);
+    _sources.insert_or_assign(std::move(path), std::move(source));
+}
+
+auto ShaderSourceCache::find(const std::string& path) -> Option<Span<const std::byte>> {
+    std::scoped_lock lock(_mutex);
+    if (const auto it = _sources.find(path); it != _sources.end()) {
+        return it->second;
+    }
+    if (!file_exists(path)) {
+        return std::nullopt;
+    }
+    const auto file = FileBuffer::from_path(path);
+    const auto bytes = file.as_span();
+    const auto it =
+        _sources.emplace(path, std::vector<std::byte>(bytes.begin(), bytes.end())).first;
+    _file_read_count++;
+    return it->second;
+}
 
-            // Save shader.
-            compiled_shaders.push_back(std::move(shader));
+auto ShaderSourceCache::read(const std::string& path) -> Span<const std::byte> {
+    const auto source = find(path);
+    FB_ASSERT_MSG(source.has_value(), "Shader source not found: {}", path);
+    return source.value();
+}
+
+static auto is_absolute_path(std::string_view path) -> bool {
+    return path.starts_with('/') || (path.size() >= 2 && path[1] == ':');
+}
+
+// DXC hands out include paths with mixed separators and "./" segments.
+static auto normalize_path(std::string_view path) -> std::string {
+    auto normalized = std::string(path);
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    while (normalized.starts_with("./")) {
+        normalized.erase(0, 2);
+    }
+    for (auto pos = normalized.find("/./"); pos != std::string::npos;
+         pos = normalized.find("/./")) {
+        normalized.erase(pos, 2);
+    }
+    return normalized;
+}
+
+auto ShaderDependencies::load(std::string_view path) -> Option<Span<const std::byte>> {
+    auto resolved = normalize_path(path);
+    if (!is_absolute_path(resolved)) {
+        resolved = std::format("{}/{}", _source_dir, resolved);
+    }
+    const auto source = _sources.find(resolved);
+    if (source.has_value() && std::find(_paths.begin(), _paths.end(), resolved) == _paths.end()) {
+        _paths.push_back(std::move(resolved));
+    }
+    return source;
+}
+
+// Path relative to `source_dir` when it is under it, unchanged otherwise.
+template<typename Char>
+static auto source_relative_path(
+    std::basic_string_view<Char> path,
+    std::basic_string_view<Char> source_dir
+) -> std::basic_string<Char> {
+    if (path == source_dir) {
+        return std::basic_string<Char>(1, Char('.'));
+    }
+    if (path.starts_with(source_dir) && path.size() > source_dir.size()
+        && path[source_dir.size()] == Char('/')) {
+        return std::basic_string<Char>(path.substr(source_dir.size() + 1));
+    }
+    return std::basic_string<Char>(path);
+}
+
+auto shader_compile_key(
+    std::string_view path,
+    Span<const std::wstring> arguments,
+    std::string_view source_dir
+) -> Hash128 {
+    auto key_bytes = std::vector<std::byte>();
+    auto arc = SerializingArchive(key_bytes);
+    auto version = SHADER_BAKER_VERSION;
+    auto key_path = source_relative_path<char>(path, source_dir);
+    arc & version & key_path;
+    const auto wide_source_dir = to_wstr(source_dir);
+    for (const auto& argument : arguments) {
+        const auto key_argument = source_relative_path<wchar_t>(argument, wide_source_dir);
+        auto argument_size = (uint64_t)key_argument.size();
+        arc & argument_size;
+        archive_trivial_array(arc, key_argument.data(), key_argument.size());
+    }
+    return hash128(key_bytes);
+}
+
+auto shader_task_params_key(const ShaderTask& shader_task) -> Hash128 {
+    auto key_bytes = std::vector<std::byte>();
+    auto arc = SerializingArchive(key_bytes);
+    auto path = std::string(shader_task.path);
+    auto name = std::string(shader_task.name);
+    arc & path & name;
+    for (const auto entry_point : shader_task.entry_points) {
+        auto entry_point_name = std::string(entry_point);
+        arc & entry_point_name;
+    }
+    return hash128(key_bytes);
+}
+
+inline constexpr uint SHADER_CACHE_MAGIC = 0x43534246; // "FBSC"
+
+struct ShaderCacheHeader {
+    uint magic;
+    uint version;
+    uint64_t payload_byte_count;
+    Hash128 payload_hash;
+};
+
+ShaderCache::ShaderCache(std::string_view cache_dir, SharedCacheClient* shared)
+    : _cache_dir(cache_dir)
+    , _shared(shared) {
+    create_directories(_cache_dir);
+}
+
+auto ShaderCache::entry_path(Hash128 key) const -> std::string {
+    return std::format("{}/{}.bin", _cache_dir, key);
+}
+
+auto ShaderCache::prefetch(Span<const Hash128> keys) -> void {
+    if (!enabled() || _shared == nullptr) {
+        return;
+    }
+    auto missing_keys = std::vector<Hash128>();
+    for (const auto key : keys) {
+        if (!file_exists(entry_path(key))) {
+            missing_keys.push_back(key);
         }
     }
+    _shared->prefetch(missing_keys);
+}
 
-    return compiled_shaders;
+auto ShaderCache::load(Hash128 key, ShaderSourceCache& sources, std::string_view source_dir)
+    -> Option<Shader> {
+    if (!enabled()) {
+        return std::nullopt;
+    }
+
+    // Miss, unless the shared cache has the entry.
+    const auto path = entry_path(key);
+    if (!file_exists(path) && (_shared == nullptr || !_shared->fetch_to_file(key, path))) {
+        _miss_count++;
+        return std::nullopt;
+    }
+
+    // Validate.
+    const auto file = FileBuffer::from_path(path);
+    auto arc = DeserializingArchive(file.as_span());
+    auto header = ShaderCacheHeader {};
+    const auto valid = [&]() {
+        if (arc.buf.size() < sizeof(ShaderCacheHeader)) {
+            return false;
+        }
+        arc & header;
+        return header.magic == SHADER_CACHE_MAGIC && header.version == SHADER_BAKER_VERSION
+            && header.payload_byte_count == arc.buf.size()
+            && hash128(arc.buf) == header.payload_hash;
+    }();
+    if (!valid) {
+        FB_LOG_WARN("Ignoring invalid shader cache entry: {}", path);
+        _miss_count++;
+        return std::nullopt;
+    }
+
+    // Every file of the include closure must be unchanged.
+    auto dependency_count = uint64_t(0);
+    arc & dependency_count;
+    for (uint64_t i = 0; i < dependency_count; i++) {
+        auto dependency_path = std::string();
+        auto dependency_hash = Hash128();
+        arc & dependency_path & dependency_hash;
+        if (!is_absolute_path(dependency_path)) {
+            dependency_path = std::format("{}/{}", source_dir, dependency_path);
+        }
+        const auto source = sources.find(dependency_path);
+        if (!source.has_value() || hash128(source.value()) != dependency_hash) {
+            _miss_count++;
+            return std::nullopt;
+        }
+    }
+
+    // Hit.
+    auto shader = Shader();
+    archive(shader, arc);
+    FB_ASSERT(arc.fully_consumed());
+    _hit_count++;
+    return shader;
+}
+
+auto ShaderCache::store(
+    Hash128 key,
+    const Shader& shader,
+    const ShaderDependencies& dependencies,
+    ShaderSourceCache& sources
+) -> void {
+    if (!enabled()) {
+        return;
+    }
+
+    // Serialize.
+    auto file_bytes = std::vector<std::byte>();
+    auto arc = SerializingArchive(file_bytes);
+    auto header = ShaderCacheHeader {};
+    arc & header;
+    auto dependency_count = (uint64_t)dependencies.paths().size();
+    arc & dependency_count;
+    for (const auto& dependency : dependencies.paths()) {
+        auto dependency_path = source_relative_path<char>(dependency, dependencies.source_dir());
+        auto dependency_hash = hash128(sources.read(dependency));
+        arc & dependency_path & dependency_hash;
+    }
+    auto shader_copy = shader; // archive() takes a mutable reference.
+    archive(shader_copy, arc);
+
+    // Patch header.
+    const auto payload = Span<const std::byte>(file_bytes).subspan(sizeof(ShaderCacheHeader));
+    header = ShaderCacheHeader {
+        .magic = SHADER_CACHE_MAGIC,
+        .version = SHADER_BAKER_VERSION,
+        .payload_byte_count = payload.size(),
+        .payload_hash = hash128(payload),
+    };
+    std::memcpy(file_bytes.data(), &header, sizeof(header));
+
+    // Write through a temporary file, so that readers never see partial entries.
+    const auto path = entry_path(key);
+    const auto temp_path = std::format("{}.{}.tmp", path, GetCurrentThreadId());
+    write_whole_file(temp_path, file_bytes);
+    move_file(path, temp_path);
+    if (_shared != nullptr) {
+        _shared->put(key, std::move(file_bytes));
+    }
+}
+
+auto bake_shaders(
+    ThreadPool& pool,
+    BakeProfiler& profiler,
+    ShaderSourceCache& sources,
+    ShaderCache& cache,
+    std::string_view source_dir,
+    Span<const ShaderTask> shader_tasks
+) -> std::vector<Shader> {
+    return compile_shaders(pool, profiler, sources, cache, source_dir, shader_tasks, []() {
+        return ShaderCompiler();
+    });
 }
 
 } // namespace fb
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <common/common.hpp>
+#include "../utils/profiler.hpp"
+#include "../utils/shared_cache.hpp"
+#include "../utils/thread_pool.hpp"
 
 #include <dxcapi.h>
 
@@ -48,32 +51,280 @@ struct Shader {
     ShaderCounters counters;
 };
 
+// Shaders as stored in cache entries, and sent by bake farm workers.
+template<Archive A>
+auto archive(Shader& shader, A& arc) -> void {
+    arc & shader.name & shader.hash & shader.dxil & shader.pdb & shader.disassembly
+        & shader.counters;
+}
+
+// Thread-safe store of HLSL sources, so that every file is read from disk at
+// most once per bake. Returned spans stay valid for the lifetime of the cache.
+class ShaderSourceCache {
+    FB_NO_COPY_MOVE(ShaderSourceCache);
+
+public:
+    ShaderSourceCache() = default;
+
+    auto insert(std::string path, std::vector<std::byte> source) -> void;
+    auto find(const std::string& path) -> Option<Span<const std::byte>>;
+    auto read(const std::string& path) -> Span<const std::byte>;
+    auto file_read_count() const -> uint { return _file_read_count; }
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::vector<std::byte>> _sources;
+    uint _file_read_count = 0;
+};
+
+// Loads the sources of one compile through the source cache, and records every
+// file that was loaded: the main source first, then its include closure.
+// Relative paths are resolved against `source_dir`.
+class ShaderDependencies {
+    FB_NO_COPY_MOVE(ShaderDependencies);
+
+public:
+    ShaderDependencies(ShaderSourceCache& sources, std::string_view source_dir)
+        : _sources(sources)
+        , _source_dir(source_dir) {}
+
+    auto load(std::string_view path) -> Option<Span<const std::byte>>;
+    auto paths() const -> Span<const std::string> { return _paths; }
+    auto source_dir() const -> std::string_view { return _source_dir; }
+
+private:
+    ShaderSourceCache& _sources;
+    std::string_view _source_dir;
+    std::vector<std::string> _paths;
+};
+
 class ShaderCompiler {
 public:
     ShaderCompiler();
 
+    auto arguments(std::string_view name, ShaderType type, std::string_view entry_point) const
+        -> std::vector<std::wstring>;
     auto compile(
         std::string_view name,
         ShaderType type,
         std::string_view entry_point,
         Span<const std::byte> source,
+        ShaderDependencies& dependencies,
         bool debug = false
     ) const -> Shader;
 
 private:
     ComPtr<IDxcCompiler3> _compiler;
     ComPtr<IDxcUtils> _utils;
-    ComPtr<IDxcIncludeHandler> _include_handler;
 };
 
+// Compilers resolve includes through `dependencies`, and report the arguments
+// they compile with, which are part of the cache key.
+template<typename T>
+concept ShaderCompilerBackend = requires(
+    const T& compiler,
+    std::string_view name,
+    ShaderType type,
+    std::string_view entry_point,
+    Span<const std::byte> source,
+    ShaderDependencies& dependencies
+) {
+    { compiler.arguments(name, type, entry_point) } -> std::same_as<std::vector<std::wstring>>;
+    {
+        compiler.compile(name, type, entry_point, source, dependencies, false)
+    } -> std::same_as<Shader>;
+};
+
+static_assert(ShaderCompilerBackend<ShaderCompiler>);
+
 struct ShaderTask {
     std::string_view path;
     std::string_view name;
     std::vector<std::string_view> entry_points;
 };
 
-auto bake_shaders(std::string_view buffet_dir, Span<const ShaderTask> shader_tasks)
-    -> std::vector<Shader>;
+struct ShaderEntryPoint {
+    std::string name;
+    ShaderType type;
+    std::string_view path;
+    std::string_view entry_point;
+};
+
+// Flattens the tasks into uniquely named entry points in declaration order.
+auto shader_entry_points(Span<const ShaderTask> shader_tasks) -> std::vector<ShaderEntryPoint>;
+
+// Bump whenever a change to the baker alters compiled shaders, or the format
+// of shader cache entries.
+inline constexpr uint SHADER_BAKER_VERSION = 2;
+
+// Key of one compile: the baker version, the main source path relative to
+// `source_dir` and the compiler arguments, with paths under `source_dir` made
+// relative, so that checkouts at different paths share entries. Source
+// contents are not part of the key, they are validated against the
+// dependencies recorded in the entry.
+auto shader_compile_key(
+    std::string_view path,
+    Span<const std::wstring> arguments,
+    std::string_view source_dir
+) -> Hash128;
+
+// Key of a task's path, name and entry points, which decide its shaders' ids.
+auto shader_task_params_key(const ShaderTask& shader_task) -> Hash128;
+
+// Persistent on-disk store of compiled shaders, one file per key. Entries
+// record the include closure of their compile with the hash of every file in
+// it, relative to `source_dir` where they are under it, and only hit while all
+// of them are unchanged. A default constructed
+// cache is disabled: it never hits and never writes. With a shared cache,
+// local misses are fetched from it, and stored entries are put to it.
+class ShaderCache {
+    FB_NO_COPY_MOVE(ShaderCache);
+
+public:
+    ShaderCache() = default;
+    explicit ShaderCache(std::string_view cache_dir, SharedCacheClient* shared = nullptr);
+
+    auto enabled() const -> bool { return !_cache_dir.empty(); }
+    auto prefetch(Span<const Hash128> keys) -> void;
+    auto load(Hash128 key, ShaderSourceCache& sources, std::string_view source_dir)
+        -> Option<Shader>;
+    auto store(
+        Hash128 key,
+        const Shader& shader,
+        const ShaderDependencies& dependencies,
+        ShaderSourceCache& sources
+    ) -> void;
+
+    auto hit_count() const -> uint { return _hit_count.load(); }
+    auto miss_count() const -> uint { return _miss_count.load(); }
+
+private:
+    auto entry_path(Hash128 key) const -> std::string;
+
+    std::string _cache_dir;
+    SharedCacheClient* _shared = nullptr;
+    std::atomic<uint> _hit_count = 0;
+    std::atomic<uint> _miss_count = 0;
+};
+
+// Compiles every entry point on the pool and returns the shaders in the same
+// order as `shader_entry_points`. Compilers are not thread-safe, so they are
+// created on demand with `make_compiler` and checked out for one compile at a
+// time, which bounds their number by the pool's thread count. Entry points
+// whose include closure is unchanged are loaded from `cache` instead.
+template<typename MakeCompiler>
+    requires ShaderCompilerBackend<std::invoke_result_t<MakeCompiler>>
+auto compile_shaders(
+    ThreadPool& pool,
+    BakeProfiler& profiler,
+    ShaderSourceCache& sources,
+    ShaderCache& cache,
+    std::string_view source_dir,
+    Span<const ShaderTask> shader_tasks,
+    MakeCompiler make_compiler
+) -> std::vector<Shader> {
+    using Compiler = std::invoke_result_t<MakeCompiler>;
+
+    const auto entry_points = shader_entry_points(shader_tasks);
+    FB_LOG_INFO(
+        "Baking {} shader tasks ({} entry points, {} threads)",
+        shader_tasks.size(),
+        entry_points.size(),
+        pool.thread_count()
+    );
+
+    auto shaders = std::vector<Shader>(entry_points.size());
+    auto compilers = std::vector<std::unique_ptr<Compiler>>();
+    auto compilers_mutex = std::mutex();
+    auto completed_count = std::atomic<size_t>(0);
+
+    // Keys of every entry point up front, so that the shared cache can fetch
+    // entries while shaders compile.
+    auto keys = std::vector<Hash128>(entry_points.size());
+    if (cache.enabled()) {
+        auto compiler = std::make_unique<Compiler>(make_compiler());
+        for (size_t index = 0; index < entry_points.size(); index++) {
+            const auto& entry_point = entry_points[index];
+            const auto arguments =
+                compiler->arguments(entry_point.name, entry_point.type, entry_point.entry_point);
+            keys[index] = shader_compile_key(entry_point.path, arguments, source_dir);
+        }
+        cache.prefetch(keys);
+        compilers.push_back(std::move(compiler));
+    }
+
+    pool.parallel_for(entry_points.size(), [&](size_t index) {
+        const auto& entry_point = entry_points[index];
+        const auto path = std::format("{}/{}", source_dir, entry_point.path);
+        auto zone = BakeZoneScope(profiler, "shader"sv, std::string(entry_point.name));
+
+        // Check out a compiler.
+        auto compiler = std::unique_ptr<Compiler>();
+        {
+            std::scoped_lock lock(compilers_mutex);
+            if (!compilers.empty()) {
+                compiler = std::move(compilers.back());
+                compilers.pop_back();
+            }
+        }
+        if (!compiler) {
+            compiler = std::make_unique<Compiler>(make_compiler());
+        }
+
+        // Cache lookup.
+        auto cached = Option<Shader>();
+        const auto key = keys[index];
+        if (cache.enabled()) {
+            cached = cache.load(key, sources, source_dir);
+        }
+
+        // Compile.
+        if (cached.has_value()) {
+            shaders[index] = std::move(cached.value());
+        } else {
+            auto dependencies = ShaderDependencies(sources, source_dir);
+            const auto source = dependencies.load(entry_point.path);
+            FB_ASSERT_MSG(source.has_value(), "Shader source not found: {}", path);
+            shaders[index] = compiler->compile(
+                entry_point.name,
+                entry_point.type,
+                entry_point.entry_point,
+                source.value(),
+                dependencies,
+                false
+            );
+            cache.store(key, shaders[index], dependencies, sources);
+        }
+        zone.set_byte_count(shaders[index].dxil.size());
+
+        // Return the compiler.
+        {
+            std::scoped_lock lock(compilers_mutex);
+            compilers.push_back(std::move(compiler));
+        }
+
+        // Log.
+        FB_LOG_INFO(
+            "{}/{} - {} - {} - {} instructions",
+            ++completed_count,
+            entry_points.size(),
+            entry_point.name,
+            cached.has_value() ? "hit" : (cache.enabled() ? "miss" : "uncached"),
+            shaders[index].counters.instruction_count
+        );
+    });
+
+    return shaders;
+}
+
+auto bake_shaders(
+    ThreadPool& pool,
+    BakeProfiler& profiler,
+    ShaderSourceCache& sources,
+    ShaderCache& cache,
+    std::string_view source_dir,
+    Span<const ShaderTask> shader_tasks
+) -> std::vector<Shader>;
 
 } // namespace fb
 
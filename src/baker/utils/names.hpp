@@ -23,4 +23,32 @@ private:
     std::unordered_set<std::string> _names;
 };
 
+// Whether `name` matches `pattern`, where `*` matches any run of characters
+// and `?` any one character.
+inline auto glob_match(std::string_view pattern, std::string_view name) -> bool {
+    auto p = size_t(0);
+    auto n = size_t(0);
+    auto star_p = std::string_view::npos;
+    auto star_n = size_t(0);
+    while (n < name.size()) {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+            p++;
+            n++;
+        } else if (p < pattern.size() && pattern[p] == '*') {
+            star_p = p++;
+            star_n = n;
+        } else if (star_p != std::string_view::npos) {
+            // Let the last star match one more character.
+            p = star_p + 1;
+            n = ++star_n;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*') {
+        p++;
+    }
+    return p == pattern.size();
+}
+
 } // namespace fb
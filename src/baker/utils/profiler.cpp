@@ -0,0 +1,155 @@
+#include "profiler.hpp"
+
+#include <nlohmann/json.hpp>
+#include <psapi.h>
+
+#include <map>
+
+namespace fb {
+
+static thread_local BakeZoneScope* t_current_zone = nullptr;
+
+auto BakeProfiler::record(BakeZone zone) -> void {
+    std::scoped_lock lock(_mutex);
+    _zones.push_back(std::move(zone));
+}
+
+auto BakeProfiler::zones() const -> std::vector<BakeZone> {
+    std::scoped_lock lock(_mutex);
+    return _zones;
+}
+
+auto BakeProfiler::peak_memory() const -> size_t {
+    auto counters = PROCESS_MEMORY_COUNTERS {};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return counters.PeakWorkingSetSize;
+}
+
+auto BakeProfiler::summary() const -> std::string {
+    auto zones = this->zones();
+    std::stable_sort(zones.begin(), zones.end(), [](const BakeZone& a, const BakeZone& b) {
+        return a.duration > b.duration;
+    });
+
+    // Process peak.
+    auto summary = std::string();
+    auto out = std::back_inserter(summary);
+    std::format_to(
+        out,
+        "Peak working set: {:.1f} MiB\n",
+        (double)peak_memory() / 1024.0 / 1024.0
+    );
+
+    // Zones, slowest first.
+    std::format_to(out, "Zones by duration:\n");
+    for (const auto& zone : zones) {
+        if (zone.depth > 0) {
+            continue;
+        }
+        std::format_to(
+            out,
+            "  {:9.3f} s {:12} bytes  {:<8} {}\n",
+            zone.duration,
+            zone.byte_count,
+            zone.category,
+            zone.name
+        );
+    }
+
+    // Nested steps, summed by name, slowest first.
+    struct StepTotal {
+        std::string_view name;
+        double duration = 0.0;
+        uint count = 0;
+    };
+    auto step_indices = std::map<std::string_view, size_t>();
+    auto steps = std::vector<StepTotal>();
+    for (const auto& zone : zones) {
+        if (zone.depth == 0) {
+            continue;
+        }
+        const auto [it, inserted] = step_indices.try_emplace(zone.name, steps.size());
+        if (inserted) {
+            steps.push_back({.name = zone.name});
+        }
+        steps[it->second].duration += zone.duration;
+        steps[it->second].count++;
+    }
+    std::stable_sort(steps.begin(), steps.end(), [](const StepTotal& a, const StepTotal& b) {
+        return a.duration > b.duration;
+    });
+    std::format_to(out, "Steps by total duration:\n");
+    for (const auto& step : steps) {
+        std::format_to(out, "  {:9.3f} s {:6}x  {}\n", step.duration, step.count, step.name);
+    }
+
+    return summary;
+}
+
+auto BakeProfiler::chrome_trace() const -> std::string {
+    auto events = json::array();
+    for (const auto& zone : zones()) {
+        events.push_back({
+            {"name", zone.name},
+            {"cat", zone.category},
+            {"ph", "X"},
+            {"ts", zone.start_time * 1e6},
+            {"dur", zone.duration * 1e6},
+            {"pid", 0},
+            {"tid", zone.thread_id},
+            {"args", {{"bytes", zone.byte_count}}},
+        });
+    }
+    const auto trace = json {
+        {"traceEvents", std::move(events)},
+        {"displayTimeUnit", "ms"},
+        {"otherData", {{"peak_memory", peak_memory()}}},
+    };
+    return trace.dump();
+}
+
+auto BakeProfiler::write_reports(std::string_view dir) const -> void {
+    const auto summary = this->summary();
+    const auto trace = chrome_trace();
+    const auto summary_path = std::format("{}/fb_bake_profile.txt", dir);
+    const auto trace_path = std::format("{}/fb_bake_trace.json", dir);
+    write_whole_file(summary_path, std::as_bytes(Span<const char>(summary)));
+    write_whole_file(trace_path, std::as_bytes(Span<const char>(trace)));
+}
+
+BakeZoneScope::BakeZoneScope(
+    BakeProfiler& profiler,
+    std::string_view category,
+    std::string name
+)
+    : _profiler(profiler)
+    , _parent(t_current_zone) {
+    _zone.category = std::string(category);
+    _zone.name = std::move(name);
+    _zone.thread_id = GetCurrentThreadId();
+    _zone.depth = _parent ? _parent->_zone.depth + 1 : 0;
+    _zone.start_time = _profiler.time();
+    t_current_zone = this;
+}
+
+BakeZoneScope::~BakeZoneScope() {
+    _zone.duration = _profiler.time() - _zone.start_time;
+    _profiler.record(std::move(_zone));
+    t_current_zone = _parent;
+}
+
+auto BakeZoneScope::step(std::string_view name) -> Option<BakeZoneScope> {
+    if (t_current_zone == nullptr) {
+        return std::nullopt;
+    }
+    return Option<BakeZoneScope>(
+        std::in_place,
+        t_current_zone->_profiler,
+        "step"sv,
+        std::string(name)
+    );
+}
+
+} // namespace fb
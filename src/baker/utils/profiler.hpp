@@ -0,0 +1,76 @@
+#pragma once
+
+#include <common/common.hpp>
+
+#include <mutex>
+
+namespace fb {
+
+struct BakeZone {
+    std::string category;
+    std::string name;
+    uint thread_id = 0;
+    uint depth = 0;
+    double start_time = 0.0;
+    double duration = 0.0;
+    size_t byte_count = 0;
+};
+
+// Thread-safe record of the timed zones of one bake, reported as a text
+// summary sorted by duration, and as a Chrome trace (chrome://tracing or
+// https://ui.perfetto.dev). Memory is only reported for the whole process, as
+// its peak working set, since concurrent zones share it.
+class BakeProfiler {
+    FB_NO_COPY_MOVE(BakeProfiler);
+
+public:
+    BakeProfiler() = default;
+
+    auto time() const -> double { return _epoch.elapsed_time(); }
+    auto record(BakeZone zone) -> void;
+    auto zones() const -> std::vector<BakeZone>;
+
+    // Peak working set of the process so far, in bytes.
+    auto peak_memory() const -> size_t;
+
+    auto summary() const -> std::string;
+    auto chrome_trace() const -> std::string;
+
+    // Writes `fb_bake_profile.txt` and `fb_bake_trace.json` to `dir`.
+    auto write_reports(std::string_view dir) const -> void;
+
+private:
+    Instant _epoch;
+    mutable std::mutex _mutex;
+    std::vector<BakeZone> _zones;
+};
+
+// Records one zone from construction to destruction. While it is alive, it is
+// the current zone of its thread, and `FB_BAKE_ZONE` nests steps under it,
+// which lets helpers like image decoding be profiled without passing the
+// profiler down to them.
+class BakeZoneScope {
+    FB_NO_COPY_MOVE(BakeZoneScope);
+
+public:
+    BakeZoneScope(BakeProfiler& profiler, std::string_view category, std::string name);
+    ~BakeZoneScope();
+
+    // Nested step under the current zone of this thread, or nothing if there
+    // is none.
+    static auto step(std::string_view name) -> Option<BakeZoneScope>;
+
+    auto set_byte_count(size_t byte_count) -> void { _zone.byte_count = byte_count; }
+
+private:
+    BakeProfiler& _profiler;
+    BakeZoneScope* _parent = nullptr;
+    BakeZone _zone;
+};
+
+#define FB_BAKE_ZONE_CONCAT_INNER(a, b) a##b
+#define FB_BAKE_ZONE_CONCAT(a, b) FB_BAKE_ZONE_CONCAT_INNER(a, b)
+#define FB_BAKE_ZONE(name) \
+    const auto FB_BAKE_ZONE_CONCAT(bake_zone_, __LINE__) = ::fb::BakeZoneScope::step(name)
+
+} // namespace fb
@@ -0,0 +1,405 @@
+#include "shared_cache.hpp"
+#include "sockets.hpp"
+
+#include <charconv>
+
+namespace fb {
+
+static auto frame_valid(const SharedCacheFrame& frame) -> bool {
+    return frame.magic == SHARED_CACHE_MAGIC && frame.version == SHARED_CACHE_VERSION;
+}
+
+static auto make_frame(SharedCacheOp op, Hash128 key, Span<const std::byte> bytes)
+    -> SharedCacheFrame {
+    return SharedCacheFrame {
+        .magic = SHARED_CACHE_MAGIC,
+        .version = SHARED_CACHE_VERSION,
+        .op = op,
+        .reserved = 0,
+        .key = key,
+        .byte_count = bytes.size(),
+        .hash = bytes.empty() ? Hash128() : hash128(bytes),
+    };
+}
+
+//
+// Directory.
+//
+
+SharedCacheDirectory::SharedCacheDirectory(std::string_view dir)
+    : _dir(dir) {
+    create_directories(_dir);
+}
+
+auto SharedCacheDirectory::entry_path(Hash128 key) const -> std::string {
+    return std::format("{}/{}.blob", _dir, key);
+}
+
+auto SharedCacheDirectory::get(Hash128 key) -> Option<std::vector<std::byte>> {
+    const auto path = entry_path(key);
+    if (!file_exists(path)) {
+        return std::nullopt;
+    }
+
+    // Validate.
+    const auto file = FileBuffer::from_path(path);
+    const auto file_bytes = file.as_span();
+    auto frame = SharedCacheFrame {};
+    if (file_bytes.size() >= sizeof(frame)) {
+        std::memcpy(&frame, file_bytes.data(), sizeof(frame));
+    }
+    const auto bytes = file_bytes.subspan(std::min(file_bytes.size(), sizeof(frame)));
+    if (!frame_valid(frame) || frame.key != key || frame.byte_count != bytes.size()
+        || frame.hash != hash128(bytes)) {
+        FB_LOG_WARN("Ignoring invalid shared cache entry: {}", path);
+        return std::nullopt;
+    }
+
+    return std::vector<std::byte>(bytes.begin(), bytes.end());
+}
+
+auto SharedCacheDirectory::put(Hash128 key, Span<const std::byte> bytes) -> bool {
+    const auto frame = make_frame(SharedCacheOp::Put, key, bytes);
+    auto file_bytes = std::vector<std::byte>(sizeof(frame) + bytes.size());
+    std::memcpy(file_bytes.data(), &frame, sizeof(frame));
+    std::memcpy(file_bytes.data() + sizeof(frame), bytes.data(), bytes.size());
+
+    // Write through a temporary file, so that readers never see partial entries.
+    const auto path = entry_path(key);
+    const auto temp_path = std::format("{}.{}.tmp", path, GetCurrentThreadId());
+    write_whole_file(temp_path, file_bytes);
+    move_file(path, temp_path);
+    return true;
+}
+
+//
+// Frames.
+//
+
+static auto send_frame(uintptr_t socket, const SharedCacheFrame& frame) -> bool {
+    return socket_send_all(socket, std::as_bytes(Span<const SharedCacheFrame>(&frame, 1)));
+}
+
+static auto recv_frame(uintptr_t socket, SharedCacheFrame& frame) -> bool {
+    return socket_recv_all(socket, std::as_writable_bytes(Span<SharedCacheFrame>(&frame, 1)))
+        && frame_valid(frame);
+}
+
+// Reads the bytes announced by `frame`, and checks them against its hash.
+static auto recv_payload(uintptr_t socket, const SharedCacheFrame& frame)
+    -> Option<std::vector<std::byte>> {
+    auto bytes = std::vector<std::byte>(frame.byte_count);
+    if (!socket_recv_all(socket, bytes)) {
+        return std::nullopt;
+    }
+    if (frame.hash != hash128(bytes)) {
+        FB_LOG_WARN("Shared cache: corrupted bytes for {}", frame.key);
+        return std::nullopt;
+    }
+    return bytes;
+}
+
+//
+// Connection.
+//
+
+SharedCacheConnection::SharedCacheConnection(uint16_t port) {
+    socket_startup();
+    const auto client = socket_connect_loopback(port);
+    if (!client.has_value()) {
+        FB_LOG_WARN("Shared cache: failed to connect to port {}", port);
+    }
+    _socket = client.value_or(INVALID_SOCKET_HANDLE);
+}
+
+SharedCacheConnection::SharedCacheConnection(SharedCacheConnection&& other) noexcept
+    : _socket(std::exchange(other._socket, INVALID_SOCKET_HANDLE)) {
+    socket_startup();
+}
+
+auto SharedCacheConnection::operator=(SharedCacheConnection&& other) noexcept
+    -> SharedCacheConnection& {
+    if (this != &other) {
+        disconnect();
+        _socket = std::exchange(other._socket, INVALID_SOCKET_HANDLE);
+    }
+    return *this;
+}
+
+SharedCacheConnection::~SharedCacheConnection() {
+    disconnect();
+    socket_cleanup();
+}
+
+auto SharedCacheConnection::connected() const -> bool {
+    return _socket != INVALID_SOCKET_HANDLE;
+}
+
+auto SharedCacheConnection::disconnect() -> void {
+    if (_socket != INVALID_SOCKET_HANDLE) {
+        socket_close(_socket);
+        _socket = INVALID_SOCKET_HANDLE;
+    }
+}
+
+auto SharedCacheConnection::get(Hash128 key) -> Option<std::vector<std::byte>> {
+    if (!connected()) {
+        return std::nullopt;
+    }
+
+    // Request.
+    auto frame = make_frame(SharedCacheOp::Get, key, {});
+    if (!send_frame(_socket, frame) || !recv_frame(_socket, frame) || frame.key != key) {
+        FB_LOG_WARN("Shared cache: connection lost");
+        disconnect();
+        return std::nullopt;
+    }
+    if (frame.op != SharedCacheOp::Hit) {
+        return std::nullopt;
+    }
+
+    // Payload.
+    auto bytes = recv_payload(_socket, frame);
+    if (!bytes.has_value()) {
+        disconnect();
+    }
+    return bytes;
+}
+
+auto SharedCacheConnection::put(Hash128 key, Span<const std::byte> bytes) -> bool {
+    if (!connected()) {
+        return false;
+    }
+
+    auto frame = make_frame(SharedCacheOp::Put, key, bytes);
+    if (!send_frame(_socket, frame) || !socket_send_all(_socket, bytes)
+        || !recv_frame(_socket, frame) || frame.key != key) {
+        FB_LOG_WARN("Shared cache: connection lost");
+        disconnect();
+        return false;
+    }
+    return frame.op == SharedCacheOp::Stored;
+}
+
+//
+// Server.
+//
+
+SharedCacheServer::SharedCacheServer(std::string_view storage_dir)
+    : _storage(storage_dir) {
+    socket_startup();
+    std::tie(_listener, _port) = socket_listen_loopback();
+
+    // Accept until the listener is closed.
+    _accept_thread = std::thread([this]() {
+        while (true) {
+            const auto client = socket_accept(_listener);
+            if (!client.has_value()) {
+                return;
+            }
+            std::scoped_lock lock(_mutex);
+            _clients.push_back(client.value());
+            _client_threads.emplace_back([this, client = client.value()]() { serve(client); });
+        }
+    });
+}
+
+SharedCacheServer::~SharedCacheServer() {
+    // Stop accepting, then unblock every client thread.
+    socket_shutdown(_listener);
+    socket_close(_listener);
+    _accept_thread.join();
+    for (const auto client : _clients) {
+        socket_shutdown(client);
+    }
+    for (auto& thread : _client_threads) {
+        thread.join();
+    }
+    for (const auto client : _clients) {
+        socket_close(client);
+    }
+    socket_cleanup();
+}
+
+auto SharedCacheServer::serve(uintptr_t client) -> void {
+    auto frame = SharedCacheFrame {};
+    while (recv_frame(client, frame)) {
+        switch (frame.op) {
+            case SharedCacheOp::Get: {
+                const auto bytes = _storage.get(frame.key);
+                if (!bytes.has_value()) {
+                    if (!send_frame(client, make_frame(SharedCacheOp::Miss, frame.key, {}))) {
+                        return;
+                    }
+                    break;
+                }
+                if (!send_frame(client, make_frame(SharedCacheOp::Hit, frame.key, bytes.value()))
+                    || !socket_send_all(client, bytes.value())) {
+                    return;
+                }
+                break;
+            }
+            case SharedCacheOp::Put: {
+                const auto bytes = recv_payload(client, frame);
+                const auto stored = bytes.has_value() && _storage.put(frame.key, bytes.value());
+                const auto op = stored ? SharedCacheOp::Stored : SharedCacheOp::Rejected;
+                if (!send_frame(client, make_frame(op, frame.key, {}))) {
+                    return;
+                }
+                break;
+            }
+            default: return;
+        }
+    }
+}
+
+//
+// Client.
+//
+
+SharedCacheClient::~SharedCacheClient() {
+    {
+        std::scoped_lock lock(_mutex);
+        _stopping = true;
+    }
+    _request_cv.notify_all();
+    _thread.join();
+}
+
+auto SharedCacheClient::prefetch(Span<const Hash128> keys) -> void {
+    {
+        std::scoped_lock lock(_mutex);
+        for (const auto key : keys) {
+            if (_fetches.try_emplace(key).second) {
+                _requests.push_back({.key = key});
+            }
+        }
+    }
+    _request_cv.notify_all();
+}
+
+auto SharedCacheClient::fetch(Hash128 key) -> Option<std::vector<std::byte>> {
+    std::unique_lock lock(_mutex);
+
+    // Keys that weren't prefetched jump the queue.
+    if (_fetches.try_emplace(key).second) {
+        _requests.push_front({.key = key});
+        _request_cv.notify_all();
+    }
+
+    _done_cv.wait(lock, [&]() { return _fetches[key].done; });
+    auto bytes = std::move(_fetches[key].bytes);
+    _fetches.erase(key);
+    return bytes;
+}
+
+auto SharedCacheClient::put(Hash128 key, std::vector<std::byte> bytes) -> void {
+    {
+        std::scoped_lock lock(_mutex);
+        _requests.push_back({.key = key, .put_bytes = std::move(bytes)});
+    }
+    _request_cv.notify_all();
+}
+
+auto SharedCacheClient::put_file(Hash128 key, std::string_view path) -> void {
+    {
+        std::scoped_lock lock(_mutex);
+        _requests.push_back({.key = key, .put_path = std::string(path)});
+    }
+    _request_cv.notify_all();
+}
+
+auto SharedCacheClient::fetch_to_file(Hash128 key, std::string_view path) -> bool {
+    const auto bytes = fetch(key);
+    if (!bytes.has_value()) {
+        return false;
+    }
+    const auto temp_path = std::format("{}.{}.tmp", path, GetCurrentThreadId());
+    write_whole_file(temp_path, bytes.value());
+    move_file(path, temp_path);
+    return true;
+}
+
+auto SharedCacheClient::flush() -> void {
+    std::unique_lock lock(_mutex);
+    _done_cv.wait(lock, [&]() { return _requests.empty() && _in_flight_count == 0; });
+}
+
+auto SharedCacheClient::run() -> void {
+    while (true) {
+        // Next request, until stopped and drained.
+        auto request = Request();
+        {
+            std::unique_lock lock(_mutex);
+            _request_cv.wait(lock, [&]() { return _stopping || !_requests.empty(); });
+            if (_requests.empty()) {
+                return;
+            }
+            request = std::move(_requests.front());
+            _requests.pop_front();
+            _in_flight_count++;
+        }
+
+        // Put.
+        if (request.put_bytes.has_value() || request.put_path.has_value()) {
+            auto file = FileBuffer();
+            if (request.put_path.has_value()) {
+                file = FileBuffer::from_path(request.put_path.value());
+            }
+            const auto bytes = request.put_bytes.has_value()
+                ? Span<const std::byte>(request.put_bytes.value())
+                : file.as_span();
+            const auto stored = std::visit(
+                [&](auto& backend) { return backend.put(request.key, bytes); },
+                _backend
+            );
+            if (stored) {
+                _put_count++;
+            }
+            {
+                std::scoped_lock lock(_mutex);
+                _in_flight_count--;
+            }
+            _done_cv.notify_all();
+            continue;
+        }
+
+        // Get.
+        auto bytes = std::visit([&](auto& backend) { return backend.get(request.key); }, _backend);
+        if (bytes.has_value()) {
+            _hit_count++;
+        } else {
+            _miss_count++;
+        }
+        {
+            std::scoped_lock lock(_mutex);
+            auto& fetch = _fetches[request.key];
+            fetch.done = true;
+            fetch.bytes = std::move(bytes);
+            _in_flight_count--;
+        }
+        _done_cv.notify_all();
+    }
+}
+
+auto shared_cache_client_from_env() -> std::unique_ptr<SharedCacheClient> {
+    const auto value = std::getenv("FB_BAKER_SHARED_CACHE");
+    if (value == nullptr || *value == '\0') {
+        return nullptr;
+    }
+
+    const auto location = std::string_view(value);
+    if (const auto prefix = "localhost:"sv; location.starts_with(prefix)) {
+        const auto port_string = location.substr(prefix.size());
+        auto port = uint16_t(0);
+        const auto [end, error] =
+            std::from_chars(port_string.data(), port_string.data() + port_string.size(), port);
+        FB_ASSERT_MSG(error == std::errc(), "Invalid shared cache port: {}", port_string);
+        FB_LOG_INFO("Shared cache: localhost:{}", port);
+        return std::make_unique<SharedCacheClient>(SharedCacheConnection(port));
+    }
+    FB_LOG_INFO("Shared cache: {}", location);
+    return std::make_unique<SharedCacheClient>(SharedCacheDirectory(location));
+}
+
+} // namespace fb
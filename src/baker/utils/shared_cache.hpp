@@ -0,0 +1,177 @@
+#pragma once
+
+#include <common/common.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace fb {
+
+// Bake outputs shared between machines, addressed by the `hash128` keys of
+// the local caches. Values are opaque bytes, in practice whole local cache
+// entries, which are validated again by their cache once fetched.
+//
+// Every value is framed by a `SharedCacheFrame`, both on disk and on the wire,
+// and the hash of its bytes is checked on every hop: a corrupted value is
+// dropped as a miss, and never stored.
+inline constexpr uint SHARED_CACHE_MAGIC = 0x43534246; // "FBSC"
+inline constexpr uint SHARED_CACHE_VERSION = 1;
+
+enum class SharedCacheOp : uint {
+    Get,
+    Put,
+    Hit,
+    Miss,
+    Stored,
+    Rejected,
+};
+
+struct SharedCacheFrame {
+    uint magic;
+    uint version;
+    SharedCacheOp op;
+    uint reserved;
+    Hash128 key;
+    uint64_t byte_count;
+    Hash128 hash;
+};
+
+// Backend protocol. `get` returns the bytes stored under `key` if they are
+// intact, `put` stores them and returns whether they were accepted.
+template<typename T>
+concept SharedCacheBackend = requires(T& backend, Hash128 key, Span<const std::byte> bytes) {
+    { backend.get(key) } -> std::same_as<Option<std::vector<std::byte>>>;
+    { backend.put(key, bytes) } -> std::same_as<bool>;
+};
+
+// Values stored as files in a directory, which can be on a network share.
+class SharedCacheDirectory {
+public:
+    explicit SharedCacheDirectory(std::string_view dir);
+
+    auto get(Hash128 key) -> Option<std::vector<std::byte>>;
+    auto put(Hash128 key, Span<const std::byte> bytes) -> bool;
+
+private:
+    auto entry_path(Hash128 key) const -> std::string;
+
+    std::string _dir;
+};
+
+// Connection to a `SharedCacheServer` over TCP. If the server can't be
+// reached, or the connection fails later on, every request misses.
+class SharedCacheConnection {
+    FB_NO_COPY(SharedCacheConnection);
+
+public:
+    explicit SharedCacheConnection(uint16_t port);
+    SharedCacheConnection(SharedCacheConnection&& other) noexcept;
+    auto operator=(SharedCacheConnection&& other) noexcept -> SharedCacheConnection&;
+    ~SharedCacheConnection();
+
+    auto connected() const -> bool;
+    auto get(Hash128 key) -> Option<std::vector<std::byte>>;
+    auto put(Hash128 key, Span<const std::byte> bytes) -> bool;
+
+private:
+    auto disconnect() -> void;
+
+    uintptr_t _socket;
+};
+
+static_assert(SharedCacheBackend<SharedCacheDirectory>);
+static_assert(SharedCacheBackend<SharedCacheConnection>);
+
+// Serves a `SharedCacheDirectory` on the loopback interface, on a port picked
+// by the system. Every connection is served by its own thread, until the
+// server is destroyed.
+class SharedCacheServer {
+    FB_NO_COPY_MOVE(SharedCacheServer);
+
+public:
+    explicit SharedCacheServer(std::string_view storage_dir);
+    ~SharedCacheServer();
+
+    auto port() const -> uint16_t { return _port; }
+
+private:
+    auto serve(uintptr_t client) -> void;
+
+    SharedCacheDirectory _storage;
+    uintptr_t _listener;
+    uint16_t _port = 0;
+    std::mutex _mutex;
+    std::vector<uintptr_t> _clients;
+    std::vector<std::thread> _client_threads;
+    std::thread _accept_thread;
+};
+
+// Non-blocking client of a backend. Requests run on a thread of the client:
+// `prefetch` and `put` return immediately, and `fetch` only waits for its own
+// key, which was usually prefetched by then.
+class SharedCacheClient {
+    FB_NO_COPY_MOVE(SharedCacheClient);
+
+public:
+    template<SharedCacheBackend Backend>
+    explicit SharedCacheClient(Backend backend)
+        : _backend(std::in_place_type<Backend>, std::move(backend))
+        , _thread([this]() { run(); }) {}
+
+    // Finishes pending puts.
+    ~SharedCacheClient();
+
+    auto prefetch(Span<const Hash128> keys) -> void;
+    auto fetch(Hash128 key) -> Option<std::vector<std::byte>>;
+    auto put(Hash128 key, std::vector<std::byte> bytes) -> void;
+    // Puts the contents of the file at `path`, which is only read once the
+    // put runs, one file at a time.
+    auto put_file(Hash128 key, std::string_view path) -> void;
+
+    // Fetches `key` into the file at `path`, through a temporary file so that
+    // readers never see partial files. Returns whether the key hit.
+    auto fetch_to_file(Hash128 key, std::string_view path) -> bool;
+
+    // Waits until every request so far is done.
+    auto flush() -> void;
+
+    auto hit_count() const -> uint { return _hit_count.load(); }
+    auto miss_count() const -> uint { return _miss_count.load(); }
+    auto put_count() const -> uint { return _put_count.load(); }
+
+private:
+    struct Request {
+        Hash128 key;
+        Option<std::vector<std::byte>> put_bytes;
+        Option<std::string> put_path;
+    };
+
+    struct Fetch {
+        bool done = false;
+        Option<std::vector<std::byte>> bytes;
+    };
+
+    auto run() -> void;
+
+    std::variant<SharedCacheDirectory, SharedCacheConnection> _backend;
+    std::mutex _mutex;
+    std::condition_variable _request_cv;
+    std::condition_variable _done_cv;
+    std::deque<Request> _requests;
+    std::unordered_map<Hash128, Fetch> _fetches;
+    uint _in_flight_count = 0;
+    bool _stopping = false;
+    std::atomic<uint> _hit_count = 0;
+    std::atomic<uint> _miss_count = 0;
+    std::atomic<uint> _put_count = 0;
+    std::thread _thread;
+};
+
+// Client for the backend named by the `FB_BAKER_SHARED_CACHE` environment
+// variable: `localhost:<port>` for a server, anything else for a directory.
+// None when the variable isn't set.
+auto shared_cache_client_from_env() -> std::unique_ptr<SharedCacheClient>;
+
+} // namespace fb
@@ -0,0 +1,98 @@
+#include "sockets.hpp"
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+
+namespace fb {
+
+static_assert(INVALID_SOCKET_HANDLE == INVALID_SOCKET);
+
+auto socket_startup() -> void {
+    auto wsa_data = WSADATA {};
+    FB_ASSERT(WSAStartup(MAKEWORD(2, 2), &wsa_data) == 0);
+}
+
+auto socket_cleanup() -> void {
+    WSACleanup();
+}
+
+auto socket_listen_loopback() -> std::tuple<uintptr_t, uint16_t> {
+    const auto listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    FB_ASSERT(listener != INVALID_SOCKET);
+    auto address = sockaddr_in {.sin_family = AF_INET, .sin_port = 0};
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    FB_ASSERT(bind(listener, (const sockaddr*)&address, sizeof(address)) != SOCKET_ERROR);
+    FB_ASSERT(listen(listener, SOMAXCONN) != SOCKET_ERROR);
+    auto address_size = (int)sizeof(address);
+    FB_ASSERT(getsockname(listener, (sockaddr*)&address, &address_size) != SOCKET_ERROR);
+    return {listener, ntohs(address.sin_port)};
+}
+
+auto socket_connect_loopback(uint16_t port) -> Option<uintptr_t> {
+    const auto client = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    FB_ASSERT(client != INVALID_SOCKET);
+    auto address = sockaddr_in {.sin_family = AF_INET, .sin_port = htons(port)};
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(client, (const sockaddr*)&address, sizeof(address)) == SOCKET_ERROR) {
+        closesocket(client);
+        return std::nullopt;
+    }
+    return client;
+}
+
+auto socket_wait_readable(uintptr_t socket, double timeout) -> bool {
+    auto sockets = fd_set {};
+    FD_ZERO(&sockets);
+    FD_SET(socket, &sockets);
+    const auto microseconds = (long long)(std::max(timeout, 0.0) * 1e6);
+    auto time = timeval {
+        .tv_sec = (long)(microseconds / 1000000),
+        .tv_usec = (long)(microseconds % 1000000),
+    };
+    return select(0, &sockets, nullptr, nullptr, &time) != 0;
+}
+
+auto socket_accept(uintptr_t listener, double timeout) -> Option<uintptr_t> {
+    if (timeout >= 0.0 && !socket_wait_readable(listener, timeout)) {
+        return std::nullopt;
+    }
+    const auto client = accept(listener, nullptr, nullptr);
+    if (client == INVALID_SOCKET) {
+        return std::nullopt;
+    }
+    return client;
+}
+
+auto socket_shutdown(uintptr_t socket) -> void {
+    shutdown(socket, SD_BOTH);
+}
+
+auto socket_close(uintptr_t socket) -> void {
+    closesocket(socket);
+}
+
+auto socket_send_all(uintptr_t socket, Span<const std::byte> bytes) -> bool {
+    while (!bytes.empty()) {
+        const auto chunk = (int)std::min(bytes.size(), size_t(1) << 30);
+        const auto sent = send(socket, (const char*)bytes.data(), chunk, 0);
+        if (sent <= 0) {
+            return false;
+        }
+        bytes = bytes.subspan((size_t)sent);
+    }
+    return true;
+}
+
+auto socket_recv_all(uintptr_t socket, Span<std::byte> bytes) -> bool {
+    while (!bytes.empty()) {
+        const auto chunk = (int)std::min(bytes.size(), size_t(1) << 30);
+        const auto received = recv(socket, (char*)bytes.data(), chunk, 0);
+        if (received <= 0) {
+            return false;
+        }
+        bytes = bytes.subspan((size_t)received);
+    }
+    return true;
+}
+
+} // namespace fb
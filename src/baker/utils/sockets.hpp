@@ -0,0 +1,34 @@
+#pragma once
+
+#include <common/common.hpp>
+
+namespace fb {
+
+// Blocking TCP sockets on the loopback interface, as plain handles. Users
+// call `socket_startup` and `socket_cleanup` in pairs, which Winsock counts.
+inline constexpr uintptr_t INVALID_SOCKET_HANDLE = ~uintptr_t(0);
+
+auto socket_startup() -> void;
+auto socket_cleanup() -> void;
+
+// Listens on a port picked by the system, and returns it with the socket.
+auto socket_listen_loopback() -> std::tuple<uintptr_t, uint16_t>;
+auto socket_connect_loopback(uint16_t port) -> Option<uintptr_t>;
+
+// Waits for a connection, for at most `timeout` seconds if it isn't negative.
+// None once the listener is shut down.
+auto socket_accept(uintptr_t listener, double timeout = -1.0) -> Option<uintptr_t>;
+
+// Waits for the socket to have bytes to receive, or to be closed, for at most
+// `timeout` seconds. Returns whether a receive wouldn't block.
+auto socket_wait_readable(uintptr_t socket, double timeout) -> bool;
+
+// Unblocks every pending call on the socket.
+auto socket_shutdown(uintptr_t socket) -> void;
+auto socket_close(uintptr_t socket) -> void;
+
+// Return false once the connection is lost.
+auto socket_send_all(uintptr_t socket, Span<const std::byte> bytes) -> bool;
+auto socket_recv_all(uintptr_t socket, Span<std::byte> bytes) -> bool;
+
+} // namespace fb
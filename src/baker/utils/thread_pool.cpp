@@ -0,0 +1,86 @@
+#include "thread_pool.hpp"
+
+namespace fb {
+
+auto ThreadPool::default_worker_count() -> uint {
+    const auto hardware_threads = std::thread::hardware_concurrency();
+    return hardware_threads > 1 ? hardware_threads - 1 : 0;
+}
+
+ThreadPool::ThreadPool(uint worker_count) {
+    _workers.reserve(worker_count);
+    for (uint i = 0; i < worker_count; i++) {
+        _workers.emplace_back([this]() { worker_loop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::scoped_lock lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+}
+
+auto ThreadPool::Batch::work() -> void {
+    for (;;) {
+        const auto index = next.fetch_add(1);
+        if (index >= count) {
+            return;
+        }
+        f(index);
+        if (done.fetch_add(1) + 1 == count) {
+            done.notify_all();
+        }
+    }
+}
+
+auto ThreadPool::parallel_for(size_t count, std::function<void(size_t)> f) -> void {
+    if (count == 0) {
+        return;
+    }
+
+    auto batch = std::make_shared<Batch>();
+    batch->f = std::move(f);
+    batch->count = count;
+
+    // Nested batches go to the front, so idle workers help finish the
+    // innermost work first.
+    if (!_workers.empty() && count > 1) {
+        {
+            std::scoped_lock lock(_mutex);
+            _batches.push_front(batch);
+        }
+        _cv.notify_all();
+    }
+
+    // The caller works on its own batch, then waits for the stragglers.
+    batch->work();
+    for (auto done = batch->done.load(); done != count; done = batch->done.load()) {
+        batch->done.wait(done);
+    }
+}
+
+auto ThreadPool::worker_loop() -> void {
+    for (;;) {
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock lock(_mutex);
+            _cv.wait(lock, [this]() { return _stop || !_batches.empty(); });
+            if (_stop) {
+                return;
+            }
+            batch = _batches.front();
+            if (batch->exhausted()) {
+                _batches.pop_front();
+                continue;
+            }
+        }
+        batch->work();
+    }
+}
+
+} // namespace fb
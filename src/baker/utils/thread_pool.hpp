@@ -0,0 +1,56 @@
+#pragma once
+
+#include <common/common.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace fb {
+
+// Fixed-size pool of worker threads for baker tasks.
+//
+// The calling thread always participates in `parallel_for`, which means that
+// a pool with zero workers runs everything serially on the caller, and that
+// `parallel_for` can be nested from inside a task without deadlocking.
+class ThreadPool {
+    FB_NO_COPY_MOVE(ThreadPool);
+
+public:
+    static auto default_worker_count() -> uint;
+
+    explicit ThreadPool(uint worker_count = default_worker_count());
+    ~ThreadPool();
+
+    auto worker_count() const -> uint { return (uint)_workers.size(); }
+    auto thread_count() const -> uint { return worker_count() + 1; }
+
+    // Calls `f(i)` for every `i` in `[0, count)` and blocks until all calls
+    // have returned. The order in which indices are executed is unspecified.
+    auto parallel_for(size_t count, std::function<void(size_t)> f) -> void;
+
+private:
+    struct Batch {
+        std::function<void(size_t)> f;
+        size_t count = 0;
+        std::atomic<size_t> next = 0;
+        std::atomic<size_t> done = 0;
+
+        auto exhausted() const -> bool { return next.load() >= count; }
+        auto work() -> void;
+    };
+
+    auto worker_loop() -> void;
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<std::shared_ptr<Batch>> _batches;
+    bool _stop = false;
+};
+
+} // namespace fb
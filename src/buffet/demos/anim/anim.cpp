@@ -8,7 +8,9 @@ auto copy_animation_mesh(OwnedAnimationMesh& dst, const baked::AnimationMesh& sr
     dst.joint_count = src.joint_count;
     dst.duration = src.duration;
     dst.skinning_vertices.assign(src.skinning_vertices.begin(), src.skinning_vertices.end());
+    dst.index_format = src.index_format;
     dst.indices.assign(src.indices.begin(), src.indices.end());
+    dst.short_indices.assign(src.short_indices.begin(), src.short_indices.end());
     dst.submeshes.assign(src.submeshes.begin(), src.submeshes.end());
     dst.joint_nodes.assign(src.joint_nodes.begin(), src.joint_nodes.end());
     dst.joint_inverse_binds.assign(src.joint_inverse_binds.begin(), src.joint_inverse_binds.end());
@@ -120,9 +122,9 @@ auto create(Demo& demo, const CreateDesc& desc) -> void {
                 D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
                 model_scope.with_name("Vertices")
             );
-            dst.indices.create_and_transfer(
+            dst.indices.create_and_transfer_baked(
                 device,
-                src.indices,
+                src,
                 D3D12_BARRIER_SYNC_INDEX_INPUT,
                 D3D12_BARRIER_ACCESS_INDEX_BUFFER,
                 model_scope.with_name("Indices")
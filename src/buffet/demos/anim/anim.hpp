@@ -58,7 +58,9 @@ struct OwnedAnimationMesh {
     uint joint_count;
     float duration;
     std::vector<baked::SkinningVertex> skinning_vertices;
+    DXGI_FORMAT index_format;
     std::vector<baked::Index> indices;
+    std::vector<baked::ShortIndex> short_indices;
     std::vector<baked::Submesh> submeshes;
     std::vector<uint> joint_nodes;
     std::vector<float4x4> joint_inverse_binds;
@@ -76,7 +78,7 @@ struct Model {
     KcnMultibuffer<GpuBufferHostCbv<Constants>, FRAME_COUNT> constants;
     KcnMultibuffer<GpuBufferHostSrv<float4x4>, FRAME_COUNT> skinning_matrices;
     GpuBufferDeviceSrv<baked::SkinningVertex> vertices;
-    GpuBufferDeviceIndex<baked::Index> indices;
+    GpuBufferDeviceMeshIndex indices;
     float animation_time = 0.0f;
     float animation_duration = 0.0f;
     std::vector<float4x4> animation_global_transforms;
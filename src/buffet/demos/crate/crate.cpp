@@ -68,9 +68,9 @@ auto create(Demo& demo, const CreateDesc& desc) -> void {
             D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
             model_debug.with_name("Vertices")
         );
-        model.indices.create_and_transfer(
+        model.indices.create_and_transfer_baked(
             device,
-            mesh.indices,
+            mesh,
             D3D12_BARRIER_SYNC_INDEX_INPUT,
             D3D12_BARRIER_ACCESS_INDEX_BUFFER,
             model_debug.with_name("Indices")
@@ -33,7 +33,7 @@ struct Parameters {
 
 struct Model {
     GpuBufferDeviceSrv<baked::Vertex> vertices;
-    GpuBufferDeviceIndex<baked::Index> indices;
+    GpuBufferDeviceMeshIndex indices;
     GpuTextureSrv base_color;
     GpuTextureSrv normal;
     GpuTextureSrv metallic_roughness;
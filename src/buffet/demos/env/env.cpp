@@ -76,9 +76,9 @@ auto create(Demo& demo, const CreateDesc& desc) -> void {
             D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
             pass_debug.with_name("Vertices")
         );
-        pass.indices.create_and_transfer(
+        pass.indices.create_and_transfer_baked(
             device,
-            mesh.indices,
+            mesh,
             D3D12_BARRIER_SYNC_INDEX_INPUT,
             D3D12_BARRIER_ACCESS_INDEX_BUFFER,
             pass_debug.with_name("Indices")
@@ -119,9 +119,9 @@ auto create(Demo& demo, const CreateDesc& desc) -> void {
             D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
             pass_debug.with_name("Vertices")
         );
-        pass.indices.create_and_transfer(
+        pass.indices.create_and_transfer_baked(
             device,
-            mesh.indices,
+            mesh,
             D3D12_BARRIER_SYNC_INDEX_INPUT,
             D3D12_BARRIER_ACCESS_INDEX_BUFFER,
             pass_debug.with_name("Indices")
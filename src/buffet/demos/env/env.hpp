@@ -46,7 +46,7 @@ struct Demo {
         GpuPipeline pipeline;
         KcnMultibuffer<GpuBufferHostCbv<BackgroundConstants>, FRAME_COUNT> constants;
         GpuBufferDeviceSrv<baked::Vertex> vertices;
-        GpuBufferDeviceIndex<baked::Index> indices;
+        GpuBufferDeviceMeshIndex indices;
         GpuTextureSrvCube texture;
     } background;
 
@@ -54,7 +54,7 @@ struct Demo {
         GpuPipeline pipeline;
         KcnMultibuffer<GpuBufferHostCbv<ModelConstants>, FRAME_COUNT> constants;
         GpuBufferDeviceSrv<baked::Vertex> vertices;
-        GpuBufferDeviceIndex<baked::Index> indices;
+        GpuBufferDeviceMeshIndex indices;
     } model;
 };
 
@@ -100,9 +100,9 @@ auto create(Demo& demo, const CreateDesc& desc) -> void {
             D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
             debug.with_name("Light Vertices")
         );
-        demo.light_mesh.indices.create_and_transfer(
+        demo.light_mesh.indices.create_and_transfer_baked(
             device,
-            mesh.indices,
+            mesh,
             D3D12_BARRIER_SYNC_INDEX_INPUT,
             D3D12_BARRIER_ACCESS_INDEX_BUFFER,
             debug.with_name("Light Indices")
@@ -38,7 +38,12 @@ struct Parameters {
     float heatmap_opacity = 0.5f;
 };
 
-struct Mesh {
+struct LightMesh {
+    GpuBufferDeviceSrv<baked::Vertex> vertices;
+    GpuBufferDeviceMeshIndex indices;
+};
+
+struct PlaneMesh {
     GpuBufferDeviceSrv<baked::Vertex> vertices;
     GpuBufferDeviceIndex<baked::Index> indices;
 };
@@ -55,8 +60,8 @@ struct Demo {
     GpuPipeline plane_pipeline;
     GpuPipeline debug_pipeline;
     KcnMultibuffer<GpuBufferHostCbv<Constants>, FRAME_COUNT> constants;
-    Mesh light_mesh;
-    Mesh plane_mesh;
+    LightMesh light_mesh;
+    PlaneMesh plane_mesh;
     GpuBufferDeviceSrvUav<Light> lights;
     GpuTextureSrv magma_texture;
     GpuTextureSrv viridis_texture;
@@ -39,9 +39,9 @@ auto create(Demo& demo, const CreateDesc& desc) -> void {
         D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
         debug.with_name("Vertices")
     );
-    demo.indices.create_and_transfer(
+    demo.indices.create_and_transfer_baked(
         device,
-        grass.indices,
+        grass,
         D3D12_BARRIER_SYNC_INDEX_INPUT,
         D3D12_BARRIER_ACCESS_INDEX_BUFFER,
         debug.with_name("Indices")
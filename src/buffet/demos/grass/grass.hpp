@@ -34,7 +34,7 @@ struct Demo {
     KcnDebugDraw debug_draw;
     KcnMultibuffer<GpuBufferHostCbv<Constants>, FRAME_COUNT> constants;
     GpuBufferDeviceSrv<baked::Vertex> vertices;
-    GpuBufferDeviceIndex<baked::Index> indices;
+    GpuBufferDeviceMeshIndex indices;
     GpuTextureSrv texture;
     baked::Material material;
     GpuPipeline pipeline_naive;
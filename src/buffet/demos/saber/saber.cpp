@@ -55,9 +55,9 @@ auto create(Demo& demo, const CreateDesc& desc) -> void {
             D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
             pass_debug.with_name("Vertices")
         );
-        scene.indices.create_and_transfer(
+        scene.indices.create_and_transfer_baked(
             device,
-            mesh.indices,
+            mesh,
             D3D12_BARRIER_SYNC_INDEX_INPUT,
             D3D12_BARRIER_ACCESS_INDEX_BUFFER,
             pass_debug.with_name("Indices")
@@ -39,7 +39,7 @@ struct Demo {
         KcnDebugDraw debug_draw;
         GpuPipeline pipeline;
         GpuBufferDeviceSrv<baked::Vertex> vertices;
-        GpuBufferDeviceIndex<baked::Index> indices;
+        GpuBufferDeviceMeshIndex indices;
         GpuBufferDeviceSrv<SceneInstance> instances;
     } scene;
 
@@ -47,7 +47,7 @@ struct Demo {
         GpuPipeline pipeline;
         KcnMultibuffer<GpuBufferHostCbv<BackgroundConstants>, FRAME_COUNT> constants;
         GpuBufferDeviceSrv<baked::Vertex> vertices;
-        GpuBufferDeviceIndex<baked::Index> indices;
+        GpuBufferDeviceMeshIndex indices;
     } bg;
 
     struct {
@@ -56,7 +56,7 @@ struct Demo {
         KcnMultibuffer<GpuBufferHostSrv<GlyphInstance>, FRAME_COUNT> instances;
         std::vector<baked::Submesh> submeshes;
         GpuBufferDeviceSrv<baked::Vertex> vertices;
-        GpuBufferDeviceIndex<baked::Index> indices;
+        GpuBufferDeviceMeshIndex indices;
 
         ComPtr<ID3D12CommandSignature> indirect_command_signature;
         KcnMultibuffer<GpuBufferHostSrv<DrawGlyphCommand>, FRAME_COUNT> indirect_commands;
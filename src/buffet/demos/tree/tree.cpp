@@ -40,9 +40,9 @@ auto create(Demo& demo, const CreateDesc& desc) -> void {
         D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
         debug.with_name("Tree Vertices")
     );
-    demo.tree_indices.create_and_transfer(
+    demo.tree_indices.create_and_transfer_baked(
         device,
-        tree.indices,
+        tree,
         D3D12_BARRIER_SYNC_INDEX_INPUT,
         D3D12_BARRIER_ACCESS_INDEX_BUFFER,
         debug.with_name("Tree Indices")
@@ -54,9 +54,9 @@ auto create(Demo& demo, const CreateDesc& desc) -> void {
         D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
         debug.with_name("Sand Vertices")
     );
-    demo.sand_indices.create_and_transfer(
+    demo.sand_indices.create_and_transfer_baked(
         device,
-        sand.indices,
+        sand,
         D3D12_BARRIER_SYNC_INDEX_INPUT,
         D3D12_BARRIER_ACCESS_INDEX_BUFFER,
         debug.with_name("Sand Indices")
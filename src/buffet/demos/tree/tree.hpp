@@ -41,10 +41,10 @@ struct Demo {
     KcnDebugDraw debug_draw;
     KcnMultibuffer<GpuBufferHostCbv<Constants>, FRAME_COUNT> constants;
     GpuBufferDeviceSrv<baked::Vertex> tree_vertices;
-    GpuBufferDeviceIndex<baked::Index> tree_indices;
+    GpuBufferDeviceMeshIndex tree_indices;
     GpuTextureSrv tree_texture;
     GpuBufferDeviceSrv<baked::Vertex> sand_vertices;
-    GpuBufferDeviceIndex<baked::Index> sand_indices;
+    GpuBufferDeviceMeshIndex sand_indices;
     GpuTextureSrv sand_texture;
     GpuPipeline shadow_pipeline;
     GpuTextureSrvDsv shadow_depth;
@@ -39,10 +39,41 @@ inline void archive_trivial(A& arc, T& value) {
     }
 }
 
+template<Archive A, Archivable T>
+inline void archive_trivial_array(A& arc, T* values, size_t count) {
+    const size_t size = count * sizeof(T);
+    if constexpr (std::is_same_v<A, SerializingArchive>) {
+        const auto offset = arc.buf.size();
+        arc.buf.resize(offset + size);
+        memcpy(arc.buf.data() + offset, values, size);
+    } else {
+        memcpy(values, arc.buf.data(), size);
+        arc.buf = arc.buf.last(arc.buf.size() - size);
+    }
+}
+
 template<Archive A, Archivable T>
 inline A& operator&(A& arc, T& value) {
     archive_trivial(arc, value);
     return arc;
 }
 
+template<Archive A>
+inline A& operator&(A& arc, std::string& value) {
+    auto size = (uint64_t)value.size();
+    archive_trivial(arc, size);
+    value.resize(size);
+    archive_trivial_array(arc, value.data(), size);
+    return arc;
+}
+
+template<Archive A, Archivable T>
+inline A& operator&(A& arc, std::vector<T>& values) {
+    auto size = (uint64_t)values.size();
+    archive_trivial(arc, size);
+    values.resize(size);
+    archive_trivial_array(arc, values.data(), size);
+    return arc;
+}
+
 } // namespace fb
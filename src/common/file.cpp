@@ -71,6 +71,102 @@ FileBuffer::~FileBuffer() {
     }
 }
 
+FileWriter::FileWriter(std::string_view path)
+    : _path(path) {
+    _file = CreateFileA(
+        _path.c_str(),
+        GENERIC_WRITE,
+        0,
+        nullptr,
+        CREATE_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+    );
+    FB_ASSERT_MSG(_file != INVALID_HANDLE_VALUE, "Failed to create file: {}", path);
+}
+
+FileWriter::~FileWriter() {
+    close();
+}
+
+auto FileWriter::write(Span<const std::byte> data) -> void {
+    FB_ASSERT(_file != INVALID_HANDLE_VALUE);
+    _hasher.update(data);
+    _byte_count += data.size();
+
+    // WriteFile takes 32-bit sizes.
+    constexpr size_t MAX_WRITE_SIZE = 1 << 30;
+    while (!data.empty()) {
+        const auto write_size = std::min(data.size(), MAX_WRITE_SIZE);
+        DWORD bytes_written = 0;
+        FB_ASSERT_MSG(
+            WriteFile(_file, data.data(), (DWORD)write_size, &bytes_written, nullptr)
+                && bytes_written == write_size,
+            "Failed to write file: {}",
+            _path
+        );
+        data = data.subspan(write_size);
+    }
+}
+
+static constexpr size_t FILE_CHUNK_SIZE = 4 * 1024 * 1024;
+
+// Calls `f` with consecutive chunks of `byte_count` bytes at `offset` of the
+// open `file`, or of the rest of it. Returns the number of bytes read.
+template<typename F>
+static auto read_file_chunks(HANDLE file, uint64_t offset, uint64_t byte_count, F&& f)
+    -> uint64_t {
+    auto distance = LARGE_INTEGER {};
+    distance.QuadPart = (LONGLONG)offset;
+    if (!SetFilePointerEx(file, distance, nullptr, FILE_BEGIN)) {
+        return 0;
+    }
+    auto chunk = std::vector<std::byte>(std::min<uint64_t>(FILE_CHUNK_SIZE, byte_count));
+    auto read_count = uint64_t(0);
+    while (read_count < byte_count) {
+        const auto read_size = (DWORD)std::min<uint64_t>(chunk.size(), byte_count - read_count);
+        DWORD bytes_read = 0;
+        if (!ReadFile(file, chunk.data(), read_size, &bytes_read, nullptr) || bytes_read == 0) {
+            break;
+        }
+        f(Span<const std::byte>(chunk.data(), bytes_read));
+        read_count += bytes_read;
+    }
+    return read_count;
+}
+
+auto FileWriter::write_file(std::string_view path, uint64_t offset, uint64_t byte_count)
+    -> void {
+    HANDLE file = CreateFileA(
+        path.data(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+    );
+    FB_ASSERT_MSG(file != INVALID_HANDLE_VALUE, "Failed to open file: {}", path);
+    const auto read_count =
+        read_file_chunks(file, offset, byte_count, [&](Span<const std::byte> chunk) {
+            write(chunk);
+        });
+    FB_ASSERT_MSG(
+        byte_count == UINT64_MAX || read_count == byte_count,
+        "Failed to read file: {}",
+        path
+    );
+    CloseHandle(file);
+}
+
+auto FileWriter::close() -> void {
+    if (_file != INVALID_HANDLE_VALUE) {
+        CloseHandle(_file);
+        _file = INVALID_HANDLE_VALUE;
+        FB_LOG_TRACE("Wrote {} bytes to file: {}", _byte_count, _path);
+    }
+}
+
 auto write_whole_file(std::string_view path, Span<const std::byte> data) -> void {
     HANDLE file = CreateFileA(
         path.data(),
@@ -94,6 +190,75 @@ auto write_whole_file(std::string_view path, Span<const std::byte> data) -> void
     CloseHandle(file);
 }
 
+auto read_file_range(std::string_view path, uint64_t offset, size_t byte_count)
+    -> std::vector<std::byte> {
+    HANDLE file = CreateFileA(
+        path.data(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE) {
+        return {};
+    }
+
+    auto bytes = std::vector<std::byte>(byte_count);
+    auto distance = LARGE_INTEGER {};
+    distance.QuadPart = (LONGLONG)offset;
+    DWORD bytes_read = 0;
+    const auto read = SetFilePointerEx(file, distance, nullptr, FILE_BEGIN)
+        && ReadFile(file, bytes.data(), (DWORD)bytes.size(), &bytes_read, nullptr);
+    bytes.resize(read ? bytes_read : 0);
+    CloseHandle(file);
+    return bytes;
+}
+
+auto hash_file_range(std::string_view path, uint64_t offset, uint64_t byte_count)
+    -> Option<Hash128> {
+    HANDLE file = CreateFileA(
+        path.data(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE) {
+        return std::nullopt;
+    }
+    auto hasher = Hasher128();
+    const auto read_count =
+        read_file_chunks(file, offset, byte_count, [&](Span<const std::byte> chunk) {
+            hasher.update(chunk);
+        });
+    CloseHandle(file);
+    if (read_count != byte_count) {
+        return std::nullopt;
+    }
+    return hasher.digest();
+}
+
+auto move_file(std::string_view dst_path, std::string_view src_path) -> void {
+    MoveFileExA(src_path.data(), dst_path.data(), MOVEFILE_REPLACE_EXISTING);
+}
+
+auto copy_file(std::string_view dst_path, std::string_view src_path) -> void {
+    FB_ASSERT_MSG(
+        CopyFileA(src_path.data(), dst_path.data(), FALSE),
+        "Failed to copy file: {} -> {}",
+        src_path,
+        dst_path
+    );
+}
+
+auto link_file(std::string_view dst_path, std::string_view src_path) -> bool {
+    return CreateHardLinkA(dst_path.data(), src_path.data(), nullptr) != FALSE;
+}
+
 auto move_file_if_different(std::string_view dst_path, std::string_view src_path) -> bool {
     if (file_exists(dst_path)) {
         const auto dst_data = FileBuffer::from_path(dst_path);
@@ -104,7 +269,7 @@ auto move_file_if_different(std::string_view dst_path, std::string_view src_path
             }
         }
     }
-    MoveFileExA(src_path.data(), dst_path.data(), MOVEFILE_REPLACE_EXISTING);
+    move_file(dst_path, src_path);
     return true;
 }
 
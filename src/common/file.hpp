@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pch.hpp"
+#include "hash.hpp"
 
 namespace fb {
 
@@ -26,7 +27,45 @@ private:
     uint _byte_count = 0;
 };
 
+// Streams sequential writes to a file, so that large outputs never have to be
+// held in memory, and hashes them on the way.
+class FileWriter {
+public:
+    explicit FileWriter(std::string_view path);
+    FileWriter(const FileWriter&) = delete;
+    auto operator=(const FileWriter&) -> FileWriter& = delete;
+    ~FileWriter();
+
+    auto write(Span<const std::byte> data) -> void;
+    // Appends `byte_count` bytes of another file from `offset`, or all of the
+    // rest of it, read in bounded chunks.
+    auto write_file(std::string_view path, uint64_t offset = 0, uint64_t byte_count = UINT64_MAX)
+        -> void;
+    auto close() -> void;
+    auto byte_count() const -> size_t { return _byte_count; }
+    auto hash() const -> Hash128 { return _hasher.digest(); }
+
+private:
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    std::string _path;
+    size_t _byte_count = 0;
+    Hasher128 _hasher;
+};
+
 auto write_whole_file(std::string_view path, Span<const std::byte> data) -> void;
+// Reads at most `byte_count` bytes at `offset`. Fewer past the end of the file,
+// and none if it can't be opened.
+auto read_file_range(std::string_view path, uint64_t offset, size_t byte_count)
+    -> std::vector<std::byte>;
+// Hashes `byte_count` bytes at `offset`, read in bounded chunks. None if the file
+// can't be opened or is shorter.
+auto hash_file_range(std::string_view path, uint64_t offset, uint64_t byte_count)
+    -> Option<Hash128>;
+auto move_file(std::string_view dst_path, std::string_view src_path) -> void;
+auto copy_file(std::string_view dst_path, std::string_view src_path) -> void;
+// Hard links `dst_path`, which must not exist, to the file at `src_path`.
+// Returns false if the file system can't, as across volumes.
+auto link_file(std::string_view dst_path, std::string_view src_path) -> bool;
 auto move_file_if_different(std::string_view dst_path, std::string_view src_path) -> bool;
 auto delete_file(std::string_view path) -> void;
 auto file_exists(std::string_view path) -> bool;
@@ -9,4 +9,33 @@ auto hash128(Span<const std::byte> data) -> Hash128 {
     return std::bit_cast<Hash128>(hash);
 }
 
+Hasher128::Hasher128()
+    : _state(XXH3_createState()) {
+    XXH3_128bits_reset(_state);
+}
+
+Hasher128::Hasher128(Hasher128&& other) noexcept
+    : _state(std::exchange(other._state, nullptr)) {}
+
+auto Hasher128::operator=(Hasher128&& other) noexcept -> Hasher128& {
+    if (this != &other) {
+        XXH3_freeState(_state);
+        _state = std::exchange(other._state, nullptr);
+    }
+    return *this;
+}
+
+Hasher128::~Hasher128() {
+    XXH3_freeState(_state);
+}
+
+auto Hasher128::update(Span<const std::byte> data) -> void {
+    XXH3_128bits_update(_state, data.data(), data.size());
+}
+
+auto Hasher128::digest() const -> Hash128 {
+    XXH128_hash_t hash = XXH3_128bits_digest(_state);
+    return std::bit_cast<Hash128>(hash);
+}
+
 } // namespace fb
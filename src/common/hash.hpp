@@ -2,15 +2,36 @@
 
 #include "pch.hpp"
 
+struct XXH3_state_s;
+
 namespace fb {
 
 struct Hash128 {
     uint64_t low;
     uint64_t high;
+
+    auto operator==(const Hash128&) const -> bool = default;
 };
 
 auto hash128(Span<const std::byte> data) -> Hash128;
 
+// Incremental hash128: the digest equals hash128 of all updates concatenated.
+class Hasher128 {
+public:
+    Hasher128();
+    Hasher128(const Hasher128&) = delete;
+    auto operator=(const Hasher128&) -> Hasher128& = delete;
+    Hasher128(Hasher128&& other) noexcept;
+    auto operator=(Hasher128&& other) noexcept -> Hasher128&;
+    ~Hasher128();
+
+    auto update(Span<const std::byte> data) -> void;
+    auto digest() const -> Hash128;
+
+private:
+    XXH3_state_s* _state = nullptr;
+};
+
 } // namespace fb
 
 template<>
@@ -20,3 +41,8 @@ struct std::formatter<fb::Hash128>: std::formatter<char> {
         return std::format_to(fc.out(), "{:016x}{:016x}", v.high, v.low);
     }
 };
+
+template<>
+struct std::hash<fb::Hash128> {
+    auto operator()(fb::Hash128 v) const noexcept -> size_t { return (size_t)v.low; }
+};
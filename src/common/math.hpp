@@ -33,6 +33,10 @@ FB_INLINE constexpr auto deg_from_rad(float rad) -> float {
     return rad * 180.0f / FLOAT_PI;
 }
 
+FB_INLINE constexpr auto align_up(size_t value, size_t alignment) -> size_t {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
 FB_INLINE constexpr auto mip_count_from_size(uint width, uint height) -> uint {
     uint mip_count = 1;
     while (width > 1 || height > 1) {
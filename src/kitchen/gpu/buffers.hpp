@@ -1,6 +1,7 @@
 #pragma once
 
 #include "device.hpp"
+#include <baked/baked_types.hpp>
 
 namespace fb {
 
@@ -296,4 +297,46 @@ using GpuBufferDeviceIndex = GpuBuffer<T, GpuBufferAccessMode::Device, GpuBuffer
 template<typename T>
 using GpuBufferDeviceSrvUav = GpuBuffer<T, GpuBufferAccessMode::Device, GpuBufferFlags::SrvUav>;
 
+// Index buffer of a baked mesh, in the 16-bit or 32-bit format it was baked
+// with.
+class GpuBufferDeviceMeshIndex {
+    FB_NO_COPY_MOVE(GpuBufferDeviceMeshIndex);
+
+public:
+    GpuBufferDeviceMeshIndex() = default;
+
+    template<typename BakedMesh>
+    auto create_and_transfer_baked(
+        GpuDevice& device,
+        const BakedMesh& mesh,
+        D3D12_BARRIER_SYNC sync_after,
+        D3D12_BARRIER_ACCESS access_after,
+        std::string_view name
+    ) -> void {
+        _format = mesh.index_format;
+        if (_format == DXGI_FORMAT_R16_UINT) {
+            _short_indices
+                .create_and_transfer(device, mesh.short_indices, sync_after, access_after, name);
+        } else {
+            FB_ASSERT(_format == DXGI_FORMAT_R32_UINT);
+            _indices.create_and_transfer(device, mesh.indices, sync_after, access_after, name);
+        }
+    }
+
+    auto format() const -> DXGI_FORMAT { return _format; }
+    auto element_count() const -> uint {
+        return _format == DXGI_FORMAT_R16_UINT ? _short_indices.element_count()
+                                               : _indices.element_count();
+    }
+    auto index_buffer_view() const -> D3D12_INDEX_BUFFER_VIEW {
+        return _format == DXGI_FORMAT_R16_UINT ? _short_indices.index_buffer_view()
+                                               : _indices.index_buffer_view();
+    }
+
+private:
+    DXGI_FORMAT _format = DXGI_FORMAT_UNKNOWN;
+    GpuBufferDeviceIndex<baked::ShortIndex> _short_indices;
+    GpuBufferDeviceIndex<baked::Index> _indices;
+};
+
 } // namespace fb
@@ -81,6 +81,82 @@ struct SkinningVertex {
     float4 weights;
 };
 
+// Compact vertices, laid out and decoded like in `baked_types.hpp`.
+struct CompactVertex {
+    uint position_xy;
+    uint position_z_tangent;
+    uint normal;
+    uint texcoord;
+};
+
+struct CompactSkinningVertex {
+    CompactVertex vertex;
+    uint joints;
+    uint weights;
+};
+
+struct VertexQuantization {
+    float3 position_min;
+    float3 position_scale;
+};
+
+float decode_snorm16(uint bits) {
+    return max(float(int(bits << 16) >> 16) / 32767.0f, -1.0f);
+}
+
+float3 decode_octahedral(float2 e) {
+    float3 n = float3(e.x, e.y, 1.0f - abs(e.x) - abs(e.y));
+    const float t = max(-n.z, 0.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return normalize(n);
+}
+
+void tangent_basis(float3 n, out float3 t0, out float3 t1) {
+    const float z_sign = n.z >= 0.0f ? 1.0f : -1.0f;
+    const float a = -1.0f / (z_sign + n.z);
+    const float b = n.x * n.y * a;
+    t0 = float3(1.0f + z_sign * n.x * n.x * a, z_sign * b, -z_sign * n.x);
+    t1 = float3(b, z_sign + n.y * n.y * a, -n.y);
+}
+
+Vertex decode_compact_vertex(CompactVertex v, VertexQuantization q) {
+    const float3 position = float3(
+        float(v.position_xy & 0xffff),
+        float(v.position_xy >> 16),
+        float(v.position_z_tangent & 0xffff)
+    );
+    const float3 normal =
+        decode_octahedral(float2(decode_snorm16(v.normal), decode_snorm16(v.normal >> 16)));
+    float3 t0;
+    float3 t1;
+    tangent_basis(normal, t0, t1);
+    const uint tangent_bits = v.position_z_tangent >> 16;
+    const float angle = float(tangent_bits & 0x7fff) * (FB_TWO_PI / 32767.0f) - FB_PI;
+
+    Vertex vertex;
+    vertex.position = q.position_min + position * q.position_scale;
+    vertex.normal = normal;
+    vertex.texcoord = float2(f16tof32(v.texcoord), f16tof32(v.texcoord >> 16));
+    vertex.tangent =
+        float4(t0 * cos(angle) + t1 * sin(angle), (tangent_bits & 0x8000) != 0 ? -1.0f : 1.0f);
+    return vertex;
+}
+
+SkinningVertex decode_compact_skinning_vertex(CompactSkinningVertex v, VertexQuantization q) {
+    const Vertex vertex = decode_compact_vertex(v.vertex, q);
+    const uint4 shifts = uint4(0, 8, 16, 24);
+
+    SkinningVertex skinning_vertex;
+    skinning_vertex.position = vertex.position;
+    skinning_vertex.normal = vertex.normal;
+    skinning_vertex.texcoord = vertex.texcoord;
+    skinning_vertex.tangent = vertex.tangent;
+    skinning_vertex.joints = (v.joints >> shifts) & 0xff;
+    skinning_vertex.weights = float4((v.weights >> shifts) & 0xff) / 255.0f;
+    return skinning_vertex;
+}
+
 //
 // Utilities.
 //
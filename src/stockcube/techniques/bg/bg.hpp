@@ -16,7 +16,7 @@ struct Technique {
     uint rad_texture_mip_count;
     KcnMultibuffer<GpuBufferHostCbv<Constants>, FRAME_COUNT> constants;
     GpuBufferDeviceSrv<baked::Vertex> vertices;
-    GpuBufferDeviceIndex<baked::Index> indices;
+    GpuBufferDeviceMeshIndex indices;
     GpuPipeline pipeline;
     Parameters parameters;
 };
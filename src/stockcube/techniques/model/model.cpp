@@ -24,9 +24,9 @@ auto create(Technique& tech, const CreateDesc& desc) -> void {
         D3D12_BARRIER_ACCESS_VERTEX_BUFFER,
         debug.with_name("Vertices")
     );
-    tech.indices.create_and_transfer(
+    tech.indices.create_and_transfer_baked(
         device,
-        mesh.indices,
+        mesh,
         D3D12_BARRIER_SYNC_INDEX_INPUT,
         D3D12_BARRIER_ACCESS_INDEX_BUFFER,
         debug.with_name("Indices")
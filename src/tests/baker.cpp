@@ -0,0 +1,2355 @@
+#include <common/common.hpp>
+#include <baker/assets/cache.hpp>
+#include <baker/assets/mesh_bounds.hpp>
+#include <baker/assets/mesh_indices.hpp>
+#include <baker/assets/mesh_lod.hpp>
+#include <baker/assets/mesh_meshlets.hpp>
+#include <baker/assets/mesh_order.hpp>
+#include <baker/assets/mesh_quantize.hpp>
+#include <baker/assets/mesh_weld.hpp>
+#include <baker/assets/tasks.hpp>
+#include <baker/farm/farm.hpp>
+#include <baker/formats/gltf.hpp>
+#include <baker/formats/mikktspace.hpp>
+#include <baker/formats/synthetic.hpp>
+#include <baker/outputs/bins.hpp>
+#include <baker/outputs/emitter.hpp>
+#include <baker/outputs/watch.hpp>
+#include <baker/shaders/shaders.hpp>
+#include <baker/utils/names.hpp>
+#include <baker/utils/shared_cache.hpp>
+#include <baked/baked_types.hpp>
+#include <catch_amalgamated.hpp>
+#include <nlohmann/json.hpp>
+
+using namespace fb;
+
+//
+// Helpers.
+//
+
+static auto test_assets_dir() -> std::string {
+    return std::format("{}/src/assets", FB_BAKER_SOURCE_DIR);
+}
+
+static auto asset_spans(Asset asset) -> std::vector<std::tuple<std::string, size_t, size_t>> {
+    auto spans = std::vector<std::tuple<std::string, size_t, size_t>>();
+    for_each_asset_span(asset, [&](const AssetSpan& span) {
+        spans.emplace_back(span.type, span.offset, span.byte_count);
+    });
+    return spans;
+}
+
+// Bakes to a temporary bin and reads it back.
+static auto bake_assets_file(
+    ThreadPool& pool,
+    BakeProfiler& profiler,
+    AssetCache& cache,
+    AssetTaskMemo& memo,
+    std::string_view assets_dir,
+    Span<const AssetTask> asset_tasks,
+    BakeFarm* farm = nullptr
+) -> std::tuple<std::vector<Asset>, AssetsBin, std::vector<std::byte>> {
+    const auto path = create_temp_path();
+    auto writer = FileWriter(path);
+    auto [assets, bin] =
+        bake_assets(pool, profiler, cache, memo, assets_dir, asset_tasks, writer, farm);
+    writer.close();
+    auto bytes = std::vector<std::byte>();
+    if (bin.byte_count > 0) {
+        const auto file = FileBuffer::from_path(path);
+        bytes.assign(file.as_span().begin(), file.as_span().end());
+    }
+    FB_ASSERT(bytes.size() == bin.byte_count);
+    FB_ASSERT(hash128(bytes) == bin.hash);
+    delete_file(path);
+    return {std::move(assets), std::move(bin), std::move(bytes)};
+}
+
+static auto bake_assets_bytes(
+    ThreadPool& pool,
+    AssetCache& cache,
+    AssetTaskMemo& memo,
+    std::string_view assets_dir,
+    Span<const AssetTask> asset_tasks
+) -> std::tuple<std::vector<Asset>, std::vector<std::byte>> {
+    auto profiler = BakeProfiler();
+    auto [assets, bin, bytes] =
+        bake_assets_file(pool, profiler, cache, memo, assets_dir, asset_tasks);
+    return {std::move(assets), std::move(bytes)};
+}
+
+static const auto PROCEDURAL_AND_TEXTURE_TASKS = std::to_array<AssetTask>({
+    AssetTaskTexture {
+        "heatmap_magma",
+        "heatmaps/magma.png",
+        GLTF_BASE_COLOR_TEXTURE_FORMAT,
+        AssetColorSpace::Srgb,
+    },
+    AssetTaskTexture {
+        "heatmap_viridis",
+        "heatmaps/viridis.png",
+        GLTF_BASE_COLOR_TEXTURE_FORMAT,
+        AssetColorSpace::Srgb,
+    },
+    AssetTaskTexture {
+        "sand",
+        "models/sand.png",
+        GLTF_BASE_COLOR_TEXTURE_FORMAT,
+        AssetColorSpace::Srgb,
+    },
+    AssetTaskTexture {
+        "metal_color",
+        "models/Metal046B_1K-PNG/Metal046B_1K_Color.png",
+        GLTF_BASE_COLOR_TEXTURE_FORMAT,
+        AssetColorSpace::Srgb,
+    },
+    AssetTaskTexture {
+        "metal_roughness",
+        "models/Metal046B_1K-PNG/Metal046B_1K_Roughness.png",
+        GLTF_METALLIC_ROUGHNESS_TEXTURE_FORMAT,
+        AssetColorSpace::Linear,
+    },
+    AssetTaskTexture {
+        "metal_metalness",
+        "models/Metal046B_1K-PNG/Metal046B_1K_Metalness.png",
+        GLTF_METALLIC_ROUGHNESS_TEXTURE_FORMAT,
+        AssetColorSpace::Linear,
+    },
+    AssetTaskProceduralCube {"cube", 2.0f, false},
+    AssetTaskProceduralCube {"skybox", 2.0f, true},
+    AssetTaskProceduralSphere {"sphere", 1.0f, 256, false},
+    AssetTaskProceduralLowPolyGround {
+        .name = "ground",
+        .vertex_count_x = 256,
+        .vertex_count_y = 256,
+        .side_length = 1.5f,
+        .height_variation = 0.5f,
+    },
+    AssetTaskProceduralTexturedPlane {
+        "plane",
+        1024,
+        4.0f,
+        RgbaFloat(0.125f, 0.125f, 0.125f, 1.0f),
+        RgbaFloat(1.0f, 1.0f, 1.0f, 1.0f),
+    },
+});
+
+// Deterministic stand-in for DXC. The "DXIL" is the entry point followed by
+// the source bytes, and the bytes of every `#include <...>` in it, which lets
+// tests check what was compiled from what.
+struct FakeShaderCompiler {
+    std::atomic<uint>* compile_count = nullptr;
+
+    auto arguments(std::string_view name, ShaderType, std::string_view entry_point) const
+        -> std::vector<std::wstring> {
+        return {to_wstr(name), L"-E", to_wstr(entry_point)};
+    }
+
+    auto compile(
+        std::string_view name,
+        ShaderType type,
+        std::string_view entry_point,
+        Span<const std::byte> source,
+        ShaderDependencies& dependencies,
+        bool
+    ) const -> Shader {
+        if (compile_count) {
+            (*compile_count)++;
+        }
+        auto dxil = std::vector<std::byte>();
+        for (const auto c : entry_point) {
+            dxil.push_back((std::byte)c);
+        }
+        preprocess(source, dependencies, dxil);
+        return Shader {
+            .name = std::string(name),
+            .hash = std::format("{}", hash128(dxil)),
+            .dxil = dxil,
+            .pdb = {},
+            .disassembly = {'\0'},
+            .counters = {.instruction_count = (uint)type},
+        };
+    }
+
+    static auto preprocess(
+        Span<const std::byte> source,
+        ShaderDependencies& dependencies,
+        std::vector<std::byte>& output
+    ) -> void {
+        output.insert(output.end(), source.begin(), source.end());
+        const auto text = std::string_view((const char*)source.data(), source.size());
+        constexpr auto directive = "#include <"sv;
+        for (auto pos = text.find(directive); pos != std::string_view::npos;
+             pos = text.find(directive, pos + 1)) {
+            const auto begin = pos + directive.size();
+            const auto end = text.find('>', begin);
+            const auto include = dependencies.load(text.substr(begin, end - begin));
+            FB_ASSERT(include.has_value());
+            preprocess(include.value(), dependencies, output);
+        }
+    }
+};
+
+static auto fake_shader_source(std::string_view text) -> std::vector<std::byte> {
+    const auto bytes = std::as_bytes(Span(text));
+    return std::vector<std::byte>(bytes.begin(), bytes.end());
+}
+
+// Launches bake farm workers as threads, which stand in for processes, and
+// have none. Worker `i` fails with `fault` after `job_limits[i]` jobs, if it
+// has one.
+static auto thread_bake_workers(
+    std::vector<std::jthread>& threads,
+    std::vector<uint> job_limits,
+    BakeWorkerFault fault = BakeWorkerFault::Crash
+) -> BakeWorkerLauncher {
+    return [&threads, job_limits, fault](uint16_t port) {
+        const auto index = threads.size();
+        const auto job_limit = index < job_limits.size() ? job_limits[index] : UINT_MAX;
+        threads.emplace_back([port, job_limit, fault]() {
+            run_bake_worker(port, []() { return FakeShaderCompiler(); }, job_limit, fault);
+        });
+        return Option<BakeWorkerProcess>(BakeWorkerProcess {});
+    };
+}
+
+//
+// Tests.
+//
+
+TEST_CASE("bake_assets - parallel matches serial", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    const auto tasks = Span<const AssetTask>(PROCEDURAL_AND_TEXTURE_TASKS);
+    auto serial_pool = ThreadPool(0);
+    auto parallel_pool = ThreadPool();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+    const auto [serial_assets, serial_bin] =
+        bake_assets_bytes(serial_pool, no_cache, no_memo, assets_dir, tasks);
+    const auto [parallel_assets, parallel_bin] =
+        bake_assets_bytes(parallel_pool, no_cache, no_memo, assets_dir, tasks);
+
+    // Byte-for-byte identical output.
+    REQUIRE(serial_bin.size() == parallel_bin.size());
+    REQUIRE(std::memcmp(serial_bin.data(), parallel_bin.data(), serial_bin.size()) == 0);
+    REQUIRE(serial_assets.size() == parallel_assets.size());
+    for (size_t i = 0; i < serial_assets.size(); i++) {
+        REQUIRE(asset_name(serial_assets[i]) == asset_name(parallel_assets[i]));
+        REQUIRE(asset_spans(serial_assets[i]) == asset_spans(parallel_assets[i]));
+    }
+}
+
+// Hidden, run with `fb_tests [bake]`.
+TEST_CASE("bake_assets - serial and parallel throughput", "[baker][benchmark][.bake]") {
+    const auto assets_dir = test_assets_dir();
+    const auto tasks = Span<const AssetTask>(PROCEDURAL_AND_TEXTURE_TASKS);
+    auto serial_pool = ThreadPool(0);
+    auto parallel_pool = ThreadPool();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+
+    const auto serial_timer = Instant();
+    bake_assets_bytes(serial_pool, no_cache, no_memo, assets_dir, tasks);
+    const auto serial_time = serial_timer.elapsed_time();
+    const auto parallel_timer = Instant();
+    bake_assets_bytes(parallel_pool, no_cache, no_memo, assets_dir, tasks);
+    const auto parallel_time = parallel_timer.elapsed_time();
+    FB_LOG_INFO(
+        "bake_assets: serial {:.3f} s, parallel {:.3f} s, speedup {:.2f}x ({} threads)",
+        serial_time,
+        parallel_time,
+        serial_time / parallel_time,
+        parallel_pool.thread_count()
+    );
+
+    BENCHMARK("bake_assets - serial") {
+        return bake_assets_bytes(serial_pool, no_cache, no_memo, assets_dir, tasks);
+    };
+    BENCHMARK("bake_assets - parallel") {
+        return bake_assets_bytes(parallel_pool, no_cache, no_memo, assets_dir, tasks);
+    };
+}
+
+TEST_CASE("bake_assets - cache round trip", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    const auto tasks = Span<const AssetTask>(PROCEDURAL_AND_TEXTURE_TASKS);
+    auto pool = ThreadPool();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+    auto cache = AssetCache(std::format("{}.dir", create_temp_path()));
+
+    // Keys depend on parameters.
+    const auto cube = AssetTask(AssetTaskProceduralCube {"cube", 2.0f, false});
+    const auto inverted_cube = AssetTask(AssetTaskProceduralCube {"cube", 2.0f, true});
+    REQUIRE(asset_task_key(assets_dir, cube) == asset_task_key(assets_dir, cube));
+    REQUIRE(asset_task_key(assets_dir, cube) != asset_task_key(assets_dir, inverted_cube));
+
+    // Cold, then warm.
+    const auto [expected_assets, expected_bin] =
+        bake_assets_bytes(pool, no_cache, no_memo, assets_dir, tasks);
+    const auto [cold_assets, cold_bin] = bake_assets_bytes(pool, cache, no_memo, assets_dir, tasks);
+    REQUIRE(cache.hit_count() == 0);
+    REQUIRE(cache.miss_count() == tasks.size());
+    const auto [warm_assets, warm_bin] = bake_assets_bytes(pool, cache, no_memo, assets_dir, tasks);
+    REQUIRE(cache.hit_count() == tasks.size());
+    REQUIRE(cache.miss_count() == tasks.size());
+
+    // Cached output is identical to a fresh bake.
+    REQUIRE(cold_bin == expected_bin);
+    REQUIRE(warm_bin == expected_bin);
+    REQUIRE(warm_assets.size() == expected_assets.size());
+    for (size_t i = 0; i < expected_assets.size(); i++) {
+        REQUIRE(warm_assets[i].index() == expected_assets[i].index());
+        REQUIRE(asset_name(warm_assets[i]) == asset_name(expected_assets[i]));
+        REQUIRE(asset_spans(warm_assets[i]) == asset_spans(expected_assets[i]));
+    }
+}
+
+TEST_CASE("SharedCacheDirectory - corrupted entries miss", "[baker]") {
+    const auto dir = std::format("{}.dir", create_temp_path());
+    auto storage = SharedCacheDirectory(dir);
+    const auto key = Hash128 {.low = 1, .high = 2};
+    const auto value = std::vector<std::byte>(64, std::byte(0x2a));
+
+    REQUIRE(!storage.get(key).has_value());
+    REQUIRE(storage.put(key, value));
+    REQUIRE(storage.get(key) == value);
+
+    // Flip the last byte of the value.
+    const auto path = std::format("{}/{}.blob", dir, key);
+    const auto file = FileBuffer::from_path(path);
+    auto bytes = std::vector<std::byte>(file.as_span().begin(), file.as_span().end());
+    bytes.back() ^= std::byte(1);
+    write_whole_file(path, bytes);
+    REQUIRE(!storage.get(key).has_value());
+}
+
+TEST_CASE("bake_assets - shared cache server", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    const auto tasks = Span<const AssetTask>(PROCEDURAL_AND_TEXTURE_TASKS);
+    auto pool = ThreadPool();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+    auto server = SharedCacheServer(std::format("{}.dir", create_temp_path()));
+    const auto [expected_assets, expected_bin] =
+        bake_assets_bytes(pool, no_cache, no_memo, assets_dir, tasks);
+
+    // A first machine misses, and shares its outputs.
+    {
+        auto client = SharedCacheClient(SharedCacheConnection(server.port()));
+        auto cache = AssetCache(std::format("{}.dir", create_temp_path()), &client);
+        const auto [assets, bin] = bake_assets_bytes(pool, cache, no_memo, assets_dir, tasks);
+        client.flush();
+        REQUIRE(bin == expected_bin);
+        REQUIRE(cache.miss_count() == tasks.size());
+        REQUIRE(client.miss_count() == tasks.size());
+        REQUIRE(client.put_count() == tasks.size());
+    }
+
+    // A second machine, with an empty local cache, hits every task.
+    {
+        auto client = SharedCacheClient(SharedCacheConnection(server.port()));
+        auto cache = AssetCache(std::format("{}.dir", create_temp_path()), &client);
+        const auto [assets, bin] = bake_assets_bytes(pool, cache, no_memo, assets_dir, tasks);
+        client.flush();
+        REQUIRE(bin == expected_bin);
+        REQUIRE(cache.hit_count() == tasks.size());
+        REQUIRE(client.hit_count() == tasks.size());
+        REQUIRE(client.put_count() == 0);
+    }
+
+    // An unreachable server degrades to local bakes.
+    {
+        auto client = SharedCacheClient(SharedCacheConnection(0));
+        auto cache = AssetCache(std::format("{}.dir", create_temp_path()), &client);
+        const auto [assets, bin] = bake_assets_bytes(pool, cache, no_memo, assets_dir, tasks);
+        client.flush();
+        REQUIRE(bin == expected_bin);
+        REQUIRE(cache.miss_count() == tasks.size());
+        REQUIRE(client.put_count() == 0);
+    }
+}
+
+TEST_CASE("bake_assets - shared tasks bake once", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    const auto a_tasks = std::to_array<AssetTask>({
+        AssetTaskProceduralCube {"skybox", 2.0f, true},
+        AssetTaskProceduralSphere {"sphere", 1.0f, 32, false},
+        AssetTaskProceduralCube {"light_bounds", 2.0f, false},
+    });
+    const auto b_tasks = std::to_array<AssetTask>({
+        AssetTaskProceduralSphere {"sphere", 1.0f, 32, false},
+        AssetTaskProceduralCube {"skybox", 2.0f, true},
+        AssetTaskProceduralSphere {"sphere", 1.0f, 64, false},
+    });
+    const auto task_lists = std::to_array<Span<const AssetTask>>({a_tasks, b_tasks});
+    auto pool = ThreadPool();
+    auto no_cache = AssetCache();
+
+    // Independent bakes.
+    auto expected = std::vector<std::tuple<std::vector<Asset>, std::vector<std::byte>>>();
+    for (const auto& tasks : task_lists) {
+        auto no_memo = AssetTaskMemo();
+        expected.push_back(bake_assets_bytes(pool, no_cache, no_memo, assets_dir, tasks));
+    }
+
+    // Concurrent bakes through one memo, like apps in the baker.
+    auto memo = AssetTaskMemo();
+    for (const auto& tasks : task_lists) {
+        for (const auto& task : tasks) {
+            memo.expect(asset_task_params_key(task));
+        }
+    }
+    auto outputs = std::vector<std::tuple<std::vector<Asset>, std::vector<std::byte>>>(2);
+    pool.parallel_for(task_lists.size(), [&](size_t i) {
+        outputs[i] = bake_assets_bytes(pool, no_cache, memo, assets_dir, task_lists[i]);
+    });
+
+    // The skybox and the 32 sphere were baked once, and each app got the same
+    // output as on its own.
+    REQUIRE(memo.reuse_count() == 2);
+    for (size_t i = 0; i < task_lists.size(); i++) {
+        const auto& [expected_assets, expected_bin] = expected[i];
+        const auto& [assets, bin] = outputs[i];
+        REQUIRE(bin == expected_bin);
+        REQUIRE(assets.size() == expected_assets.size());
+        for (size_t j = 0; j < assets.size(); j++) {
+            REQUIRE(asset_name(assets[j]) == asset_name(expected_assets[j]));
+            REQUIRE(asset_spans(assets[j]) == asset_spans(expected_assets[j]));
+        }
+    }
+}
+
+TEST_CASE("bake_assets - streamed bin matches task bins", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    const auto tasks = Span<const AssetTask>(PROCEDURAL_AND_TEXTURE_TASKS);
+    auto pool = ThreadPool();
+    auto profiler = BakeProfiler();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+
+    // Reference: every task baked on its own, its bin read whole.
+    auto task_assets = std::vector<Asset>();
+    auto task_bins = std::vector<std::vector<std::byte>>();
+    auto task_bin_indices = std::vector<size_t>();
+    for (const auto& task : tasks) {
+        auto output = bake_asset_task(assets_dir, task);
+        for (auto& asset : output.assets) {
+            task_assets.push_back(std::move(asset));
+            task_bin_indices.push_back(task_bins.size());
+        }
+        task_bins.push_back(output.bin->read());
+    }
+
+    // Streamed.
+    const auto [assets, bin, bytes] =
+        bake_assets_file(pool, profiler, no_cache, no_memo, assets_dir, tasks);
+
+    // Every span holds the bytes its task baked, aligned, and the bin is the
+    // stored spans and their padding, nothing else.
+    REQUIRE(assets.size() == task_assets.size());
+    auto span_byte_count = size_t(0);
+    for (size_t i = 0; i < assets.size(); i++) {
+        REQUIRE(asset_name(assets[i]) == asset_name(task_assets[i]));
+        auto task_spans = std::vector<AssetSpan>();
+        for_each_asset_span(task_assets[i], [&](const AssetSpan& span) {
+            task_spans.push_back(span);
+        });
+        auto span_index = size_t(0);
+        for_each_asset_span(assets[i], [&](const AssetSpan& span) {
+            const auto& task_span = task_spans[span_index++];
+            const auto& task_bin = task_bins[task_bin_indices[i]];
+            REQUIRE(span.byte_count == task_span.byte_count);
+            REQUIRE(span.hash == task_span.hash);
+            REQUIRE(span.offset % span.alignment == 0);
+            REQUIRE(span.offset + span.byte_count <= bytes.size());
+            REQUIRE(std::memcmp(
+                        bytes.data() + span.offset,
+                        task_bin.data() + task_span.offset,
+                        span.byte_count
+                    )
+                    == 0);
+            span_byte_count += span.byte_count;
+        });
+        REQUIRE(span_index == task_spans.size());
+    }
+    REQUIRE(
+        bin.byte_count
+        == span_byte_count - bin.deduplicated_byte_count + bin.padding_byte_count
+    );
+}
+
+TEST_CASE("bake_assets - deduplicated spans", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    const auto sphere_tasks = std::to_array<AssetTask>({
+        AssetTaskProceduralSphere {"sphere", 1.0f, 64, false},
+    });
+    const auto repeated_tasks = std::to_array<AssetTask>({
+        AssetTaskProceduralSphere {"sphere", 1.0f, 64, false},
+        AssetTaskProceduralSphere {"other_sphere", 1.0f, 64, false},
+    });
+    auto pool = ThreadPool();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+    auto profiler = BakeProfiler();
+
+    const auto [sphere_assets, sphere_bin, sphere_bytes] =
+        bake_assets_file(pool, profiler, no_cache, no_memo, assets_dir, sphere_tasks);
+    const auto [repeated_assets, repeated_bin, repeated_bytes] =
+        bake_assets_file(pool, profiler, no_cache, no_memo, assets_dir, repeated_tasks);
+
+    // The second sphere is stored once, and points at the first one.
+    REQUIRE(sphere_bin.deduplicated_byte_count == 0);
+    REQUIRE(repeated_bin.byte_count == sphere_bin.byte_count);
+    REQUIRE(repeated_bin.deduplicated_byte_count == sphere_bin.byte_count);
+    REQUIRE(repeated_bin.hash == sphere_bin.hash);
+    REQUIRE(repeated_assets.size() == 2 * sphere_assets.size());
+    for (size_t i = 0; i < sphere_assets.size(); i++) {
+        const auto& other_asset = repeated_assets[sphere_assets.size() + i];
+        REQUIRE(asset_spans(repeated_assets[i]) == asset_spans(other_asset));
+        REQUIRE(asset_spans(repeated_assets[i]) == asset_spans(sphere_assets[i]));
+    }
+    REQUIRE(repeated_bytes == sphere_bytes);
+}
+
+TEST_CASE("bake_assets - profile", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    const auto tasks = std::to_array<AssetTask>({
+        AssetTaskProceduralSphere {"sphere", 1.0f, 64, false},
+        AssetTaskProceduralTexturedPlane {
+            "plane",
+            256,
+            4.0f,
+            RgbaFloat(0.125f, 0.125f, 0.125f, 1.0f),
+            RgbaFloat(1.0f, 1.0f, 1.0f, 1.0f),
+        },
+    });
+    auto pool = ThreadPool(2);
+    auto profiler = BakeProfiler();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+    const auto [assets, bin, bytes] =
+        bake_assets_file(pool, profiler, no_cache, no_memo, assets_dir, tasks);
+
+    // One zone per task, with the bytes it produced, and nested steps on the
+    // same thread, within their task.
+    const auto zones = profiler.zones();
+    auto task_byte_count = size_t(0);
+    auto task_zones = std::vector<BakeZone>();
+    for (const auto& zone : zones) {
+        if (zone.depth == 0) {
+            REQUIRE(zone.category == "asset");
+            REQUIRE(zone.byte_count > 0);
+            task_byte_count += zone.byte_count;
+            task_zones.push_back(zone);
+        }
+    }
+    REQUIRE(task_zones.size() == tasks.size());
+    REQUIRE(
+        task_byte_count
+        == bin.byte_count + bin.deduplicated_byte_count - bin.padding_byte_count
+    );
+    for (const auto step_name : {"tangents"sv, "mipmaps"sv}) {
+        const auto step = std::find_if(zones.begin(), zones.end(), [&](const BakeZone& zone) {
+            return zone.name == step_name;
+        });
+        REQUIRE(step != zones.end());
+        REQUIRE(step->category == "step");
+        REQUIRE(step->depth == 1);
+        const auto parent =
+            std::find_if(task_zones.begin(), task_zones.end(), [&](const BakeZone& zone) {
+                return zone.thread_id == step->thread_id && zone.start_time <= step->start_time
+                    && step->start_time + step->duration <= zone.start_time + zone.duration;
+            });
+        REQUIRE(parent != task_zones.end());
+    }
+
+    // Summary lists tasks slowest first.
+    std::sort(task_zones.begin(), task_zones.end(), [](const BakeZone& a, const BakeZone& b) {
+        return a.duration > b.duration;
+    });
+    const auto summary = profiler.summary();
+    const auto first = summary.find(task_zones[0].name);
+    const auto second = summary.find(task_zones[1].name);
+    REQUIRE(first != std::string::npos);
+    REQUIRE(second != std::string::npos);
+    REQUIRE(first < second);
+
+    // Chrome trace has one complete event per zone.
+    const auto trace = json::parse(profiler.chrome_trace());
+    REQUIRE(trace["traceEvents"].size() == zones.size());
+    for (const auto& event : trace["traceEvents"]) {
+        REQUIRE(event["ph"] == "X");
+        REQUIRE(event["dur"].get<double>() >= 0.0);
+    }
+    REQUIRE(trace["otherData"]["peak_memory"].get<size_t>() > 0);
+}
+
+// Triangles as source vertices, each rotated to start at its lowest vertex,
+// in sorted order.
+static auto source_triangles(Span<const AssetIndex> indices, Span<const uint> vertex_order)
+    -> std::vector<std::array<uint, 3>> {
+    auto triangles = std::vector<std::array<uint, 3>>();
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        auto triangle = std::array<uint, 3> {
+            vertex_order[indices[i + 0]],
+            vertex_order[indices[i + 1]],
+            vertex_order[indices[i + 2]],
+        };
+        const auto lowest = std::min_element(triangle.begin(), triangle.end());
+        std::rotate(triangle.begin(), lowest, triangle.end());
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+TEST_CASE("optimize_mesh_order - vertex cache, overdraw and fetch", "[baker]") {
+    // Displaced grid.
+    static constexpr uint GRID_SIZE = 32;
+    auto positions = std::vector<float3>();
+    for (uint y = 0; y <= GRID_SIZE; y++) {
+        for (uint x = 0; x <= GRID_SIZE; x++) {
+            positions.emplace_back((float)x, std::sin((float)x) * std::cos((float)y), (float)y);
+        }
+    }
+    auto indices = std::vector<AssetIndex>();
+    for (uint y = 0; y < GRID_SIZE; y++) {
+        for (uint x = 0; x < GRID_SIZE; x++) {
+            const auto a = y * (GRID_SIZE + 1) + x;
+            const auto c = a + GRID_SIZE + 1;
+            indices.insert(indices.end(), {a, c, a + 1, a + 1, c, c + 1});
+        }
+    }
+
+    // Two submeshes, the first half of the rows and the second, shuffled.
+    const auto half = (uint)indices.size() / 6 * 3;
+    const auto submeshes = std::to_array<AssetSubmesh>({
+        {.index_count = half, .start_index = 0, .base_vertex = 0},
+        {.index_count = (uint)indices.size() - half, .start_index = half, .base_vertex = 0},
+    });
+    auto rand = Pcg();
+    for (const auto& submesh : submeshes) {
+        auto* triangles = &indices[submesh.start_index];
+        for (uint t = submesh.index_count / 3 - 1; t > 0; t--) {
+            const auto other = rand.random_uint() % (t + 1);
+            std::swap_ranges(&triangles[t * 3], &triangles[t * 3 + 3], &triangles[other * 3]);
+        }
+    }
+    auto optimized = indices;
+    const auto [vertex_order, stats] = optimize_mesh_order(optimized, submeshes, positions);
+
+    // Same triangles, in the same submeshes.
+    auto identity = std::vector<uint>(positions.size());
+    for (uint i = 0; i < identity.size(); i++) {
+        identity[i] = i;
+    }
+    for (const auto& submesh : submeshes) {
+        const auto source = Span<const AssetIndex>(indices).subspan(submesh.start_index);
+        const auto baked = Span<const AssetIndex>(optimized).subspan(submesh.start_index);
+        REQUIRE(
+            source_triangles(baked.first(submesh.index_count), vertex_order)
+            == source_triangles(source.first(submesh.index_count), identity)
+        );
+    }
+
+    // Vertices in order of first use.
+    auto next_vertex = 0u;
+    for (const auto index : optimized) {
+        REQUIRE(index <= next_vertex);
+        next_vertex = std::max(next_vertex, index + 1);
+    }
+
+    // Better cache use.
+    const auto miss_count = [&](Span<const AssetIndex> mesh_indices) {
+        auto count = 0u;
+        for (const auto& submesh : submeshes) {
+            const auto submesh_indices =
+                mesh_indices.subspan(submesh.start_index, submesh.index_count);
+            count += vertex_cache_miss_count(submesh_indices, (uint)positions.size());
+        }
+        return count;
+    };
+    REQUIRE(stats.triangle_count == GRID_SIZE * GRID_SIZE * 2);
+    REQUIRE(stats.vertex_count == positions.size());
+    REQUIRE(stats.source_miss_count == miss_count(indices));
+    REQUIRE(stats.miss_count == miss_count(optimized));
+    REQUIRE((float)stats.source_miss_count / (float)stats.triangle_count > 2.5f);
+    REQUIRE((float)stats.miss_count / (float)stats.triangle_count < 1.0f);
+
+    // Deterministic.
+    auto optimized_again = indices;
+    const auto [vertex_order_again, stats_again] =
+        optimize_mesh_order(optimized_again, submeshes, positions);
+    REQUIRE(optimized_again == optimized);
+    REQUIRE(vertex_order_again == vertex_order);
+    REQUIRE(stats_again.miss_count == stats.miss_count);
+}
+
+TEST_CASE("optimize_mesh_order - baked meshes", "[baker]") {
+    const auto tasks = std::to_array<AssetTask>({
+        AssetTaskProceduralCube {"cube", 2.0f, false},
+        AssetTaskProceduralSphere {"sphere", 1.0f, 64, false},
+        AssetTaskProceduralLowPolyGround {
+            .name = "ground",
+            .vertex_count_x = 32,
+            .vertex_count_y = 32,
+            .side_length = 1.5f,
+            .height_variation = 0.5f,
+        },
+    });
+    for (const auto& task : tasks) {
+        const auto output = bake_asset_task(test_assets_dir(), task);
+        const auto& mesh = std::get<AssetMesh>(output.assets[0]);
+        REQUIRE(mesh.stats.vertex_count == mesh.vertices.element_count);
+        REQUIRE(mesh.index_format == DXGI_FORMAT_R16_UINT);
+        REQUIRE(mesh.stats.triangle_count * 3 == mesh.short_indices.element_count);
+        REQUIRE(mesh.stats.miss_count <= mesh.stats.source_miss_count);
+        REQUIRE(total_mesh_stats(output.assets).miss_count == mesh.stats.miss_count);
+    }
+}
+
+TEST_CASE("weld_vertices - exact and epsilon", "[baker]") {
+    const auto vertex = [](float x, float u) {
+        return AssetVertex {
+            .position = float3(x, 0.0f, 0.0f),
+            .normal = FLOAT3_Y,
+            .texcoord = float2(u, 0.0f),
+            .tangent = float4(1.0f, 0.0f, 0.0f, 1.0f),
+        };
+    };
+    const auto source_vertices = std::vector<AssetVertex> {
+        vertex(0.0f, 0.0f),
+        vertex(1.0f, 0.0f),
+        vertex(0.0f, 0.0f),
+        vertex(-0.0f, 0.0f),
+        vertex(1.0001f, 0.0f),
+        vertex(1.0f, 0.5f),
+    };
+    const auto source_indices = std::vector<AssetIndex> {0, 1, 2, 3, 4, 5};
+    auto vertices = source_vertices;
+    auto indices = source_indices;
+
+    SECTION("exact") {
+        weld_vertices(vertices, Span<AssetIndex>(indices), WeldEpsilons {});
+        REQUIRE(vertices.size() == 5);
+        REQUIRE(indices == std::vector<AssetIndex> {0, 1, 0, 2, 3, 4});
+    }
+
+    SECTION("epsilon") {
+        weld_vertices(vertices, Span<AssetIndex>(indices), WeldEpsilons {.position = 0.001f});
+        REQUIRE(vertices.size() == 3);
+        REQUIRE(indices == std::vector<AssetIndex> {0, 1, 0, 0, 1, 2});
+        REQUIRE(vertices[1].position.x == 1.0f);
+    }
+
+    // Every corner still has the attributes of its source vertex.
+    for (size_t i = 0; i < indices.size(); i++) {
+        REQUIRE(vertices[indices[i]].texcoord == source_vertices[source_indices[i]].texcoord);
+    }
+}
+
+// Hidden, run with `fb_tests [weld]`.
+TEST_CASE("weld_vertices - throughput", "[baker][benchmark][.weld]") {
+    // Corners of a grid of a million vertices.
+    static constexpr uint GRID_SIZE = 1024;
+    static constexpr auto QUAD_CORNERS = std::to_array<uint2>({
+        {0, 0},
+        {0, 1},
+        {1, 0},
+        {1, 0},
+        {0, 1},
+        {1, 1},
+    });
+    auto vertices = std::vector<AssetVertex>();
+    for (uint y = 0; y < GRID_SIZE; y++) {
+        for (uint x = 0; x < GRID_SIZE; x++) {
+            for (const auto corner : QUAD_CORNERS) {
+                const auto position = float3((float)(x + corner.x), 0.0f, (float)(y + corner.y));
+                vertices.push_back(
+                    AssetVertex {
+                        .position = position,
+                        .normal = FLOAT3_Y,
+                        .texcoord = float2(position.x, position.z) / (float)GRID_SIZE,
+                        .tangent = float4(1.0f, 0.0f, 0.0f, 1.0f),
+                    }
+                );
+            }
+        }
+    }
+    auto indices = std::vector<AssetIndex>(vertices.size());
+    for (uint i = 0; i < indices.size(); i++) {
+        indices[i] = i;
+    }
+
+    const auto corner_count = vertices.size();
+    const auto timer = Instant();
+    weld_vertices(vertices, Span<AssetIndex>(indices), WeldEpsilons {});
+    const auto time = timer.elapsed_time();
+    REQUIRE(vertices.size() == (GRID_SIZE + 1) * (GRID_SIZE + 1));
+    FB_LOG_INFO(
+        "weld_vertices: {} -> {} vertices in {:.3f} s, {:.1f} MB/s, {:.1f} Mvertices/s",
+        corner_count,
+        vertices.size(),
+        time,
+        (double)(corner_count * sizeof(AssetVertex)) / (1024.0 * 1024.0) / time,
+        (double)corner_count / time / 1e6
+    );
+}
+
+TEST_CASE("build_meshlets - coverage and bounds", "[baker]") {
+    // Displaced grid, twice. The second copy is shuffled, and indexed from its
+    // base vertex.
+    static constexpr uint GRID_SIZE = 48;
+    auto positions = std::vector<float3>();
+    for (uint copy = 0; copy < 2; copy++) {
+        for (uint y = 0; y <= GRID_SIZE; y++) {
+            for (uint x = 0; x <= GRID_SIZE; x++) {
+                const auto height = std::sin(0.3f * (float)x) * std::cos(0.2f * (float)y);
+                positions.emplace_back((float)(x + copy * 2 * GRID_SIZE), height, (float)y);
+            }
+        }
+    }
+    auto indices = std::vector<AssetIndex>();
+    for (uint copy = 0; copy < 2; copy++) {
+        for (uint y = 0; y < GRID_SIZE; y++) {
+            for (uint x = 0; x < GRID_SIZE; x++) {
+                const auto a = y * (GRID_SIZE + 1) + x;
+                const auto c = a + GRID_SIZE + 1;
+                indices.insert(indices.end(), {a, c, a + 1, a + 1, c, c + 1});
+            }
+        }
+    }
+    const auto grid_index_count = (uint)indices.size() / 2;
+    const auto submeshes = std::to_array<AssetSubmesh>({
+        {.index_count = grid_index_count, .start_index = 0, .base_vertex = 0},
+        {
+            .index_count = grid_index_count,
+            .start_index = grid_index_count,
+            .base_vertex = (uint)positions.size() / 2,
+        },
+    });
+    auto rand = Pcg();
+    auto* shuffled = &indices[grid_index_count];
+    for (uint t = grid_index_count / 3 - 1; t > 0; t--) {
+        const auto other = rand.random_uint() % (t + 1);
+        std::swap_ranges(&shuffled[t * 3], &shuffled[t * 3 + 3], &shuffled[other * 3]);
+    }
+    const auto buffers = build_meshlets(indices, submeshes, positions);
+
+    // Within limits, and every triangle once, in its submesh.
+    REQUIRE(buffers.submeshes.size() == submeshes.size());
+    auto next_meshlet = 0u;
+    for (uint s = 0; s < submeshes.size(); s++) {
+        const auto& submesh = submeshes[s];
+        const auto& meshlet_submesh = buffers.submeshes[s];
+        REQUIRE(meshlet_submesh.start_meshlet == next_meshlet);
+        next_meshlet += meshlet_submesh.meshlet_count;
+
+        auto source = std::vector<std::array<uint, 3>>();
+        for (uint i = 0; i < submesh.index_count; i += 3) {
+            const auto* triangle = &indices[submesh.start_index + i];
+            source.push_back({
+                triangle[0] + submesh.base_vertex,
+                triangle[1] + submesh.base_vertex,
+                triangle[2] + submesh.base_vertex,
+            });
+        }
+        auto baked = std::vector<std::array<uint, 3>>();
+        for (uint m = 0; m < meshlet_submesh.meshlet_count; m++) {
+            const auto& meshlet = buffers.meshlets[meshlet_submesh.start_meshlet + m];
+            REQUIRE(meshlet.vertex_count > 0);
+            REQUIRE(meshlet.vertex_count <= MESHLET_MAX_VERTEX_COUNT);
+            REQUIRE(meshlet.triangle_count > 0);
+            REQUIRE(meshlet.triangle_count <= MESHLET_MAX_TRIANGLE_COUNT);
+            REQUIRE(meshlet.vertex_offset + meshlet.vertex_count <= buffers.vertices.size());
+            REQUIRE(meshlet.triangle_offset + meshlet.triangle_count <= buffers.triangles.size());
+            for (uint t = 0; t < meshlet.triangle_count; t++) {
+                const auto local =
+                    unpack_meshlet_triangle(buffers.triangles[meshlet.triangle_offset + t]);
+                auto triangle = std::array<uint, 3>();
+                for (uint corner = 0; corner < 3; corner++) {
+                    REQUIRE(local[corner] < meshlet.vertex_count);
+                    triangle[corner] = buffers.vertices[meshlet.vertex_offset + local[corner]];
+                }
+                baked.push_back(triangle);
+            }
+        }
+        std::sort(source.begin(), source.end());
+        std::sort(baked.begin(), baked.end());
+        REQUIRE(baked == source);
+    }
+    REQUIRE(next_meshlet == buffers.meshlets.size());
+
+    // Spheres hold their vertices. From any camera the cone culls from, every
+    // triangle faces away.
+    auto cone_count = 0u;
+    for (const auto& meshlet : buffers.meshlets) {
+        for (uint v = 0; v < meshlet.vertex_count; v++) {
+            const auto& position = positions[buffers.vertices[meshlet.vertex_offset + v]];
+            REQUIRE(float3_distance(position, meshlet.center) <= meshlet.radius * 1.0001f);
+        }
+        if (meshlet.cone_cutoff >= 1.0f) {
+            continue;
+        }
+        cone_count++;
+        for (uint c = 0; c < 64; c++) {
+            const auto camera = meshlet.center
+                + float3(
+                    rand.random_float() - 0.5f,
+                    rand.random_float() - 0.5f,
+                    rand.random_float() - 0.5f
+                ) * (float)(4 * GRID_SIZE);
+            const auto view = float3_normalize(meshlet.cone_apex - camera);
+            if (float3_dot(view, meshlet.cone_axis) < meshlet.cone_cutoff) {
+                continue;
+            }
+            for (uint t = 0; t < meshlet.triangle_count; t++) {
+                const auto local =
+                    unpack_meshlet_triangle(buffers.triangles[meshlet.triangle_offset + t]);
+                const auto& p0 = positions[buffers.vertices[meshlet.vertex_offset + local.x]];
+                const auto& p1 = positions[buffers.vertices[meshlet.vertex_offset + local.y]];
+                const auto& p2 = positions[buffers.vertices[meshlet.vertex_offset + local.z]];
+                const auto normal = float3_cross(p1 - p0, p2 - p0);
+                REQUIRE(float3_dot(normal, camera - p0) <= 1e-3f);
+            }
+        }
+    }
+    REQUIRE(cone_count > 0);
+
+    // Deterministic.
+    const auto buffers_again = build_meshlets(indices, submeshes, positions);
+    REQUIRE(buffers_again.vertices == buffers.vertices);
+    REQUIRE(buffers_again.triangles == buffers.triangles);
+    REQUIRE(
+        std::memcmp(
+            buffers_again.meshlets.data(),
+            buffers.meshlets.data(),
+            buffers.meshlets.size() * sizeof(AssetMeshlet)
+        )
+        == 0
+    );
+
+    // Baked next to their mesh.
+    const auto output = bake_asset_task(
+        test_assets_dir(),
+        AssetTaskProceduralSphere {"sphere", 1.0f, 64, false}
+    );
+    const auto& mesh = std::get<AssetMesh>(output.assets[0]);
+    const auto& meshlets = std::get<AssetMeshlets>(output.assets[1]);
+    REQUIRE(meshlets.name == "sphere_meshlets");
+    REQUIRE(meshlets.triangles.element_count * 3 == mesh.short_indices.element_count);
+    REQUIRE(meshlets.submeshes.element_count == mesh.submeshes.element_count);
+}
+
+TEST_CASE("build_lods - simplified levels", "[baker]") {
+    // Displaced grid, with a seam down the middle: the middle column is split
+    // into two vertices at the same position.
+    static constexpr uint GRID_SIZE = 64;
+    static constexpr uint SEAM_X = GRID_SIZE / 2;
+    auto positions = std::vector<float3>();
+    for (uint y = 0; y <= GRID_SIZE; y++) {
+        for (uint x = 0; x <= GRID_SIZE; x++) {
+            const auto height = std::sin(0.2f * (float)x) * std::cos(0.15f * (float)y);
+            positions.emplace_back((float)x, height, (float)y);
+        }
+    }
+    const auto seam_base = (uint)positions.size();
+    for (uint y = 0; y <= GRID_SIZE; y++) {
+        positions.push_back(positions[y * (GRID_SIZE + 1) + SEAM_X]);
+    }
+    auto indices = std::vector<AssetIndex>();
+    for (uint y = 0; y < GRID_SIZE; y++) {
+        for (uint x = 0; x < GRID_SIZE; x++) {
+            auto a = y * (GRID_SIZE + 1) + x;
+            auto c = a + GRID_SIZE + 1;
+            const auto b = a + 1;
+            const auto d = c + 1;
+            if (x == SEAM_X) {
+                a = seam_base + y;
+                c = seam_base + y + 1;
+            }
+            indices.insert(indices.end(), {a, c, b, b, c, d});
+        }
+    }
+    const auto submeshes = std::to_array<AssetSubmesh>({
+        {.index_count = (uint)indices.size(), .start_index = 0, .base_vertex = 0},
+    });
+    const auto chain = AssetLodChain {
+        .level_count = 3,
+        .levels = {{{0.5f, 0.01f}, {0.25f, 0.02f}, {0.125f, 0.05f}}},
+    };
+    const auto lods = build_lods(indices, submeshes, positions, chain);
+
+    const auto surface_area = [&](Span<const AssetIndex> triangles) {
+        auto area = 0.0;
+        for (size_t i = 0; i < triangles.size(); i += 3) {
+            const auto& p0 = positions[triangles[i]];
+            const auto normal = float3_cross(
+                positions[triangles[i + 1]] - p0,
+                positions[triangles[i + 2]] - p0
+            );
+            area += 0.5 * std::sqrt((double)float3_dot(normal, normal));
+        }
+        return area;
+    };
+    const auto area = surface_area(indices);
+
+    // Fewer triangles every level, with growing errors, over the same surface.
+    REQUIRE(lods.lods.size() == chain.level_count);
+    REQUIRE(lods.submeshes.size() == lods.lods.size() * submeshes.size());
+    auto triangle_count = (uint)indices.size() / 3;
+    auto error = 0.0f;
+    for (uint level = 0; level < lods.lods.size(); level++) {
+        const auto& lod = lods.lods[level];
+        REQUIRE(lod.start_submesh == level * submeshes.size());
+        REQUIRE(lod.error >= error);
+        REQUIRE(lod.error <= chain.levels[level].max_error * (float)GRID_SIZE);
+        error = lod.error;
+
+        const auto& submesh = lods.submeshes[lod.start_submesh];
+        REQUIRE(submesh.index_count % 3 == 0);
+        REQUIRE(submesh.start_index + submesh.index_count <= lods.indices.size());
+        REQUIRE(submesh.index_count / 3 <= triangle_count * LOD_MAX_TRIANGLE_RATIO);
+        triangle_count = submesh.index_count / 3;
+
+        const auto triangles =
+            Span<const AssetIndex>(lods.indices).subspan(submesh.start_index, submesh.index_count);
+        auto used = std::vector<bool>(positions.size());
+        for (size_t i = 0; i < triangles.size(); i += 3) {
+            REQUIRE(triangles[i] != triangles[i + 1]);
+            REQUIRE(triangles[i + 1] != triangles[i + 2]);
+            REQUIRE(triangles[i + 2] != triangles[i]);
+            for (uint corner = 0; corner < 3; corner++) {
+                REQUIRE(triangles[i + corner] < positions.size());
+                used[triangles[i + corner]] = true;
+            }
+        }
+        REQUIRE(std::abs(surface_area(triangles) - area) < area * 0.01);
+
+        // Seams stay where they are, on both sides.
+        for (uint y = 0; y <= GRID_SIZE; y++) {
+            REQUIRE(used[seam_base + y]);
+            REQUIRE(used[y * (GRID_SIZE + 1) + SEAM_X]);
+        }
+    }
+    REQUIRE(triangle_count <= indices.size() / 3 * 0.2f);
+
+    // Deterministic.
+    const auto lods_again = build_lods(indices, submeshes, positions, chain);
+    REQUIRE(lods_again.indices == lods.indices);
+
+    // Baked into the mesh, and picked by their error on screen.
+    const auto output = bake_asset_task(
+        test_assets_dir(),
+        AssetTaskProceduralSphere {"sphere", 1.0f, 64, false}
+    );
+    const auto& mesh = std::get<AssetMesh>(output.assets[0]);
+    REQUIRE(mesh.lods.element_count == 0);
+    REQUIRE(mesh.lod_submeshes.element_count == 0);
+    const auto mesh_lods = std::to_array<baked::MeshLod>({
+        {.start_submesh = 0, .error = 0.01f},
+        {.start_submesh = 1, .error = 0.1f},
+    });
+    REQUIRE(baked::select_mesh_lod({}, 100.0f, 1.0f) == 0);
+    REQUIRE(baked::select_mesh_lod(mesh_lods, 1000.0f, 1.0f) == 0);
+    REQUIRE(baked::select_mesh_lod(mesh_lods, 50.0f, 1.0f) == 1);
+    REQUIRE(baked::select_mesh_lod(mesh_lods, 5.0f, 1.0f) == 2);
+}
+
+TEST_CASE("compact_vertices - round trip", "[baker]") {
+    // Random unit normals, with the axes first, tangents around them, and
+    // weights that sum to 1, with single joint vertices among them.
+    auto rand = Pcg();
+    const auto signed_float = [&]() { return rand.random_float() * 2.0f - 1.0f; };
+    const auto random_direction = [&]() {
+        return float3_normalize(float3(signed_float(), signed_float(), signed_float()));
+    };
+    auto vertices = std::vector<AssetSkinningVertex>();
+    for (uint i = 0; i < 4096; i++) {
+        auto normal = random_direction();
+        if (i < 6) {
+            normal = FLOAT3_ZERO;
+            normal[i % 3] = i < 3 ? 1.0f : -1.0f;
+        }
+        const auto tangent = float3_normalize(float3_cross(normal, random_direction()));
+        auto weight = float4(
+            rand.random_float(),
+            rand.random_float(),
+            rand.random_float(),
+            rand.random_float()
+        );
+        if (i % 3 == 0) {
+            weight = float4(1.0f, 0.0f, 0.0f, 0.0f);
+        }
+        vertices.push_back(
+            AssetSkinningVertex {
+                .position = float3(signed_float() * 10.0f, signed_float() + 5.0f, signed_float()),
+                .normal = normal,
+                .texcoord = float2(rand.random_float(), rand.random_float() * 4.0f),
+                .tangent = float4(tangent, i % 2 == 0 ? 1.0f : -1.0f),
+                .joint = uint4(i % 256, (i * 7) % 256, 3, 255),
+                .weight = weight / (weight.x + weight.y + weight.z + weight.w),
+            }
+        );
+    }
+    const auto compact = compact_vertices(Span<const AssetSkinningVertex>(vertices));
+    REQUIRE(compact.vertices.size() == vertices.size());
+    REQUIRE(sizeof(AssetCompactVertex) == sizeof(baked::CompactVertex));
+    REQUIRE(sizeof(AssetCompactSkinningVertex) == sizeof(baked::CompactSkinningVertex));
+    FB_LOG_INFO(
+        "compact_vertices: {} -> {} bytes per vertex, {} -> {} skinned",
+        sizeof(AssetVertex),
+        sizeof(AssetCompactVertex),
+        sizeof(AssetSkinningVertex),
+        sizeof(AssetCompactSkinningVertex)
+    );
+
+    // Decoded by the reader, within half a step of every encoding.
+    const auto quantization = baked::VertexQuantization {
+        .position_min = compact.quantization.position_min,
+        .position_scale = compact.quantization.position_scale,
+    };
+    for (uint i = 0; i < vertices.size(); i++) {
+        const auto& vertex = vertices[i];
+        auto compact_vertex = baked::CompactSkinningVertex {};
+        std::memcpy(&compact_vertex, &compact.vertices[i], sizeof(compact_vertex));
+        const auto decoded = baked::decode_compact_skinning_vertex(compact_vertex, quantization);
+        for (uint axis = 0; axis < 3; axis++) {
+            REQUIRE(
+                std::abs(decoded.position[axis] - vertex.position[axis])
+                <= quantization.position_scale[axis] * 0.5f + 1e-5f
+            );
+        }
+        REQUIRE(float3_dot(decoded.normal, vertex.normal) >= 0.99999f);
+        const auto decoded_tangent =
+            float3(decoded.tangent.x, decoded.tangent.y, decoded.tangent.z);
+        const auto tangent = float3(vertex.tangent.x, vertex.tangent.y, vertex.tangent.z);
+        REQUIRE(float3_dot(decoded_tangent, tangent) >= 0.99999f);
+        REQUIRE(std::abs(float3_dot(decoded_tangent, decoded.normal)) <= 1e-5f);
+        REQUIRE(decoded.tangent.w == vertex.tangent.w);
+        REQUIRE(std::abs(decoded.texcoord.x - vertex.texcoord.x) <= 1.0f / 2048.0f);
+        REQUIRE(std::abs(decoded.texcoord.y - vertex.texcoord.y) <= 4.0f / 2048.0f);
+        auto weight_sum = 0u;
+        for (uint j = 0; j < 4; j++) {
+            REQUIRE(decoded.joints[j] == vertex.joint[j]);
+            REQUIRE(std::abs(decoded.weights[j] - vertex.weight[j]) <= 2.0f / 255.0f);
+            weight_sum += (uint)std::round(decoded.weights[j] * 255.0f);
+        }
+        REQUIRE(weight_sum == 255);
+    }
+}
+
+TEST_CASE("split_short_index_submeshes - 16-bit runs", "[baker]") {
+    // A small submesh, then a strip over more vertices than 16 bits address.
+    const auto strip_vertex_count = 3 * SHORT_INDEX_VERTEX_COUNT / 2;
+    auto source_indices = std::vector<AssetIndex> {0, 1, 2, 2, 1, 3};
+    for (uint i = 0; i + 2 < strip_vertex_count; i++) {
+        source_indices.push_back(4 + i);
+        source_indices.push_back(4 + i + 1 + i % 2);
+        source_indices.push_back(4 + i + 2 - i % 2);
+    }
+    const auto source_submeshes = std::to_array<AssetSubmesh>({
+        {.index_count = 6, .start_index = 0, .base_vertex = 0},
+        {.index_count = (uint)source_indices.size() - 6, .start_index = 6, .base_vertex = 0},
+    });
+    REQUIRE(mesh_index_format(source_indices) == DXGI_FORMAT_R32_UINT);
+
+    // Same triangles, in order, each run fitting 16 bits from its base vertex.
+    auto indices = source_indices;
+    const auto submeshes = split_short_index_submeshes(Span(indices), source_submeshes);
+    REQUIRE(submeshes.has_value());
+    REQUIRE(submeshes->size() == 3);
+    REQUIRE(submeshes->front().index_count == 6);
+    REQUIRE(submeshes->front().base_vertex == 0);
+    REQUIRE(mesh_index_format(indices) == DXGI_FORMAT_R16_UINT);
+    auto next_index = 0u;
+    for (const auto& submesh : submeshes.value()) {
+        REQUIRE(submesh.start_index == next_index);
+        const auto run =
+            Span<const AssetIndex>(indices).subspan(submesh.start_index, submesh.index_count);
+        REQUIRE(mesh_index_format(run) == DXGI_FORMAT_R16_UINT);
+        for (uint i = 0; i < submesh.index_count; i++) {
+            REQUIRE(run[i] + submesh.base_vertex == source_indices[submesh.start_index + i]);
+        }
+        next_index += submesh.index_count;
+    }
+    REQUIRE(next_index == source_indices.size());
+    const auto short_run = short_indices(Span<const AssetIndex>(indices).subspan(0, 6));
+    REQUIRE(short_run == std::vector<AssetShortIndex> {0, 1, 2, 2, 1, 3});
+
+    // A triangle spanning too many vertices leaves the indices alone.
+    auto wide_indices = std::vector<AssetIndex> {0, 1, SHORT_INDEX_VERTEX_COUNT};
+    const auto wide_submeshes = std::to_array<AssetSubmesh>({
+        {.index_count = 3, .start_index = 0, .base_vertex = 0},
+    });
+    REQUIRE(!split_short_index_submeshes(Span(wide_indices), wide_submeshes).has_value());
+    REQUIRE(wide_indices == std::vector<AssetIndex> {0, 1, SHORT_INDEX_VERTEX_COUNT});
+}
+
+TEST_CASE("build_bounds - matches brute force", "[baker]") {
+    const auto check_bounds = [](Span<const float3> points, const AssetBounds& bounds) {
+        auto min = points[0];
+        auto max = points[0];
+        for (const auto& point : points) {
+            for (uint axis = 0; axis < 3; axis++) {
+                min[axis] = std::min(min[axis], point[axis]);
+                max[axis] = std::max(max[axis], point[axis]);
+            }
+        }
+        REQUIRE(bounds.min == min);
+        REQUIRE(bounds.max == max);
+        auto box_radius = 0.0f;
+        for (const auto& point : points) {
+            box_radius = std::max(box_radius, float3_distance(point, (min + max) * 0.5f));
+        }
+        for (const auto& point : points) {
+            REQUIRE(float3_distance(point, bounds.center) <= bounds.radius * 1.00001f);
+        }
+        REQUIRE(bounds.radius <= box_radius * 1.00001f);
+        for (uint axis = 0; axis < 3; axis++) {
+            REQUIRE(bounds.radius * 2.0f >= (max[axis] - min[axis]) * 0.99999f);
+        }
+    };
+
+    // Every count around the SIMD width, and a larger one.
+    auto rand = Pcg();
+    const auto signed_float = [&]() { return rand.random_float() * 2.0f - 1.0f; };
+    for (const auto count : {1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 1000u}) {
+        auto points = std::vector<float3>();
+        for (uint i = 0; i < count; i++) {
+            points.emplace_back(signed_float() * 8.0f + 3.0f, signed_float(), signed_float());
+        }
+        check_bounds(points, point_bounds(points));
+    }
+
+    // Points on a sphere are bounded by close to that sphere.
+    auto sphere_points = std::vector<float3>();
+    for (uint i = 0; i < 1000; i++) {
+        const auto direction = float3(signed_float(), signed_float(), signed_float());
+        sphere_points.push_back(float3_normalize(direction) * 2.0f + float3(1.0f, 2.0f, 3.0f));
+    }
+    const auto sphere_bounds = point_bounds(sphere_points);
+    check_bounds(sphere_points, sphere_bounds);
+    REQUIRE(sphere_bounds.radius <= 2.0f * 1.05f);
+
+    // Submeshes are bounded by the vertices they use, from their base vertex,
+    // and the mesh by those of every submesh.
+    auto positions = std::vector<float3>();
+    for (uint i = 0; i < 64; i++) {
+        positions.emplace_back(signed_float(), signed_float(), signed_float() + (float)(i / 32));
+    }
+    positions.emplace_back(100.0f, 100.0f, 100.0f);
+    auto indices = std::vector<AssetIndex>();
+    for (uint i = 0; i < 30; i++) {
+        indices.push_back(i);
+        indices.push_back(i + 1);
+        indices.push_back(i + 2);
+    }
+    const auto submeshes = std::to_array<AssetSubmesh>({
+        {.index_count = 45, .start_index = 0, .base_vertex = 0},
+        {.index_count = 45, .start_index = 45, .base_vertex = 17},
+    });
+    const auto bounds = build_bounds(indices, submeshes, positions);
+    REQUIRE(bounds.submesh_bounds.size() == submeshes.size());
+    auto mesh_points = std::vector<float3>();
+    for (uint i = 0; i < submeshes.size(); i++) {
+        const auto& submesh = submeshes[i];
+        auto submesh_points = std::vector<float3>();
+        for (uint j = 0; j < submesh.index_count; j++) {
+            const auto v = indices[submesh.start_index + j] + submesh.base_vertex;
+            submesh_points.push_back(positions[v]);
+            mesh_points.push_back(positions[v]);
+        }
+        check_bounds(submesh_points, bounds.submesh_bounds[i]);
+    }
+    check_bounds(mesh_points, bounds.bounds);
+    REQUIRE(bounds.bounds.max.x < 100.0f);
+}
+
+TEST_CASE("generate_tangents - batches match a single batch", "[baker]") {
+    // Bumpy grid patches, half of them with mirrored texcoords, and copies of
+    // some, with -0 for +0, that mikktspace welds to the originals.
+    static constexpr uint PATCH_SIZE = 8;
+    auto rand = Pcg();
+    auto positions = std::vector<GltfVertexPosition>();
+    auto normals = std::vector<GltfVertexNormal>();
+    auto texcoords = std::vector<GltfVertexTexcoord>();
+    auto patch_faces = std::vector<std::vector<GltfIndex>>();
+    const auto add_faces = [&](uint base_vertex) {
+        auto& faces = patch_faces.emplace_back();
+        for (uint y = 0; y < PATCH_SIZE; y++) {
+            for (uint x = 0; x < PATCH_SIZE; x++) {
+                const auto v = base_vertex + y * (PATCH_SIZE + 1) + x;
+                faces.insert(faces.end(), {v, v + PATCH_SIZE + 1, v + 1});
+                faces.insert(faces.end(), {v + 1, v + PATCH_SIZE + 1, v + PATCH_SIZE + 2});
+            }
+        }
+    };
+    for (uint patch = 0; patch < 6; patch++) {
+        const auto base_vertex = (uint)positions.size();
+        for (uint y = 0; y <= PATCH_SIZE; y++) {
+            for (uint x = 0; x <= PATCH_SIZE; x++) {
+                const auto u = (float)x / PATCH_SIZE;
+                const auto v = (float)y / PATCH_SIZE;
+                positions.emplace_back((float)x, rand.random_float(), (float)(y + patch * 10));
+                normals.push_back(float3_normalize(
+                    float3(rand.random_float() - 0.5f, 4.0f, rand.random_float() - 0.5f)
+                ));
+                texcoords.emplace_back(patch % 2 == 1 && u > 0.5f ? 1.0f - u : u, v);
+            }
+        }
+        add_faces(base_vertex);
+        if (patch % 3 == 0) {
+            const auto copy_base_vertex = (uint)positions.size();
+            for (uint i = base_vertex; i < copy_base_vertex; i++) {
+                positions.push_back(positions[i]);
+                if (positions[i].x == 0.0f) {
+                    positions.back().x = -0.0f;
+                }
+                normals.push_back(normals[i]);
+                texcoords.push_back(texcoords[i]);
+            }
+            add_faces(copy_base_vertex);
+        }
+    }
+
+    // Faces of every patch interleaved, and degenerate ones.
+    auto indices = std::vector<GltfIndex>();
+    for (uint face = 0; face < PATCH_SIZE * PATCH_SIZE * 2; face++) {
+        for (const auto& faces : patch_faces) {
+            indices.insert(indices.end(), faces.begin() + face * 3, faces.begin() + face * 3 + 3);
+        }
+    }
+    indices.insert(indices.end(), {0, 0, 0, 1, 2, 3});
+
+    const auto tangents = [&](ThreadPool* pool, uint batch_face_count) {
+        auto result = std::vector<float4>(indices.size(), float4(0.0f));
+        generate_tangents(
+            GenerateTangentsDesc {
+                .positions = positions,
+                .normals = normals,
+                .texcoords = texcoords,
+                .indices = indices,
+                .tangents = Span(result),
+                .pool = pool,
+                .batch_face_count = batch_face_count,
+            }
+        );
+        return result;
+    };
+    const auto reference = tangents(nullptr, ~0u);
+    for (const auto& tangent : reference) {
+        REQUIRE(std::abs(tangent.w) == 1.0f);
+    }
+    auto pool = ThreadPool();
+    for (const auto batch_face_count : {1u, 100u, TANGENT_BATCH_FACE_COUNT}) {
+        for (auto* batch_pool : {(ThreadPool*)nullptr, &pool}) {
+            const auto batched = tangents(batch_pool, batch_face_count);
+            REQUIRE(
+                std::memcmp(batched.data(), reference.data(), reference.size() * sizeof(float4))
+                == 0
+            );
+        }
+    }
+}
+
+TEST_CASE("baked bins - assets table of contents", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    const auto tasks = Span<const AssetTask>(PROCEDURAL_AND_TEXTURE_TASKS);
+    auto pool = ThreadPool();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+    const auto baked = bake_assets_bytes(pool, no_cache, no_memo, assets_dir, tasks);
+    const auto& assets = std::get<0>(baked);
+    const auto& data = std::get<1>(baked);
+
+    // The data, then the table of contents.
+    const auto toc = baked_assets_toc(assets, {}, data.size());
+    auto bin = data;
+    bin.insert(bin.end(), toc.begin(), toc.end());
+    const auto header = baked_bin_header(bin);
+    REQUIRE(header.toc_offset % BAKED_BIN_TOC_ALIGNMENT == 0);
+    REQUIRE(header.toc_offset + header.toc_byte_count + sizeof(BakedBinHeader) == bin.size());
+    const auto bin_path = create_temp_path();
+    write_whole_file(bin_path, bin);
+    auto file = baked::AssetsFile();
+    file.load(bin_path, (uint)assets.size());
+    delete_file(bin_path);
+
+    // Every asset resolves to the bytes it was baked with.
+    const auto same_bytes = [&](auto span, const AssetSpan& asset_span) {
+        const auto bytes = std::as_bytes(span);
+        return bytes.size() == asset_span.byte_count
+            && std::memcmp(bytes.data(), data.data() + asset_span.offset, bytes.size()) == 0;
+    };
+    REQUIRE(file.entries().size() == assets.size());
+    for (uint id = 0; id < assets.size(); id++) {
+        REQUIRE((size_t)file.entries()[id].type == assets[id].index());
+        std::visit(
+            overloaded {
+                [&](const AssetMesh& a) {
+                    const auto mesh = file.get<baked::Mesh>(id);
+                    REQUIRE(mesh.transform == a.transform);
+                    REQUIRE((uintptr_t)mesh.vertices.data() % ASSET_SPAN_ALIGNMENT == 0);
+                    REQUIRE(same_bytes(mesh.vertices, a.vertices));
+                    REQUIRE(mesh.index_format == a.index_format);
+                    REQUIRE(same_bytes(mesh.indices, a.indices));
+                    REQUIRE(same_bytes(mesh.short_indices, a.short_indices));
+                    REQUIRE(same_bytes(mesh.submeshes, a.submeshes));
+                    REQUIRE(std::memcmp(&mesh.bounds, &a.bounds, sizeof(a.bounds)) == 0);
+                    REQUIRE(same_bytes(mesh.submesh_bounds, a.submesh_bounds));
+                    REQUIRE(same_bytes(mesh.lod_indices, a.lod_indices));
+                    REQUIRE(same_bytes(mesh.short_lod_indices, a.short_lod_indices));
+                    REQUIRE(same_bytes(mesh.lod_submeshes, a.lod_submeshes));
+                    REQUIRE(same_bytes(mesh.lods, a.lods));
+                    REQUIRE(same_bytes(mesh.compact_vertices, a.compact_vertices));
+                },
+                [&](const AssetMeshlets& a) {
+                    const auto meshlets = file.get<baked::Meshlets>(id);
+                    REQUIRE(sizeof(baked::Meshlet) == sizeof(AssetMeshlet));
+                    REQUIRE(same_bytes(meshlets.meshlets, a.meshlets));
+                    REQUIRE(same_bytes(meshlets.vertices, a.vertices));
+                    REQUIRE(same_bytes(meshlets.triangles, a.triangles));
+                    REQUIRE(same_bytes(meshlets.submeshes, a.submeshes));
+                },
+                [&](const AssetTexture& a) {
+                    const auto texture = file.get<baked::Texture>(id);
+                    REQUIRE(texture.format == a.format);
+                    REQUIRE(texture.width == a.width);
+                    REQUIRE(texture.height == a.height);
+                    REQUIRE(texture.mip_count == a.mip_count);
+                    for (uint mip = 0; mip < a.mip_count; mip++) {
+                        REQUIRE(texture.datas[mip].row_pitch == a.datas[mip].row_pitch);
+                        REQUIRE(texture.datas[mip].slice_pitch == a.datas[mip].slice_pitch);
+                        REQUIRE(same_bytes(texture.datas[mip].data, a.datas[mip].data));
+                        REQUIRE(
+                            (uintptr_t)texture.datas[mip].data.data() % ASSET_TEXTURE_DATA_ALIGNMENT
+                            == 0
+                        );
+                    }
+                },
+                [&](const auto&) { FAIL("Unexpected asset type"); },
+            },
+            assets[id]
+        );
+    }
+
+    // Entry hashes don't depend on where the asset landed in the bin.
+    const auto tail_toc = baked_assets_toc(Span(assets).subspan(1), {}, data.size());
+    const auto toc_entries = [&](const std::vector<std::byte>& bytes) {
+        const auto padding = baked_bin_header(bytes).toc_offset - data.size();
+        return (const BakedAssetEntry*)(bytes.data() + padding);
+    };
+    const auto entries = toc_entries(toc);
+    const auto tail_entries = toc_entries(tail_toc);
+    for (size_t i = 1; i < assets.size(); i++) {
+        REQUIRE(entries[i].hash == tail_entries[i - 1].hash);
+        REQUIRE(entries[i].record_offset != tail_entries[i - 1].record_offset);
+    }
+
+    // Generated ids.
+    REQUIRE(baked_id_name("heatmap_magma_texture") == "HeatmapMagmaTexture");
+    REQUIRE(baked_id_name("ground_mesh") == "GroundMesh");
+}
+
+TEST_CASE("baked bins - reload", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    auto pool = ThreadPool();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+    const auto write_assets_bin = [&](Span<const AssetTask> tasks, uint64_t generation) {
+        const auto [assets, data] = bake_assets_bytes(pool, no_cache, no_memo, assets_dir, tasks);
+        const auto toc = baked_assets_toc(assets, {}, data.size(), generation);
+        auto bin = data;
+        bin.insert(bin.end(), toc.begin(), toc.end());
+        const auto path = create_temp_path();
+        write_whole_file(path, bin);
+        return path;
+    };
+    const auto write_shaders_bin = [](Span<const std::string_view> texts, uint64_t generation) {
+        auto shaders = std::vector<Shader>();
+        for (const auto text : texts) {
+            shaders.push_back(Shader {.name = std::string(text), .dxil = fake_shader_source(text)});
+        }
+        const auto path = create_temp_path();
+        write_whole_file(path, baked_shaders_bin(shaders, {}, generation));
+        return path;
+    };
+
+    SECTION("assets") {
+        // The sphere grows, which moves the skybox in the data, but only the
+        // sphere changed.
+        const auto tasks = std::to_array<AssetTask>({
+            AssetTaskProceduralCube {"cube", 2.0f, false},
+            AssetTaskProceduralSphere {"sphere", 1.0f, 16, false},
+            AssetTaskProceduralCube {"skybox", 2.0f, true},
+        });
+        auto next_tasks = tasks;
+        next_tasks[1] = AssetTaskProceduralSphere {"sphere", 2.0f, 32, false};
+        const auto path = write_assets_bin(tasks, 0);
+        const auto next_path = write_assets_bin(next_tasks, 1);
+        const auto other_path = write_assets_bin(Span<const AssetTask>(tasks).subspan(1), 2);
+
+        auto file = baked::AssetsFile();
+        file.load(path, (uint)tasks.size());
+        const auto vertex_count = file.get<baked::Mesh>(1).vertices.size();
+        const auto skybox_vertex_count = file.get<baked::Mesh>(2).vertices.size();
+        REQUIRE(file.generation() == 0);
+        REQUIRE(file.reload(path) == std::vector<uint>());
+        REQUIRE(file.reload(next_path) == std::vector<uint> {1});
+        REQUIRE(file.generation() == 1);
+        REQUIRE(file.get<baked::Mesh>(1).vertices.size() > vertex_count);
+        REQUIRE(file.get<baked::Mesh>(2).vertices.size() == skybox_vertex_count);
+
+        // Different assets keep the current version.
+        REQUIRE_FALSE(file.reload(other_path).has_value());
+        REQUIRE(file.generation() == 1);
+        REQUIRE(file.reload(path) == std::vector<uint> {1});
+        REQUIRE(file.get<baked::Mesh>(1).vertices.size() == vertex_count);
+        delete_file(path);
+        delete_file(next_path);
+        delete_file(other_path);
+    }
+
+    SECTION("shaders") {
+        const auto texts = std::to_array<std::string_view>({"a 1", "b 1", "c 1"});
+        const auto next_texts = std::to_array<std::string_view>({"a 1", "b 2", "c 2"});
+        const auto path = write_shaders_bin(texts, 0);
+        const auto next_path = write_shaders_bin(next_texts, 1);
+        const auto other_texts = Span<const std::string_view>(texts).subspan(1);
+        const auto other_path = write_shaders_bin(other_texts, 2);
+
+        auto file = baked::ShadersFile();
+        file.load(path, (uint)texts.size());
+        REQUIRE(file.reload(next_path) == std::vector<uint> {1, 2});
+        REQUIRE(file.generation() == 1);
+        REQUIRE(std::ranges::equal(file.get(2), fake_shader_source("c 2")));
+        REQUIRE_FALSE(file.reload(other_path).has_value());
+        REQUIRE(std::ranges::equal(file.get(0), fake_shader_source("a 1")));
+        delete_file(path);
+        delete_file(next_path);
+        delete_file(other_path);
+    }
+}
+
+TEST_CASE("baked bins - splice", "[baker]") {
+    SECTION("assets") {
+        const auto assets_dir = std::format("{}.dir", create_temp_path());
+        create_directories(assets_dir);
+        const auto write_blob = [&](std::string_view text) {
+            write_whole_file(std::format("{}/blob.bin", assets_dir), std::as_bytes(Span(text)));
+        };
+        const auto tasks = std::to_array<AssetTask>({
+            AssetTaskProceduralCube {"cube", 2.0f, false},
+            AssetTaskCopy {"blob", "blob.bin"},
+            AssetTaskProceduralSphere {"sphere", 1.0f, 16, false},
+        });
+        const auto keys = std::to_array({
+            asset_task_params_key(tasks[0]),
+            asset_task_params_key(tasks[1]),
+            asset_task_params_key(tasks[2]),
+        });
+        const auto asset_counts = std::to_array<uint>({1, 1, 1});
+        auto pool = ThreadPool();
+        auto no_cache = AssetCache();
+        auto no_memo = AssetTaskMemo();
+
+        // Full bake.
+        write_blob("blob");
+        const auto [assets, data] = bake_assets_bytes(pool, no_cache, no_memo, assets_dir, tasks);
+        const auto bin_toc =
+            baked_assets_toc(assets, baked_task_entries(keys, asset_counts), data.size());
+        auto bin = data;
+        bin.insert(bin.end(), bin_toc.begin(), bin_toc.end());
+        const auto path = create_temp_path();
+        write_whole_file(path, bin);
+
+        // Splice a new bake of the blob.
+        write_blob("blob, edited");
+        const auto task_indices = std::to_array<size_t>({1});
+        const auto blob_tasks = Span<const AssetTask>(tasks).subspan(1, 1);
+        const auto blob_baked = bake_assets_bytes(pool, no_cache, no_memo, assets_dir, blob_tasks);
+        const auto& blob_assets = std::get<0>(blob_baked);
+        const auto& blob_data = std::get<1>(blob_baked);
+        const auto toc = read_baked_bin_toc(path, ASSETS_BIN_MAGIC);
+        REQUIRE(toc.has_value());
+        const auto splice_blob = [&](Span<const Hash128> task_keys, Span<const uint> counts) {
+            return splice_baked_assets(
+                toc.value(),
+                task_keys,
+                task_indices,
+                counts,
+                blob_assets,
+                blob_data.size()
+            );
+        };
+        const auto splice = splice_blob(keys, Span<const uint>(asset_counts).first(1));
+        REQUIRE(splice.has_value());
+        const auto blob_data_path = create_temp_path();
+        write_whole_file(blob_data_path, blob_data);
+        const auto spliced_path = create_temp_path();
+        {
+            auto writer = FileWriter(spliced_path);
+            write_baked_bin_splice(writer, path, splice.value(), blob_data_path);
+        }
+
+        // A new version of the bin, which starts with the previous one.
+        const auto spliced = FileBuffer::from_path(spliced_path);
+        const auto header = baked_bin_header(spliced.as_span());
+        REQUIRE(FileBuffer::from_path(path).byte_count() == bin.size());
+        REQUIRE(splice->end_offset == bin.size());
+        REQUIRE(
+            spliced.byte_count() == splice->data_offset + blob_data.size() + splice->toc.size()
+        );
+        REQUIRE(header.generation == 1);
+        REQUIRE(std::memcmp(spliced.bytes(), bin.data(), bin.size()) == 0);
+
+        // The blob is new, and the meshes as they were.
+        auto file = baked::AssetsFile();
+        file.load(spliced_path, (uint)tasks.size());
+        const auto blob = file.get<baked::Copy>(1).data;
+        REQUIRE(std::string_view((const char*)blob.data(), blob.size()) == "blob, edited");
+        auto full_file = baked::AssetsFile();
+        full_file.load(path, (uint)tasks.size());
+        for (const auto id : {0u, 2u}) {
+            REQUIRE(std::ranges::equal(
+                std::as_bytes(file.get<baked::Mesh>(id).vertices),
+                std::as_bytes(full_file.get<baked::Mesh>(id).vertices)
+            ));
+        }
+        REQUIRE(full_file.reload(spliced_path) == std::vector<uint> {1});
+
+        // Other tasks, or other assets, take a full bake.
+        const auto other_keys = std::to_array({keys[1], keys[0], keys[2]});
+        const auto two_counts = std::to_array<uint>({2});
+        REQUIRE_FALSE(splice_blob(other_keys, Span<const uint>(asset_counts).first(1)).has_value());
+        REQUIRE_FALSE(splice_blob(keys, two_counts).has_value());
+        delete_file(path);
+        delete_file(blob_data_path);
+        delete_file(spliced_path);
+    }
+
+    SECTION("shaders") {
+        const auto shader = [](std::string_view text) {
+            return Shader {.name = std::string(text), .dxil = fake_shader_source(text)};
+        };
+        const auto keys = std::to_array({Hash128 {.low = 1}, Hash128 {.low = 2}});
+        const auto shader_counts = std::to_array<uint>({2, 1});
+        const auto shaders = std::to_array({shader("a vs"), shader("a ps"), shader("b cs")});
+        const auto path = create_temp_path();
+        write_whole_file(path, baked_shaders_bin(shaders, baked_task_entries(keys, shader_counts)));
+
+        const auto task_indices = std::to_array<size_t>({0});
+        const auto new_shaders = std::to_array({shader("a vs 2"), shader("a ps 2")});
+        const auto toc = read_baked_bin_toc(path, SHADERS_BIN_MAGIC);
+        REQUIRE(toc.has_value());
+        const auto splice = splice_baked_shaders(
+            toc.value(),
+            keys,
+            task_indices,
+            Span<const uint>(shader_counts).first(1),
+            new_shaders
+        );
+        REQUIRE(splice.has_value());
+        const auto spliced_path = create_temp_path();
+        {
+            auto writer = FileWriter(spliced_path);
+            write_baked_bin_splice(writer, path, splice.value());
+        }
+
+        auto file = baked::ShadersFile();
+        file.load(spliced_path, (uint)shaders.size());
+        REQUIRE(std::ranges::equal(file.get(0), fake_shader_source("a vs 2")));
+        REQUIRE(std::ranges::equal(file.get(1), fake_shader_source("a ps 2")));
+        REQUIRE(std::ranges::equal(file.get(2), fake_shader_source("b cs")));
+        REQUIRE(file.entries()[0].offset % BAKED_SHADER_ALIGNMENT == 0);
+        REQUIRE(file.entries()[1].offset % BAKED_SHADER_ALIGNMENT == 0);
+        delete_file(path);
+        delete_file(spliced_path);
+    }
+
+    // Task names.
+    REQUIRE(glob_match("*", "sci_fi_case"));
+    REQUIRE(glob_match("sci_*", "sci_fi_case"));
+    REQUIRE(glob_match("*_case", "sci_fi_case"));
+    REQUIRE(glob_match("s?i*f*", "sci_fi_case"));
+    REQUIRE_FALSE(glob_match("sci", "sci_fi_case"));
+    REQUIRE_FALSE(glob_match("*_cube", "sci_fi_case"));
+}
+
+TEST_CASE("BakeWatcher - affected apps", "[baker]") {
+    const auto source_dir = std::format("{}.dir", create_temp_path());
+    const auto assets_dir = std::format("{}/assets", source_dir);
+    const auto write_file = [&](std::string_view path, std::string_view text) {
+        const auto full_path = std::format("{}/{}", source_dir, path);
+        create_directories(full_path.substr(0, full_path.rfind('/')));
+        write_whole_file(full_path, std::as_bytes(Span(text)));
+    };
+    write_file("assets/a.bin", "a");
+    write_file("assets/b.bin", "b");
+    write_file("app/x.hlsl", "x #include <app/x.hlsli>");
+    write_file("app/x.hlsli", "x.hlsli");
+    write_file("app/notes.txt", "notes");
+    const auto a_tasks = std::to_array<AssetTask>({
+        AssetTaskCopy {"a", "a.bin"},
+        AssetTaskProceduralCube {"cube", 2.0f, false},
+    });
+    const auto b_tasks = std::to_array<AssetTask>({AssetTaskCopy {"b", "b.bin"}});
+    const auto shader_tasks = std::to_array<ShaderTask>({{"app/x.hlsl", "x", {"cs"}}});
+    const auto apps = std::to_array<AppTasks>({
+        {"a", {}, a_tasks, {}},
+        {"b", {}, b_tasks, {}},
+        {"x", {}, {}, shader_tasks},
+    });
+    auto watcher = BakeWatcher(source_dir, assets_dir, apps);
+    REQUIRE(watcher.poll().empty());
+
+    // Inputs of asset tasks.
+    write_file("assets/a.bin", "a, edited");
+    REQUIRE(watcher.poll() == std::vector<size_t> {0});
+    REQUIRE(watcher.poll().empty());
+    write_file("assets/a.bin", "a, edited again");
+    delete_file(std::format("{}/b.bin", assets_dir));
+    REQUIRE(watcher.poll() == std::vector<size_t> {0, 1});
+
+    // Any HLSL file, includes too.
+    write_file("app/x.hlsli", "x.hlsli, edited");
+    REQUIRE(watcher.poll() == std::vector<size_t> {2});
+
+    // Files no task reads.
+    write_file("app/notes.txt", "notes, edited");
+    write_file("assets/c.bin", "c");
+    REQUIRE(watcher.poll().empty());
+}
+
+TEST_CASE("CodeEmitter - formatting", "[baker]") {
+    const auto long_name = std::string(80, 'b');
+    auto code = CodeEmitter();
+    code.line("#pragma once");
+    code.blank();
+    code.blank();
+    code.open("class A");
+    code.access("public");
+    code.blank();
+    code.function("auto a() const -> int", "return 1;");
+    code.function(std::format("auto {}() const -> int", long_name), "return 2;");
+    code.access("private");
+    code.line("int _a;");
+    code.blank();
+    code.close(";");
+    code.blank();
+    const auto values = std::to_array<CodeTemplateValue>({{"x", "1"}});
+    code.text("x = {{x}};\n", values);
+    code.blank();
+
+    const auto expected = std::format(
+        "#pragma once\n"
+        "\n"
+        "class A {{\n"
+        "public:\n"
+        "    auto a() const -> int {{ return 1; }}\n"
+        "    auto {}() const -> int {{\n"
+        "        return 2;\n"
+        "    }}\n"
+        "\n"
+        "private:\n"
+        "    int _a;\n"
+        "}};\n"
+        "\n"
+        "x = 1;\n",
+        long_name
+    );
+    REQUIRE(code.str() == expected);
+    REQUIRE(code.hash() == hash128(code.bytes()));
+}
+
+TEST_CASE("CodeEmitter - matches the committed sources", "[baker]") {
+    const auto baked_dir = std::format("{}/src/baked", FB_BAKER_SOURCE_DIR);
+    const auto committed = [&](std::string_view path) {
+        const auto file = FileBuffer::from_path(std::format("{}/{}", baked_dir, path));
+        return std::string((const char*)file.bytes(), file.byte_count());
+    };
+
+    const auto kitchen_assets = std::to_array<CodeAsset>({{"imgui_font", "Copy"}});
+    const auto kitchen_shaders = std::to_array<std::string_view>({
+        "gui_draw_vs",
+        "gui_draw_ps",
+        "debug_draw_draw_vs",
+        "debug_draw_draw_ps",
+        "spd_downsample_cs",
+    });
+    const auto griddle_shaders = std::to_array<std::string_view>({"griddle_vs", "griddle_ps"});
+    const auto kitchen_hpp = emit_baked_hpp("kitchen", kitchen_assets, kitchen_shaders);
+    const auto griddle_hpp = emit_baked_hpp("griddle", {}, griddle_shaders);
+    REQUIRE(emit_baked_types_hpp().str() == committed("baked_types.hpp"));
+    REQUIRE(kitchen_hpp.str() == committed("kitchen/baked.hpp"));
+    REQUIRE(emit_baked_cpp("kitchen").str() == committed("kitchen/baked.cpp"));
+    REQUIRE(griddle_hpp.str() == committed("griddle/baked.hpp"));
+}
+
+TEST_CASE("OutputHashes - unchanged outputs", "[baker]") {
+    const auto hashes_path = create_temp_path();
+    const auto path = create_temp_path();
+    const auto text = std::as_bytes(Span<const char>("text", 4));
+    const auto other_text = std::as_bytes(Span<const char>("other", 5));
+    delete_file(hashes_path);
+    delete_file(path);
+
+    {
+        auto hashes = OutputHashes(hashes_path);
+        REQUIRE(hashes.write(path, text));
+        REQUIRE_FALSE(hashes.write(path, text));
+        REQUIRE(hashes.hit_count() == 1);
+        hashes.save();
+    }
+
+    // Known by hash, without reading the file.
+    {
+        auto hashes = OutputHashes(hashes_path);
+        REQUIRE_FALSE(hashes.write(path, text));
+        REQUIRE(hashes.hit_count() == 1);
+        REQUIRE(hashes.read_count() == 0);
+        REQUIRE(hashes.write(path, other_text));
+        REQUIRE(FileBuffer::from_path(path).byte_count() == other_text.size());
+    }
+
+    // Without saved hashes, files of the same size are read back.
+    {
+        auto hashes = OutputHashes();
+        REQUIRE_FALSE(hashes.write(path, other_text));
+        REQUIRE(hashes.read_count() == 1);
+    }
+
+    // Published once, then linked, and counted once.
+    {
+        auto hashes = OutputHashes();
+        const auto published_path = create_temp_path();
+        const auto next_path = std::format("{}.next", published_path);
+        const auto link_path = create_temp_path();
+        const auto hash = hash128(text);
+        write_whole_file(next_path, text);
+        REQUIRE(hashes.publish(published_path, next_path, text.size(), hash));
+        REQUIRE_FALSE(file_exists(next_path));
+        REQUIRE(hashes.link(link_path, published_path, text.size(), hash));
+        REQUIRE(FileBuffer::from_path(link_path).byte_count() == text.size());
+        REQUIRE_FALSE(hashes.link(link_path, published_path, text.size(), hash));
+        write_whole_file(next_path, text);
+        REQUIRE_FALSE(hashes.publish(published_path, next_path, text.size(), hash));
+        REQUIRE_FALSE(file_exists(next_path));
+        REQUIRE(hashes.written_byte_count() + hashes.linked_byte_count() == 2 * text.size());
+        REQUIRE(hashes.unchanged_byte_count() == 2 * text.size());
+        delete_file(published_path);
+        delete_file(link_path);
+    }
+    delete_file(hashes_path);
+    delete_file(path);
+}
+
+TEST_CASE("compile_shaders - stable order", "[baker]") {
+    const auto shader_tasks = std::to_array<ShaderTask>({
+        {"a.hlsl", "a", {"draw_vs", "draw_ps"}},
+        {"b.hlsl", "b", {"sim_cs", "reset_cs", "debug_vs", "debug_ps"}},
+        {"a.hlsl", "a_shadow", {"shadow_vs"}},
+    });
+
+    for (const auto worker_count : {0u, 1u, 4u}) {
+        auto pool = ThreadPool(worker_count);
+        auto sources = ShaderSourceCache();
+        sources.insert("mem/a.hlsl", fake_shader_source("source a"));
+        sources.insert("mem/b.hlsl", fake_shader_source("source b"));
+
+        auto no_cache = ShaderCache();
+        auto profiler = BakeProfiler();
+        auto compiler_count = std::atomic<uint>(0);
+        const auto shaders =
+            compile_shaders(pool, profiler, sources, no_cache, "mem", shader_tasks, [&]() {
+                compiler_count++;
+                return FakeShaderCompiler();
+            });
+
+        // Sources came from memory, and compilers were reused.
+        REQUIRE(sources.file_read_count() == 0);
+        REQUIRE(compiler_count.load() >= 1);
+        REQUIRE(compiler_count.load() <= pool.thread_count());
+
+        // Declaration order, regardless of the execution order.
+        const auto expected = std::to_array<std::pair<std::string_view, std::string_view>>({
+            {"a_draw_vs", "draw_vssource a"},
+            {"a_draw_ps", "draw_pssource a"},
+            {"b_sim_cs", "sim_cssource b"},
+            {"b_reset_cs", "reset_cssource b"},
+            {"b_debug_vs", "debug_vssource b"},
+            {"b_debug_ps", "debug_pssource b"},
+            {"a_shadow_shadow_vs", "shadow_vssource a"},
+        });
+        REQUIRE(shaders.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            const auto& [name, dxil] = expected[i];
+            REQUIRE(shaders[i].name == name);
+            REQUIRE(shaders[i].dxil == fake_shader_source(dxil));
+        }
+        REQUIRE(shaders[0].counters.instruction_count == (uint)ShaderType::Vertex);
+        REQUIRE(shaders[1].counters.instruction_count == (uint)ShaderType::Pixel);
+        REQUIRE(shaders[2].counters.instruction_count == (uint)ShaderType::Compute);
+    }
+}
+
+TEST_CASE("ShaderDependencies - include closure", "[baker]") {
+    auto sources = ShaderSourceCache();
+    sources.insert("mem/demo/a.hlsl", fake_shader_source("a #include <demo/a.hlsli>"));
+    sources.insert("mem/demo/a.hlsli", fake_shader_source("a.hlsli #include <kcn/core.hlsli>"));
+    sources.insert("mem/kcn/core.hlsli", fake_shader_source("core"));
+
+    auto dependencies = ShaderDependencies(sources, "mem");
+    const auto source = dependencies.load("demo/a.hlsl");
+    REQUIRE(source.has_value());
+    auto dxil = std::vector<std::byte>();
+    FakeShaderCompiler::preprocess(source.value(), dependencies, dxil);
+
+    // DXC style paths resolve to the same files, and are recorded once.
+    REQUIRE(dependencies.load(".\\kcn/./core.hlsli").has_value());
+    REQUIRE(!dependencies.load("kcn/missing.hlsli").has_value());
+
+    const auto expected = std::to_array<std::string_view>({
+        "mem/demo/a.hlsl",
+        "mem/demo/a.hlsli",
+        "mem/kcn/core.hlsli",
+    });
+    REQUIRE(dependencies.paths().size() == expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        REQUIRE(dependencies.paths()[i] == expected[i]);
+    }
+    REQUIRE(sources.file_read_count() == 0);
+}
+
+TEST_CASE("compile_shaders - include-aware cache", "[baker]") {
+    const auto shader_tasks = std::to_array<ShaderTask>({
+        {"a/a.hlsl", "a", {"draw_vs", "draw_ps"}},
+        {"b/b.hlsl", "b", {"sim_cs"}},
+    });
+    const auto cache_dir = std::format("{}.dir", create_temp_path());
+    auto pool = ThreadPool();
+    auto profiler = BakeProfiler();
+
+    // Every bake starts from a fresh source cache, like a new baker run.
+    auto core = "core 1"sv;
+    auto a_header = "a.hlsli 1"sv;
+    const auto bake = [&](ShaderCache& cache, uint& compile_count) {
+        auto sources = ShaderSourceCache();
+        sources.insert("mem/a/a.hlsl", fake_shader_source("a #include <a/a.hlsli>"));
+        sources.insert("mem/a/a.hlsli", fake_shader_source(a_header));
+        sources.insert("mem/b/b.hlsl", fake_shader_source("b #include <kcn/core.hlsli>"));
+        sources.insert("mem/kcn/core.hlsli", fake_shader_source(core));
+        auto compiles = std::atomic<uint>(0);
+        auto shaders = compile_shaders(pool, profiler, sources, cache, "mem", shader_tasks, [&]() {
+            return FakeShaderCompiler {.compile_count = &compiles};
+        });
+        compile_count = compiles.load();
+        return shaders;
+    };
+
+    // Cold.
+    uint compile_count = 0;
+    {
+        auto cache = ShaderCache(cache_dir);
+        bake(cache, compile_count);
+        REQUIRE(compile_count == 3);
+        REQUIRE(cache.miss_count() == 3);
+    }
+
+    // Warm, nothing changed.
+    {
+        auto cache = ShaderCache(cache_dir);
+        const auto shaders = bake(cache, compile_count);
+        REQUIRE(compile_count == 0);
+        REQUIRE(cache.hit_count() == 3);
+        REQUIRE(shaders[0].name == "a_draw_vs");
+        REQUIRE(shaders[0].dxil == fake_shader_source("draw_vsa #include <a/a.hlsli>a.hlsli 1"));
+        REQUIRE(shaders[2].dxil == fake_shader_source("sim_csb #include <kcn/core.hlsli>core 1"));
+    }
+
+    // Editing one demo's header recompiles only that demo's entry points.
+    a_header = "a.hlsli 2";
+    {
+        auto cache = ShaderCache(cache_dir);
+        const auto shaders = bake(cache, compile_count);
+        REQUIRE(compile_count == 2);
+        REQUIRE(cache.hit_count() == 1);
+        REQUIRE(shaders[1].dxil == fake_shader_source("draw_psa #include <a/a.hlsli>a.hlsli 2"));
+    }
+
+    // Editing a shared header recompiles its dependents.
+    core = "core 2";
+    {
+        auto cache = ShaderCache(cache_dir);
+        const auto shaders = bake(cache, compile_count);
+        REQUIRE(compile_count == 1);
+        REQUIRE(cache.hit_count() == 2);
+        REQUIRE(shaders[2].dxil == fake_shader_source("sim_csb #include <kcn/core.hlsli>core 2"));
+    }
+}
+
+TEST_CASE("compile_shaders - cache shared across checkouts", "[baker]") {
+    // Keys are relative to the source dir, in paths and in arguments.
+    const auto arguments = [](std::wstring_view source_dir) {
+        return std::vector<std::wstring>({L"a", L"-I", std::wstring(source_dir)});
+    };
+    REQUIRE(
+        shader_compile_key("a/a.hlsl", arguments(L"C:/one/src"), "C:/one/src")
+        == shader_compile_key("a/a.hlsl", arguments(L"D:/two/src"), "D:/two/src")
+    );
+    REQUIRE(
+        shader_compile_key("a/a.hlsl", arguments(L"C:/one/src"), "C:/one/src")
+        != shader_compile_key("a/a.hlsl", arguments(L"C:/one/kcn"), "C:/one/src")
+    );
+
+    // Entries stored from one checkout hit from another.
+    const auto shader_tasks = std::to_array<ShaderTask>({
+        {"a/a.hlsl", "a", {"draw_vs"}},
+        {"b/b.hlsl", "b", {"sim_cs"}},
+    });
+    const auto cache_dir = std::format("{}.dir", create_temp_path());
+    auto pool = ThreadPool();
+    auto profiler = BakeProfiler();
+    const auto bake = [&](std::string_view source_dir, uint& compile_count) {
+        auto sources = ShaderSourceCache();
+        const auto insert = [&](std::string_view path, std::string_view text) {
+            sources.insert(std::format("{}/{}", source_dir, path), fake_shader_source(text));
+        };
+        insert("a/a.hlsl", "a #include <a/a.hlsli>");
+        insert("a/a.hlsli", "a.hlsli");
+        insert("b/b.hlsl", "b #include <kcn/core.hlsli>");
+        insert("kcn/core.hlsli", "core");
+        auto cache = ShaderCache(cache_dir);
+        auto compiles = std::atomic<uint>(0);
+        compile_shaders(pool, profiler, sources, cache, source_dir, shader_tasks, [&]() {
+            return FakeShaderCompiler {.compile_count = &compiles};
+        });
+        compile_count = compiles.load();
+        return cache.hit_count();
+    };
+    uint compile_count = 0;
+    REQUIRE(bake("one/src", compile_count) == 0);
+    REQUIRE(compile_count == 2);
+    REQUIRE(bake("two/src", compile_count) == 2);
+    REQUIRE(compile_count == 0);
+}
+
+TEST_CASE("BakeFarm - matches local bake", "[baker]") {
+    const auto assets_dir = test_assets_dir();
+    const auto tasks = Span<const AssetTask>(PROCEDURAL_AND_TEXTURE_TASKS);
+    auto pool = ThreadPool();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+    auto profiler = BakeProfiler();
+    const auto [expected_assets, expected_bin] =
+        bake_assets_bytes(pool, no_cache, no_memo, assets_dir, tasks);
+
+    // Merged in declaration order, whichever worker baked what.
+    const auto farm_bake = [&](BakeFarm& farm) {
+        auto [assets, bin, bytes] =
+            bake_assets_file(pool, profiler, no_cache, no_memo, assets_dir, tasks, &farm);
+        REQUIRE(assets.size() == expected_assets.size());
+        for (size_t i = 0; i < assets.size(); i++) {
+            REQUIRE(asset_spans(assets[i]) == asset_spans(expected_assets[i]));
+        }
+        return bytes;
+    };
+
+    SECTION("Healthy workers") {
+        auto threads = std::vector<std::jthread>();
+        auto farm = BakeFarm(3, thread_bake_workers(threads, {}));
+        REQUIRE(farm.worker_count() == 3);
+        REQUIRE(farm_bake(farm) == expected_bin);
+        REQUIRE(farm.crashed_worker_count() == 0);
+        REQUIRE(farm.local_job_count() == 0);
+    }
+
+    SECTION("Crashed workers are replaced by the others") {
+        auto threads = std::vector<std::jthread>();
+        auto farm = BakeFarm(3, thread_bake_workers(threads, {1, 2}));
+        REQUIRE(farm_bake(farm) == expected_bin);
+        REQUIRE(farm.crashed_worker_count() == 2);
+        REQUIRE(farm.reassigned_job_count() >= 1);
+    }
+
+    SECTION("Stuck workers time out, and are replaced by the others") {
+        auto threads = std::vector<std::jthread>();
+        auto farm = BakeFarm(3, thread_bake_workers(threads, {1}, BakeWorkerFault::Hang), 1.0);
+        REQUIRE(farm_bake(farm) == expected_bin);
+        REQUIRE(farm.timed_out_worker_count() == 1);
+        REQUIRE(farm.crashed_worker_count() == 0);
+        REQUIRE(farm.reassigned_job_count() >= 1);
+        REQUIRE(farm.local_job_count() == 0);
+    }
+
+    SECTION("Jobs fall back to the coordinator once every worker crashed") {
+        auto threads = std::vector<std::jthread>();
+        auto farm = BakeFarm(2, thread_bake_workers(threads, {0, 0}));
+        REQUIRE(farm_bake(farm) == expected_bin);
+        REQUIRE(farm.crashed_worker_count() == 2);
+        REQUIRE(farm.local_job_count() == tasks.size());
+    }
+}
+
+TEST_CASE("BakeFarm - shaders", "[baker]") {
+    const auto shader_tasks = std::to_array<ShaderTask>({
+        {"a/a.hlsl", "a", {"draw_vs", "draw_ps"}},
+        {"b/b.hlsl", "b", {"sim_cs"}},
+    });
+    const auto source_dir = std::format("{}.dir", create_temp_path());
+    const auto write_source = [&](std::string_view path, std::string_view text) {
+        const auto full_path = std::format("{}/{}", source_dir, path);
+        create_directories(full_path.substr(0, full_path.rfind('/')));
+        write_whole_file(full_path, fake_shader_source(text));
+    };
+    write_source("a/a.hlsl", "a #include <a/a.hlsli>");
+    write_source("a/a.hlsli", "a.hlsli");
+    write_source("b/b.hlsl", "b #include <kcn/core.hlsli>");
+    write_source("kcn/core.hlsli", "core");
+    const auto cache_dir = std::format("{}.dir", create_temp_path());
+    auto pool = ThreadPool();
+    auto profiler = BakeProfiler();
+
+    // Workers compile from the same sources.
+    auto farm_shaders = std::vector<Shader>();
+    {
+        auto threads = std::vector<std::jthread>();
+        auto farm = BakeFarm(2, thread_bake_workers(threads, {}));
+        auto sources = ShaderSourceCache();
+        auto cache = ShaderCache(cache_dir);
+        farm_shaders =
+            compile_shaders(pool, profiler, sources, cache, source_dir, shader_tasks, [&]() {
+                return BakeFarmShaderCompiler(farm, FakeShaderCompiler());
+            });
+        REQUIRE(farm.local_job_count() == 0);
+        REQUIRE(cache.miss_count() == 3);
+    }
+
+    // Identical to local compiles, and cached with their include closure.
+    auto compile_count = std::atomic<uint>(0);
+    auto sources = ShaderSourceCache();
+    auto cache = ShaderCache(cache_dir);
+    const auto local_shaders =
+        compile_shaders(pool, profiler, sources, cache, source_dir, shader_tasks, [&]() {
+            return FakeShaderCompiler {.compile_count = &compile_count};
+        });
+    REQUIRE(compile_count == 0);
+    REQUIRE(cache.hit_count() == 3);
+    REQUIRE(farm_shaders.size() == local_shaders.size());
+    for (size_t i = 0; i < farm_shaders.size(); i++) {
+        REQUIRE(farm_shaders[i].name == local_shaders[i].name);
+        REQUIRE(farm_shaders[i].dxil == local_shaders[i].dxil);
+    }
+    REQUIRE(farm_shaders[2].dxil == fake_shader_source("sim_csb #include <kcn/core.hlsli>core"));
+}
+
+// Hidden, run with `fb_tests [farm]`: it launches up to 8 workers.
+TEST_CASE("BakeFarm - scaling", "[baker][benchmark][.farm]") {
+    // Synthetic tasks of similar cost, with their own names.
+    constexpr auto TASK_COUNT = 32u;
+    auto names = std::vector<std::string>();
+    for (uint i = 0; i < TASK_COUNT; i++) {
+        names.push_back(std::format("synthetic_{}", i));
+    }
+    auto tasks = std::vector<AssetTask>();
+    for (uint i = 0; i < TASK_COUNT; i++) {
+        if (i % 2 == 0) {
+            tasks.push_back(AssetTaskProceduralTexturedPlane {
+                names[i],
+                512,
+                1.0f + (float)i,
+                RgbaFloat(0.0f, 0.0f, 0.0f, 1.0f),
+                RgbaFloat((float)i / TASK_COUNT, 1.0f, 1.0f, 1.0f),
+            });
+        } else {
+            tasks.push_back(AssetTaskProceduralSphere {names[i], 1.0f + (float)i, 256, false});
+        }
+    }
+
+    const auto assets_dir = test_assets_dir();
+    auto pool = ThreadPool();
+    auto no_cache = AssetCache();
+    auto no_memo = AssetTaskMemo();
+    auto profiler = BakeProfiler();
+    const auto local_timer = Instant();
+    const auto [local_assets, local_bin] =
+        bake_assets_bytes(pool, no_cache, no_memo, assets_dir, tasks);
+    FB_LOG_INFO(
+        "BakeFarm: local {:.3f} s ({} threads)",
+        local_timer.elapsed_time(),
+        pool.thread_count()
+    );
+
+    // Worker processes run this executable.
+    for (const auto worker_count : {1u, 2u, 4u, 8u}) {
+        const auto timer = Instant();
+        auto farm = BakeFarm(worker_count, [](uint16_t port) {
+            return launch_bake_worker_process(port);
+        });
+        REQUIRE(farm.worker_count() == worker_count);
+        const auto startup_time = timer.elapsed_time();
+        const auto [assets, bin, bytes] =
+            bake_assets_file(pool, profiler, no_cache, no_memo, assets_dir, tasks, &farm);
+        const auto bake_time = timer.elapsed_time() - startup_time;
+        REQUIRE(bytes == local_bin);
+        FB_LOG_INFO(
+            "BakeFarm: {} workers, startup {:.3f} s, bake {:.3f} s",
+            worker_count,
+            startup_time,
+            bake_time
+        );
+    }
+}
+
+TEST_CASE("synthetic assets - valid inputs", "[baker]") {
+    const auto mesh_desc = SyntheticGltfDesc {.grid_size = 8, .texture_size = 32};
+    const auto skinned_desc = SyntheticGltfDesc {.grid_size = 8, .joint_count = 13};
+    const auto assets_dir = std::format("{}.dir", create_temp_path());
+    create_directories(assets_dir);
+    write_whole_file(std::format("{}/mesh.glb", assets_dir), synthetic_gltf(mesh_desc));
+    write_whole_file(std::format("{}/skinned.glb", assets_dir), synthetic_gltf(skinned_desc));
+    write_whole_file(std::format("{}/ldr.png", assets_dir), synthetic_ldr_image(64, 32));
+    write_whole_file(std::format("{}/hdr.exr", assets_dir), synthetic_hdr_image(64, 32));
+
+    SECTION("mesh") {
+        const auto output = bake_asset_task(assets_dir, AssetTaskGltf {"synthetic", "mesh.glb"});
+        REQUIRE(output.assets.size() == 3);
+        const auto& mesh = std::get<AssetMesh>(output.assets[0]);
+        REQUIRE(mesh.name == "synthetic_mesh");
+        REQUIRE(mesh.index_format == DXGI_FORMAT_R16_UINT);
+        REQUIRE(mesh.indices.element_count == 0);
+        REQUIRE(mesh.short_indices.element_count == mesh_desc.triangle_count() * 3);
+        REQUIRE(mesh.submesh_bounds.element_count == mesh.submeshes.element_count);
+        REQUIRE(mesh.vertices.element_count == mesh_desc.vertex_count());
+        REQUIRE(mesh.stats.source_vertex_count == mesh_desc.vertex_count());
+        REQUIRE(mesh.compact_vertices.element_count == 0);
+        const auto& meshlets = std::get<AssetMeshlets>(output.assets[1]);
+        REQUIRE(meshlets.name == "synthetic_meshlets");
+        REQUIRE(meshlets.triangles.element_count == mesh_desc.triangle_count());
+        const auto& texture = std::get<AssetTexture>(output.assets[2]);
+        REQUIRE(texture.name == "synthetic_base_color_texture");
+        REQUIRE(texture.width == mesh_desc.texture_size);
+    }
+
+    SECTION("skinned mesh") {
+        const auto output =
+            bake_asset_task(assets_dir, AssetTaskGltf {"synthetic", "skinned.glb"});
+        const auto& mesh = std::get<AssetAnimationMesh>(output.assets[0]);
+        REQUIRE(mesh.name == "synthetic_animation_mesh");
+        REQUIRE(mesh.joint_count == skinned_desc.joint_count);
+        REQUIRE(mesh.duration == skinned_desc.duration);
+        REQUIRE(mesh.index_format == DXGI_FORMAT_R16_UINT);
+        REQUIRE(mesh.short_indices.element_count == skinned_desc.triangle_count() * 3);
+    }
+
+    SECTION("compact vertices") {
+        const auto output = bake_asset_task(
+            assets_dir,
+            AssetTaskGltf {.name = "synthetic", .path = "mesh.glb", .compact_vertices = true}
+        );
+        const auto& mesh = std::get<AssetMesh>(output.assets[0]);
+        REQUIRE(mesh.compact_vertices.element_count == mesh.vertices.element_count);
+        REQUIRE(mesh.compact_vertices.byte_count * 3 == mesh.vertices.byte_count);
+        const auto skinned = bake_asset_task(
+            assets_dir,
+            AssetTaskGltf {.name = "synthetic", .path = "skinned.glb", .compact_vertices = true}
+        );
+        const auto& skinned_mesh = std::get<AssetAnimationMesh>(skinned.assets[0]);
+        REQUIRE(
+            skinned_mesh.compact_skinning_vertices.element_count
+            == skinned_mesh.skinning_vertices.element_count
+        );
+    }
+
+    SECTION("textures") {
+        const auto ldr = bake_asset_task(
+            assets_dir,
+            AssetTaskTexture {
+                "synthetic",
+                "ldr.png",
+                DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
+                AssetColorSpace::Srgb,
+            }
+        );
+        const auto& ldr_texture = std::get<AssetTexture>(ldr.assets[0]);
+        REQUIRE(ldr_texture.width == 64);
+        REQUIRE(ldr_texture.height == 32);
+        const auto hdr = bake_asset_task(assets_dir, AssetTaskHdrTexture {"synthetic", "hdr.exr"});
+        const auto& hdr_texture = std::get<AssetTexture>(hdr.assets[0]);
+        REQUIRE(hdr_texture.name == "synthetic_hdr_texture");
+        REQUIRE(hdr_texture.width == 64);
+        REQUIRE(hdr_texture.height == 32);
+    }
+}
+
+// Hidden, run with `fb_tests [synthetic]`: the inputs take a while to generate.
+TEST_CASE("synthetic assets - throughput", "[baker][benchmark][.synthetic]") {
+    struct Case {
+        std::string_view path;
+        AssetTask task;
+        std::vector<std::byte> bytes;
+        size_t triangle_count;
+    };
+    const auto mesh_desc = SyntheticGltfDesc {.grid_size = 1024, .texture_size = 4096};
+    const auto skinned_desc = SyntheticGltfDesc {
+        .grid_size = 256,
+        .joint_count = 256,
+        .keyframe_count = 3600,
+        .duration = 60.0f,
+    };
+    auto cases = std::vector<Case>();
+    cases.push_back({
+        .path = "mesh.glb",
+        .task = AssetTaskGltf {"mesh", "mesh.glb"},
+        .bytes = synthetic_gltf(mesh_desc),
+        .triangle_count = mesh_desc.triangle_count(),
+    });
+    cases.push_back({
+        .path = "skinned.glb",
+        .task = AssetTaskGltf {"skinned", "skinned.glb"},
+        .bytes = synthetic_gltf(skinned_desc),
+        .triangle_count = skinned_desc.triangle_count(),
+    });
+    cases.push_back({
+        .path = "ldr.png",
+        .task =
+            AssetTaskTexture {
+                "ldr",
+                "ldr.png",
+                DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
+                AssetColorSpace::Srgb,
+            },
+        .bytes = synthetic_ldr_image(8192, 8192),
+        .triangle_count = 0,
+    });
+    cases.push_back({
+        .path = "hdr.exr",
+        .task = AssetTaskHdrTexture {"hdr", "hdr.exr"},
+        .bytes = synthetic_hdr_image(8192, 4096),
+        .triangle_count = 0,
+    });
+    const auto assets_dir = std::format("{}.dir", create_temp_path());
+    create_directories(assets_dir);
+    for (const auto& c : cases) {
+        write_whole_file(std::format("{}/{}", assets_dir, c.path), c.bytes);
+    }
+
+    for (const auto& c : cases) {
+        const auto timer = Instant();
+        const auto output = bake_asset_task(assets_dir, c.task);
+        const auto time = timer.elapsed_time();
+        REQUIRE(!output.assets.empty());
+        const auto mb = (double)c.bytes.size() / (1024.0 * 1024.0);
+        FB_LOG_INFO(
+            "{}: {:.1f} MB in {:.3f} s, {:.1f} MB/s, {:.2f} Mtris/s",
+            c.path,
+            mb,
+            time,
+            mb / time,
+            (double)c.triangle_count / time / 1e6
+        );
+    }
+}
@@ -1,4 +1,5 @@
 #include <common/common.hpp>
+#include <baker/farm/farm.hpp>
 #include <catch_amalgamated.hpp>
 
 //
@@ -25,12 +26,24 @@ TEST_CASE("float3 - argmax", "[float3]") {
 // Setup.
 //
 
-auto main() -> int {
-    Catch::ConfigData config_data;
-    config_data.testsOrTags.push_back("*");
-    config_data.showSuccessfulTests = true;
+auto main(int argc, char** argv) -> int {
+    // Bake farm tests launch this executable as their workers.
+    if (const auto exit_code = fb::bake_worker_main(argc, argv)) {
+        return exit_code.value();
+    }
+
+    // Hidden tests, like benchmarks tagged `[.weld]`, only run when asked for
+    // on the command line.
     Catch::Session session;
-    session.useConfigData(config_data);
+    if (const auto exit_code = session.applyCommandLine(argc, argv); exit_code != 0) {
+        return exit_code;
+    }
+    auto& config_data = session.configData();
+    if (config_data.testsOrTags.empty()) {
+        config_data.testsOrTags.push_back("~[.]");
+    }
+    config_data.showSuccessfulTests = true;
+    config_data.benchmarkSamples = 10;
     const auto tests_failed = session.run();
     return tests_failed != 0;
 }